@@ -29,31 +29,55 @@
 
 #include "file.h"
 
-#define BUFSTREAM_SIZE      4096
+#define BUFSTREAM_DEFAULT_SIZE  (64*1024)
+#define BUFSTREAM_MIN_SIZE      4096
 
+/*
+ * Read-ahead/write-behind window over another stream.
+ *
+ * Buffer holds the bytes of the underlying stream starting at BufferPos.
+ * When reading, the underlying stream is positioned at BufferPos+ReadSize
+ * and ReadPos is the logical position in the window. When writing, the
+ * underlying stream is positioned at BufferPos and WritePos bytes wait to
+ * be written. Both are never used at the same time.
+ */
 typedef struct bufstream
 {
 	stream Base;
 	stream* Stream;
+    filepos_t BufferPos;
     size_t ReadPos;
     size_t ReadSize;
     size_t WritePos;
-	uint8_t Buffer[BUFSTREAM_SIZE];
+    size_t BufferSize;
+	array Buffer;
 
 } bufstream;
 
+#define BufPosition(p)  ((p)->BufferPos + (filepos_t)((p)->WritePos ? (p)->WritePos : (p)->ReadPos))
+
 static NOINLINE err_t BufFlush(bufstream* p)
 {
     err_t Err = ERR_NONE;
     if (p->Stream && p->WritePos>0)
     {
-        Err = Stream_Write(p->Stream,p->Buffer,p->WritePos,NULL);
+        Err = Stream_Write(p->Stream,ARRAYBEGIN(p->Buffer,uint8_t),p->WritePos,NULL);
         if (Err == ERR_NONE)
+        {
+            p->BufferPos += p->WritePos;
             p->WritePos = 0;
+        }
     }
     return Err;
 }
 
+static bool_t BufAlloc(bufstream* p)
+{
+    if (ARRAYCOUNT(p->Buffer,uint8_t) == p->BufferSize)
+        return 1;
+    return ArrayResize(&p->Buffer,p->BufferSize,0);
+}
+
 static err_t BufStream(bufstream* p,dataid UNUSED_PARAM(Id),stream** Data,size_t UNUSED_PARAM(Size))
 {
     BufFlush(p);
@@ -61,6 +85,66 @@ static err_t BufStream(bufstream* p,dataid UNUSED_PARAM(Id),stream** Data,size_t
     p->ReadPos = 0;
     p->ReadSize = 0;
     p->WritePos = 0;
+    p->BufferPos = 0;
+    if (p->Stream)
+    {
+        filepos_t Pos = Stream_Seek(p->Stream,0,SEEK_CUR);
+        if (Pos != INVALID_FILEPOS_T)
+            p->BufferPos = Pos;
+        if (!BufAlloc(p))
+            return ERR_OUT_OF_MEMORY;
+    }
+    return ERR_NONE;
+}
+
+static err_t BufSetSize(bufstream* p,dataid UNUSED_PARAM(Id),const size_t* Data,size_t Size)
+{
+    err_t Err;
+    if (Size != sizeof(size_t))
+        return ERR_INVALID_DATA;
+
+    Err = BufFlush(p);
+    if (Err != ERR_NONE)
+        return Err;
+
+    if (p->ReadSize && p->ReadPos != p->ReadSize)
+    {
+        // put the underlying stream back at the logical position
+        filepos_t Pos = p->BufferPos + p->ReadPos;
+        if (Stream_Seek(p->Stream,Pos,SEEK_SET) != Pos)
+            return ERR_NOT_SUPPORTED;
+    }
+    p->BufferPos += p->ReadPos;
+    p->ReadPos = 0;
+    p->ReadSize = 0;
+
+    p->BufferSize = max(*Data,(size_t)BUFSTREAM_MIN_SIZE);
+    if (p->Stream && !BufAlloc(p))
+        return ERR_OUT_OF_MEMORY;
+    return ERR_NONE;
+}
+
+static err_t BufGetLength(bufstream* p,dataid UNUSED_PARAM(Id),filepos_t* Data,size_t UNUSED_PARAM(Size))
+{
+    filepos_t Pos;
+    if (!p->Stream || Node_GET(p->Stream,STREAM_LENGTH,Data) != ERR_NONE)
+        return ERR_NOT_SUPPORTED;
+    Pos = p->BufferPos + p->WritePos;
+    if (*Data != INVALID_FILEPOS_T && Pos > *Data)
+        *Data = Pos; // pending writes grow the file
+    return ERR_NONE;
+}
+
+static err_t BufGetURL(bufstream* p,dataid UNUSED_PARAM(Id),tchar_t* Data,size_t Size)
+{
+    if (!p->Stream)
+        return ERR_NOT_SUPPORTED;
+    return Node_Get(p->Stream,STREAM_URL,Data,Size);
+}
+
+static err_t BufCreate(bufstream* p)
+{
+    p->BufferSize = BUFSTREAM_DEFAULT_SIZE;
     return ERR_NONE;
 }
 
@@ -69,6 +153,7 @@ static void BufDelete(bufstream* p)
     BufFlush(p);
     if (p->Stream)
     	NodeDelete((node*)p->Stream);
+    ArrayClear(&p->Buffer);
 }
 
 static err_t BufRead(bufstream* p,uint8_t* Data,size_t Size,size_t* Readed)
@@ -77,20 +162,30 @@ static err_t BufRead(bufstream* p,uint8_t* Data,size_t Size,size_t* Readed)
     size_t Pos = 0;
     size_t Left;
 
+    if (p->WritePos && (Err = BufFlush(p)) != ERR_NONE)
+    {
+        if (Readed)
+            *Readed = 0;
+        return Err;
+    }
+
     while ((Left = (Size - Pos)) > 0)
     {
         if (p->ReadSize <= p->ReadPos)
         {
-            if (Left > BUFSTREAM_SIZE)
+            p->BufferPos += p->ReadSize;
+            p->ReadPos = 0;
+            p->ReadSize = 0;
+
+            if (Left >= p->BufferSize)
             {
                 Err = Stream_Read(p->Stream,Data+Pos,Left,&Left);
-                if (Readed)
-                    *Readed = Pos+Left;
-                return Err;
+                p->BufferPos += Left;
+                Pos += Left;
+                break;
             }
 
-            p->ReadPos = 0;
-            Err = Stream_Read(p->Stream,p->Buffer,BUFSTREAM_SIZE,&p->ReadSize);
+            Err = Stream_Read(p->Stream,ARRAYBEGIN(p->Buffer,uint8_t),p->BufferSize,&p->ReadSize);
             if (p->ReadSize <= 0)
                 break;
         }
@@ -98,7 +193,7 @@ static err_t BufRead(bufstream* p,uint8_t* Data,size_t Size,size_t* Readed)
         if (Left > p->ReadSize - p->ReadPos)
             Left = p->ReadSize - p->ReadPos;
 
-        memcpy(Data+Pos,p->Buffer+p->ReadPos,Left);
+        memcpy(Data+Pos,ARRAYBEGIN(p->Buffer,uint8_t)+p->ReadPos,Left);
         Pos += Left;
         p->ReadPos += Left;
     }
@@ -111,28 +206,128 @@ static err_t BufRead(bufstream* p,uint8_t* Data,size_t Size,size_t* Readed)
 	return Err;
 }
 
+static err_t BufReadOneOrMore(bufstream* p,uint8_t* Data,size_t Size,size_t* Readed)
+{
+    // serve what is already in the window without touching the underlying stream
+    if (!p->WritePos && p->ReadPos < p->ReadSize && Size)
+    {
+        if (Size > p->ReadSize - p->ReadPos)
+            Size = p->ReadSize - p->ReadPos;
+        memcpy(Data,ARRAYBEGIN(p->Buffer,uint8_t)+p->ReadPos,Size);
+        p->ReadPos += Size;
+        if (Readed)
+            *Readed = Size;
+        return ERR_NONE;
+    }
+    return BufRead(p,Data,Size,Readed);
+}
+
+static err_t BufPeek(bufstream* p,const uint8_t** Data,size_t Size)
+{
+    err_t Err;
+    *Data = NULL;
+
+    if (p->WritePos && (Err = BufFlush(p)) != ERR_NONE)
+        return Err;
+
+    if (p->ReadSize - p->ReadPos < Size)
+    {
+        size_t Readed;
+        if (Size > p->BufferSize)
+            return ERR_NOT_SUPPORTED;
+
+        // keep what is left in the window and fill the rest
+        memmove(ARRAYBEGIN(p->Buffer,uint8_t),ARRAYBEGIN(p->Buffer,uint8_t)+p->ReadPos,p->ReadSize - p->ReadPos);
+        p->BufferPos += p->ReadPos;
+        p->ReadSize -= p->ReadPos;
+        p->ReadPos = 0;
+
+        Err = Stream_Read(p->Stream,ARRAYBEGIN(p->Buffer,uint8_t)+p->ReadSize,p->BufferSize - p->ReadSize,&Readed);
+        p->ReadSize += Readed;
+        if (p->ReadSize < Size)
+            return Err != ERR_NONE ? Err : ERR_END_OF_FILE;
+    }
+
+    *Data = ARRAYBEGIN(p->Buffer,uint8_t)+p->ReadPos;
+    return ERR_NONE;
+}
+
+static err_t BufCopyTo(bufstream* p,stream* Output,filepos_t Size,filepos_t* Copied)
+{
+    err_t Err = ERR_NONE;
+    filepos_t n = 0, Rest;
+    size_t Written;
+
+    if (p->WritePos && (Err = BufFlush(p)) != ERR_NONE)
+    {
+        if (Copied)
+            *Copied = 0;
+        return Err;
+    }
+
+    // what is left in the window goes from memory, the underlying stream copies the rest
+    if (p->ReadPos < p->ReadSize && Size > 0)
+    {
+        Err = Stream_Write(Output,ARRAYBEGIN(p->Buffer,uint8_t)+p->ReadPos,(size_t)min(Size,(filepos_t)(p->ReadSize - p->ReadPos)),&Written);
+        p->ReadPos += Written;
+        n = Written;
+    }
+    if (Err == ERR_NONE && n < Size)
+    {
+        p->BufferPos += p->ReadSize;
+        p->ReadPos = 0;
+        p->ReadSize = 0;
+        Err = Stream_CopyTo(p->Stream,Output,Size - n,&Rest);
+        p->BufferPos += Rest;
+        n += Rest;
+    }
+
+    if (Copied)
+        *Copied = n;
+    return Err;
+}
+
 static err_t BufWrite(bufstream* p,const uint8_t* Data,size_t Size,size_t* Written)
 {
     err_t Err = ERR_NONE;
     size_t Pos = 0;
     size_t Left;
 
+    if (p->ReadSize)
+    {
+        // drop the read window, the underlying stream must be at the logical position
+        if (p->ReadPos != p->ReadSize)
+        {
+            filepos_t NewPos = p->BufferPos + p->ReadPos;
+            if (Stream_Seek(p->Stream,NewPos,SEEK_SET) != NewPos)
+            {
+                if (Written)
+                    *Written = 0;
+                return ERR_WRITE;
+            }
+        }
+        p->BufferPos += p->ReadPos;
+        p->ReadPos = 0;
+        p->ReadSize = 0;
+    }
+
     while ((Left = (Size - Pos)) > 0)
     {
-        if (p->WritePos >= BUFSTREAM_SIZE && (Err = BufFlush(p)) != ERR_NONE)
+        if (p->WritePos >= p->BufferSize && (Err = BufFlush(p)) != ERR_NONE)
             break;
 
-        if (!p->WritePos && Left > BUFSTREAM_SIZE)
+        if (!p->WritePos && Left >= p->BufferSize)
         {
             Err = Stream_Write(p->Stream,Data+Pos,Left,&Left);
+            p->BufferPos += Left;
             Pos += Left;
             break;
         }
 
-        if (Left > BUFSTREAM_SIZE - p->WritePos)
-            Left = BUFSTREAM_SIZE - p->WritePos;
+        if (Left > p->BufferSize - p->WritePos)
+            Left = p->BufferSize - p->WritePos;
 
-        memcpy(p->Buffer+p->WritePos,Data+Pos,Left);
+        memcpy(ARRAYBEGIN(p->Buffer,uint8_t)+p->WritePos,Data+Pos,Left);
         Pos += Left;
         p->WritePos += Left;
     }
@@ -142,10 +337,87 @@ static err_t BufWrite(bufstream* p,const uint8_t* Data,size_t Size,size_t* Writt
 	return Err;
 }
 
+static filepos_t BufSeek(bufstream* p,filepos_t Pos,int SeekMode)
+{
+    filepos_t NewPos;
+
+    switch (SeekMode)
+    {
+    case SEEK_CUR: Pos += BufPosition(p); break;
+    case SEEK_END:
+        if (BufFlush(p) != ERR_NONE)
+            return INVALID_FILEPOS_T;
+        NewPos = Stream_Seek(p->Stream,Pos,SEEK_END);
+        if (NewPos != INVALID_FILEPOS_T)
+        {
+            p->BufferPos = NewPos;
+            p->ReadPos = 0;
+            p->ReadSize = 0;
+        }
+        return NewPos;
+    default:
+    case SEEK_SET: break;
+    }
+
+    if (Pos < 0)
+        return INVALID_FILEPOS_T;
+
+    if (!p->WritePos)
+    {
+        // anywhere in the current read window is served from memory
+        if (Pos >= p->BufferPos && Pos <= p->BufferPos + (filepos_t)p->ReadSize)
+        {
+            p->ReadPos = (size_t)(Pos - p->BufferPos);
+            return Pos;
+        }
+    }
+    else if (Pos == p->BufferPos + (filepos_t)p->WritePos)
+        return Pos;
+
+    if (BufFlush(p) != ERR_NONE)
+        return INVALID_FILEPOS_T;
+
+    NewPos = Stream_Seek(p->Stream,Pos,SEEK_SET);
+    if (NewPos != INVALID_FILEPOS_T)
+    {
+        p->BufferPos = NewPos;
+        p->ReadPos = 0;
+        p->ReadSize = 0;
+    }
+    return NewPos;
+}
+
+static err_t BufSkip(bufstream* p,intptr_t* Skip)
+{
+    if (BufSeek(p,*Skip,SEEK_CUR) == INVALID_FILEPOS_T)
+        return ERR_NOT_SUPPORTED;
+    *Skip = 0;
+    return ERR_NONE;
+}
+
+static err_t BufStreamFlush(bufstream* p)
+{
+    err_t Err = BufFlush(p);
+    if (Err == ERR_NONE && p->Stream)
+        Stream_Flush(p->Stream);
+    return Err;
+}
+
 META_START(BufStream_Class,BUFSTREAM_CLASS)
 META_CLASS(SIZE,sizeof(bufstream))
+META_CLASS(CREATE,BufCreate)
 META_CLASS(DELETE,BufDelete)
 META_VMT(TYPE_FUNC,stream_vmt,Read,BufRead)
+META_VMT(TYPE_FUNC,stream_vmt,ReadOneOrMore,BufReadOneOrMore)
 META_VMT(TYPE_FUNC,stream_vmt,Write,BufWrite)
+META_VMT(TYPE_FUNC,stream_vmt,Peek,BufPeek)
+META_VMT(TYPE_FUNC,stream_vmt,CopyTo,BufCopyTo)
+META_VMT(TYPE_FUNC,stream_vmt,Seek,BufSeek)
+META_VMT(TYPE_FUNC,stream_vmt,Skip,BufSkip)
+META_VMT(TYPE_FUNC,stream_vmt,Flush,BufStreamFlush)
 META_PARAM(SET,BUFSTREAM_STREAM,BufStream)
+META_PARAM(SET,BUFSTREAM_SIZE,BufSetSize)
+META_DATA(TYPE_SIZE,BUFSTREAM_SIZE,bufstream,BufferSize)
+META_PARAM(GET,STREAM_LENGTH,BufGetLength)
+META_PARAM(GET,STREAM_URL,BufGetURL)
 META_END(STREAM_CLASS)
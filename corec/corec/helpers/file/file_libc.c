@@ -40,11 +40,17 @@
 #include <unistd.h>
 #include <dirent.h>
 #include <errno.h>
+#include <sys/mman.h>
+#include <sys/uio.h>
 #if defined(TARGET_OSX)
 #include <sys/mount.h>
 #else
 #include <sys/vfs.h>
 #endif
+#if defined(__linux__)
+#include <sys/sendfile.h>
+#include <sys/syscall.h>
+#endif
 
 #if defined(O_ACCMODE)
 #define _RW_ACCESS_FILE  (S_IRUSR|S_IWUSR|S_IRGRP|S_IROTH)
@@ -60,6 +66,7 @@ typedef struct filestream
 	int fd;
 	tchar_t URL[MAXPATH]; // TODO: turn into a dynamic data
 	filepos_t Length;
+	filepos_t Pos; // position of fd, INVALID_FILEPOS_T when unknown
 	int Flags;
 
 	tchar_t DirPath[MAXPATH]; // TODO: turn into a dynamic data
@@ -73,6 +80,7 @@ static err_t Open(filestream* p, const tchar_t* URL, int Flags)
 		close(p->fd);
 
     p->Length = INVALID_FILEPOS_T;
+    p->Pos = INVALID_FILEPOS_T;
 	p->fd = -1;
 
 	if (URL && URL[0])
@@ -100,6 +108,7 @@ static err_t Open(filestream* p, const tchar_t* URL, int Flags)
 		}
 
 		tcscpy_s(p->URL,TSIZEOF(p->URL),URL);
+        p->Pos = 0;
 		
         if (stat(URL, &file_stats) == 0)
 			p->Length = file_stats.st_size;
@@ -116,9 +125,14 @@ static err_t Read(filestream* p,void* Data,size_t Size,size_t* Readed)
     {
         n=0;
         Err = ERR_READ;
+        p->Pos = INVALID_FILEPOS_T;
     }
     else
+    {
         Err = ((size_t)n != Size) ? ERR_END_OF_FILE:ERR_NONE;
+        if (p->Pos != INVALID_FILEPOS_T)
+            p->Pos += n;
+    }
 
     if (Readed)
         *Readed = n;
@@ -139,9 +153,14 @@ static err_t Write(filestream* p,const void* Data,size_t Size,size_t* Written)
     {
         n=0;
         Err = ERR_WRITE;
+        p->Pos = INVALID_FILEPOS_T;
     }
     else
+    {
         Err = (n != Size) ? ERR_WRITE:ERR_NONE;
+        if (p->Pos != INVALID_FILEPOS_T)
+            p->Pos += n;
+    }
 
     if (Written)
         *Written = n;
@@ -150,9 +169,17 @@ static err_t Write(filestream* p,const void* Data,size_t Size,size_t* Written)
 
 static filepos_t Seek(filestream* p,filepos_t Pos,int SeekMode)
 {
-	off_t NewPos = lseek(p->fd, Pos, SeekMode);
+	off_t NewPos;
+
+    // no system call when the position doesn't change
+    if (p->fd != -1 && p->Pos != INVALID_FILEPOS_T &&
+        ((SeekMode == SEEK_SET && Pos == p->Pos) || (SeekMode == SEEK_CUR && Pos == 0)))
+        return p->Pos;
+
+	NewPos = lseek(p->fd, Pos, SeekMode);
     if (NewPos<0)
         return INVALID_FILEPOS_T;
+    p->Pos = NewPos;
     return NewPos;
 }
 
@@ -252,6 +279,8 @@ static void Delete(filestream* p)
 		closedir(p->FindDir);
 }
 
+static err_t CopyTo(filestream* p,stream* Output,filepos_t Size,filepos_t* Copied);
+
 META_START(File_Class,FILE_CLASS)
 META_CLASS(SIZE,sizeof(filestream))
 META_CLASS(PRIORITY,PRI_MINIMUM)
@@ -261,6 +290,7 @@ META_VMT(TYPE_FUNC,stream_vmt,Read,Read)
 META_VMT(TYPE_FUNC,stream_vmt,ReadBlock,ReadBlock)
 META_VMT(TYPE_FUNC,stream_vmt,Write,Write)
 META_VMT(TYPE_FUNC,stream_vmt,Seek,Seek)
+META_VMT(TYPE_FUNC,stream_vmt,CopyTo,CopyTo)
 META_VMT(TYPE_FUNC,stream_vmt,OpenDir,OpenDir)
 META_VMT(TYPE_FUNC,stream_vmt,EnumDir,EnumDir)
 META_CONST(TYPE_INT,filestream,fd,-1)
@@ -272,6 +302,671 @@ META_DATA(TYPE_FILEPOS,STREAM_LENGTH,filestream,Length)
 META_PARAM(STRING,NODE_PROTOCOL,T("file"))
 META_END(STREAM_CLASS)
 
+#if !defined(MMAP_WINDOW_SIZE)
+#if SIZE_MAX > 0xFFFFFFFF
+#define MMAP_WINDOW_SIZE    0 // map the whole file at once
+#else
+#define MMAP_WINDOW_SIZE    (16*1024*1024) // map parts of the file to save address space
+#endif
+#endif
+
+typedef struct mmapstream
+{
+    memstream Base; // Ptr/Size/VirtualOffset describe the mapped window
+    int fd;
+    tchar_t URL[MAXPATH]; // TODO: turn into a dynamic data
+    filepos_t Length;
+    filepos_t Pos;
+    size_t WindowSize;
+    size_t PageMask;
+
+} mmapstream;
+
+static void MMapUnmap(mmapstream* p)
+{
+    if (p->Base.Ptr)
+        munmap((void*)p->Base.Ptr, p->Base.Size);
+    p->Base.Ptr = NULL;
+    p->Base.Size = 0;
+    p->Base.Pos = 0;
+    p->Base.VirtualOffset = 0;
+}
+
+static err_t MMapWindow(mmapstream* p, filepos_t Pos)
+{
+    void *Map;
+    filepos_t Start = Pos & ~(filepos_t)p->PageMask;
+    size_t Size;
+
+    if (p->WindowSize==0 || p->Length - Start <= (filepos_t)p->WindowSize)
+        Size = (size_t)(p->Length - Start);
+    else
+        Size = p->WindowSize;
+
+    MMapUnmap(p);
+    if (Size==0)
+        return ERR_NONE;
+
+    Map = mmap(NULL, Size, PROT_READ, MAP_SHARED, p->fd, Start);
+    if (Map == MAP_FAILED)
+        return ERR_READ;
+
+    p->Base.Ptr = (const uint8_t*)Map;
+    p->Base.Size = Size;
+    p->Base.VirtualOffset = Start;
+    p->Base.Pos = (size_t)(Pos - Start);
+#if defined(MADV_SEQUENTIAL) && defined(MADV_WILLNEED)
+    madvise(Map, Size, p->WindowSize ? MADV_WILLNEED : MADV_SEQUENTIAL);
+#endif
+    return ERR_NONE;
+}
+
+static bool_t MMapInWindow(const mmapstream* p, filepos_t Pos)
+{
+    return p->Base.Ptr && Pos >= p->Base.VirtualOffset && Pos < p->Base.VirtualOffset + (filepos_t)p->Base.Size;
+}
+
+static err_t MMapOpen(mmapstream* p, const tchar_t* URL, int Flags)
+{
+    struct stat file_stats;
+
+    MMapUnmap(p);
+    if (p->fd != -1)
+        close(p->fd);
+
+    p->Length = INVALID_FILEPOS_T;
+    p->Pos = 0;
+    p->fd = -1;
+
+    if (URL && URL[0])
+    {
+        if (Flags & (SFLAG_WRONLY|SFLAG_CREATE))
+            return ERR_NOT_SUPPORTED;
+
+		//TODO: verify it works with Unicode files too
+        p->fd = open(URL, O_RDONLY);
+        if (p->fd == -1)
+        {
+			if ((Flags & (SFLAG_REOPEN|SFLAG_SILENT))==0)
+				NodeReportError(p,NULL,ERR_ID,ERR_FILE_NOT_FOUND,URL);
+            return ERR_FILE_NOT_FOUND;
+        }
+
+        if (fstat(p->fd, &file_stats) != 0 || !S_ISREG(file_stats.st_mode))
+        {
+            close(p->fd);
+            p->fd = -1;
+            return ERR_NOT_SUPPORTED;
+        }
+
+		tcscpy_s(p->URL,TSIZEOF(p->URL),URL);
+        p->Length = file_stats.st_size;
+        p->PageMask = (size_t)sysconf(_SC_PAGESIZE) - 1;
+        p->WindowSize = MMAP_WINDOW_SIZE;
+
+        if (MMapWindow(p, 0) != ERR_NONE)
+        {
+            close(p->fd);
+            p->fd = -1;
+            return ERR_NOT_SUPPORTED;
+        }
+    }
+    return ERR_NONE;
+}
+
+static err_t MMapRead(mmapstream* p,void* Data,size_t Size,size_t* Readed)
+{
+    err_t Err = ERR_NONE;
+    size_t Pos = 0;
+
+    while (Pos < Size)
+    {
+        size_t Left;
+        if (!MMapInWindow(p,p->Pos))
+        {
+            if (p->Pos >= p->Length)
+            {
+                Err = ERR_END_OF_FILE;
+                break;
+            }
+            if ((Err = MMapWindow(p,p->Pos)) != ERR_NONE)
+                break;
+        }
+
+        Left = (size_t)(p->Base.VirtualOffset + p->Base.Size - p->Pos);
+        if (Left > Size - Pos)
+            Left = Size - Pos;
+        memcpy((uint8_t*)Data + Pos, p->Base.Ptr + (size_t)(p->Pos - p->Base.VirtualOffset), Left);
+        Pos += Left;
+        p->Pos += Left;
+    }
+
+    if (MMapInWindow(p,p->Pos))
+        p->Base.Pos = (size_t)(p->Pos - p->Base.VirtualOffset);
+    if (Readed)
+        *Readed = Pos;
+    return Err;
+}
+
+static err_t MMapReadBlock(mmapstream* p,block* Block,size_t Ofs,size_t Size,size_t* Readed)
+{
+	return MMapRead(p,(void*)(Block->Ptr+Ofs),Size,Readed);
+}
+
+static err_t MMapPeek(mmapstream* p,const uint8_t** Data,size_t Size)
+{
+    *Data = NULL;
+    if (p->Pos + (filepos_t)Size > p->Length)
+        return ERR_END_OF_FILE;
+    if (Size && !MMapInWindow(p,p->Pos + Size - 1))
+    {
+        if (p->WindowSize && Size > p->WindowSize - p->PageMask)
+            return ERR_NOT_SUPPORTED;
+        if (MMapWindow(p,p->Pos) != ERR_NONE)
+            return ERR_READ;
+    }
+    if (Size && MMapInWindow(p,p->Pos))
+        *Data = p->Base.Ptr + (size_t)(p->Pos - p->Base.VirtualOffset);
+    return ERR_NONE;
+}
+
+static err_t MMapWrite(mmapstream* UNUSED_PARAM(p),const void* UNUSED_PARAM(Data),size_t UNUSED_PARAM(Size),size_t* Written)
+{
+    if (Written)
+        *Written = 0;
+    return ERR_NOT_SUPPORTED;
+}
+
+static filepos_t MMapSeek(mmapstream* p,filepos_t Pos,int SeekMode)
+{
+	switch (SeekMode)
+	{
+	default:
+	case SEEK_SET: break;
+	case SEEK_CUR: Pos += p->Pos; break;
+	case SEEK_END: Pos += p->Length; break;
+	}
+
+    if (Pos < 0)
+        return INVALID_FILEPOS_T;
+
+    // like lseek() it's possible to seek past the end, reading will fail
+    p->Pos = Pos;
+    if (MMapInWindow(p,Pos))
+        p->Base.Pos = (size_t)(Pos - p->Base.VirtualOffset);
+    else if (Pos < p->Length && MMapWindow(p,Pos) != ERR_NONE)
+        return INVALID_FILEPOS_T;
+    return Pos;
+}
+
+static err_t MMapSkip(mmapstream* p,intptr_t* Skip)
+{
+    if (MMapSeek(p,*Skip,SEEK_CUR) == INVALID_FILEPOS_T)
+        return ERR_NOT_SUPPORTED;
+    *Skip = 0;
+    return ERR_NONE;
+}
+
+static err_t MMapSetData(mmapstream* UNUSED_PARAM(p), dataid UNUSED_PARAM(Id), const void* UNUSED_PARAM(Data), size_t UNUSED_PARAM(Size))
+{
+    return ERR_NOT_SUPPORTED; // the memory is owned by the mapping
+}
+
+static void MMapDelete(mmapstream* p)
+{
+    MMapUnmap(p);
+	if (p->fd != -1)
+    {
+		close(p->fd);
+	    p->fd = -1;
+    }
+}
+
+META_START(MMapStream_Class,MMAPSTREAM_CLASS)
+META_CLASS(SIZE,sizeof(mmapstream))
+META_CLASS(PRIORITY,PRI_MINIMUM)
+META_CLASS(DELETE,MMapDelete)
+META_VMT(TYPE_FUNC,stream_vmt,Open,MMapOpen)
+META_VMT(TYPE_FUNC,stream_vmt,Read,MMapRead)
+META_VMT(TYPE_FUNC,stream_vmt,ReadBlock,MMapReadBlock)
+META_VMT(TYPE_FUNC,stream_vmt,Write,MMapWrite)
+META_VMT(TYPE_FUNC,stream_vmt,Seek,MMapSeek)
+META_VMT(TYPE_FUNC,stream_vmt,Skip,MMapSkip)
+META_VMT(TYPE_FUNC,stream_vmt,Peek,MMapPeek)
+META_CONST(TYPE_INT,mmapstream,fd,-1)
+META_DATA_RDONLY(TYPE_STRING,STREAM_URL,mmapstream,URL)
+META_DATA_RDONLY(TYPE_FILEPOS,STREAM_LENGTH,mmapstream,Length)
+META_PARAM(SET,MEMSTREAM_DATA,MMapSetData)
+META_END(MEMSTREAM_CLASS)
+
+#if !defined(WBUFSTREAM_ALIGN)
+#define WBUFSTREAM_ALIGN        (64*1024)  // file offsets the window is written at
+#endif
+#define WBUFSTREAM_DEFAULT_SIZE (4*1024*1024)
+
+/*
+ * Write-behind local file.
+ *
+ * Buffer holds the bytes of the file starting at BufferPos, End of them are
+ * valid and the logical position is BufferPos+Pos. Seeking anywhere in
+ * [BufferPos,BufferPos+End] only moves Pos so element heads, CRCs and Void
+ * replacements rendered backward are patched in memory. The file descriptor
+ * position is never used, everything goes through pwrite()/pwritev().
+ */
+typedef struct wbufstream
+{
+    stream Stream;
+    int fd;
+    tchar_t URL[MAXPATH]; // TODO: turn into a dynamic data
+    filepos_t Length; // of the file on disk
+    filepos_t BufferPos;
+    size_t Pos;
+    size_t End;
+    size_t BufferSize;
+    array Buffer;
+
+} wbufstream;
+
+static err_t WBufWriteAt(wbufstream* p, const uint8_t* Head, size_t HeadSize, const uint8_t* Tail, size_t TailSize, filepos_t Pos)
+{
+    while (HeadSize || TailSize)
+    {
+        ssize_t n;
+#if defined(TARGET_LINUX) || defined(__FreeBSD__)
+        if (HeadSize && TailSize)
+        {
+            struct iovec Vec[2];
+            Vec[0].iov_base = (void*)Head;
+            Vec[0].iov_len = HeadSize;
+            Vec[1].iov_base = (void*)Tail;
+            Vec[1].iov_len = TailSize;
+            n = pwritev(p->fd, Vec, 2, Pos);
+        }
+        else
+#endif
+        if (HeadSize)
+            n = pwrite(p->fd, Head, HeadSize, Pos);
+        else
+            n = pwrite(p->fd, Tail, TailSize, Pos);
+
+        if (n <= 0)
+        {
+            if (n < 0 && errno == EINTR)
+                continue;
+            return ERR_WRITE;
+        }
+        Pos += n;
+        if ((size_t)n >= HeadSize)
+        {
+            n -= HeadSize;
+            HeadSize = 0;
+            Tail += n;
+            TailSize -= n;
+        }
+        else
+        {
+            Head += n;
+            HeadSize -= n;
+        }
+    }
+    if (Pos > p->Length)
+        p->Length = Pos;
+    return ERR_NONE;
+}
+
+static err_t WBufFlush(wbufstream* p)
+{
+    err_t Err = ERR_NONE;
+    if (p->End)
+        Err = WBufWriteAt(p,ARRAYBEGIN(p->Buffer,uint8_t),p->End,NULL,0,p->BufferPos);
+    if (Err == ERR_NONE)
+    {
+        p->BufferPos += p->Pos;
+        p->Pos = 0;
+        p->End = 0;
+    }
+    return Err;
+}
+
+static err_t WBufSpill(wbufstream* p)
+{
+    // write the aligned part of the full window, keep the rest for late patches
+    filepos_t Aligned = (p->BufferPos + p->End) & ~(filepos_t)(WBUFSTREAM_ALIGN-1);
+    size_t Size = Aligned > p->BufferPos ? (size_t)(Aligned - p->BufferPos) : p->End;
+    err_t Err = WBufWriteAt(p,ARRAYBEGIN(p->Buffer,uint8_t),Size,NULL,0,p->BufferPos);
+    if (Err == ERR_NONE)
+    {
+        memmove(ARRAYBEGIN(p->Buffer,uint8_t),ARRAYBEGIN(p->Buffer,uint8_t)+Size,p->End-Size);
+        p->BufferPos += Size;
+        p->End -= Size;
+        p->Pos -= Size;
+    }
+    return Err;
+}
+
+static err_t WBufOpen(wbufstream* p, const tchar_t* URL, int Flags)
+{
+    struct stat file_stats;
+
+    WBufFlush(p);
+    if (p->fd != -1)
+        close(p->fd);
+
+    p->Length = INVALID_FILEPOS_T;
+    p->BufferPos = 0;
+    p->fd = -1;
+
+    if (URL && URL[0])
+    {
+        if ((Flags & (SFLAG_RDONLY|SFLAG_WRONLY)) != SFLAG_WRONLY)
+            return ERR_NOT_SUPPORTED;
+
+		//TODO: verify it works with Unicode files too
+        p->fd = open(URL, (Flags & SFLAG_CREATE) ? O_WRONLY|O_CREAT|O_TRUNC : O_WRONLY, _RW_ACCESS_FILE);
+        if (p->fd == -1)
+        {
+			if ((Flags & (SFLAG_REOPEN|SFLAG_SILENT))==0)
+				NodeReportError(p,NULL,ERR_ID,ERR_FILE_NOT_FOUND,URL);
+            return ERR_FILE_NOT_FOUND;
+        }
+
+        if (fstat(p->fd, &file_stats) != 0 || !S_ISREG(file_stats.st_mode) ||
+            !ArrayResize(&p->Buffer,p->BufferSize,0))
+        {
+            close(p->fd);
+            p->fd = -1;
+            return ERR_NOT_SUPPORTED;
+        }
+
+		tcscpy_s(p->URL,TSIZEOF(p->URL),URL);
+        p->Length = file_stats.st_size;
+    }
+    return ERR_NONE;
+}
+
+static err_t WBufRead(wbufstream* p,void* Data,size_t Size,size_t* Readed)
+{
+    err_t Err = WBufFlush(p);
+    ssize_t n = 0;
+    if (Err == ERR_NONE)
+    {
+        n = pread(p->fd, Data, Size, p->BufferPos);
+        if (n < 0)
+        {
+            n = 0;
+            Err = ERR_READ;
+        }
+        else
+        {
+            p->BufferPos += n;
+            if ((size_t)n != Size)
+                Err = ERR_END_OF_FILE;
+        }
+    }
+    if (Readed)
+        *Readed = n;
+    return Err;
+}
+
+static err_t WBufReadBlock(wbufstream* p,block* Block,size_t Ofs,size_t Size,size_t* Readed)
+{
+	return WBufRead(p,(void*)(Block->Ptr+Ofs),Size,Readed);
+}
+
+static err_t WBufWrite(wbufstream* p,const uint8_t* Data,size_t Size,size_t* Written)
+{
+    err_t Err = ERR_NONE;
+    size_t Pos = 0;
+    size_t Left;
+
+    if (p->fd == -1)
+        Err = ERR_WRITE;
+    else while ((Left = (Size - Pos)) > 0)
+    {
+        if (p->Pos == p->End && p->End + Left >= p->BufferSize)
+        {
+            // appending more than the window can hold: write the window and
+            // the aligned part of the data at once, buffer the rest
+            filepos_t Start = p->BufferPos + p->End;
+            filepos_t Aligned = (Start + Left) & ~(filepos_t)(WBUFSTREAM_ALIGN-1);
+            if (Aligned > Start)
+            {
+                size_t Direct = (size_t)(Aligned - Start);
+                Err = WBufWriteAt(p,ARRAYBEGIN(p->Buffer,uint8_t),p->End,Data+Pos,Direct,p->BufferPos);
+                if (Err != ERR_NONE)
+                    break;
+                p->BufferPos = Start + Direct;
+                p->Pos = p->End = 0;
+                Pos += Direct;
+                continue;
+            }
+        }
+
+        if (p->Pos == p->BufferSize && (Err = WBufSpill(p)) != ERR_NONE)
+            break;
+
+        if (Left > p->BufferSize - p->Pos)
+            Left = p->BufferSize - p->Pos;
+
+        memcpy(ARRAYBEGIN(p->Buffer,uint8_t)+p->Pos,Data+Pos,Left);
+        Pos += Left;
+        p->Pos += Left;
+        if (p->End < p->Pos)
+            p->End = p->Pos;
+    }
+
+    if (Written)
+        *Written = Pos;
+	return Err;
+}
+
+static filepos_t WBufSeek(wbufstream* p,filepos_t Pos,int SeekMode)
+{
+	switch (SeekMode)
+	{
+	default:
+	case SEEK_SET: break;
+	case SEEK_CUR: Pos += p->BufferPos + p->Pos; break;
+	case SEEK_END: Pos += max(p->Length, p->BufferPos + (filepos_t)p->End); break;
+	}
+
+    if (Pos < 0)
+        return INVALID_FILEPOS_T;
+
+    if (Pos < p->BufferPos || Pos > p->BufferPos + (filepos_t)p->End)
+    {
+        // start a new window, like lseek() it's possible to go past the end
+        if (WBufFlush(p) != ERR_NONE)
+            return INVALID_FILEPOS_T;
+        p->BufferPos = Pos;
+    }
+    p->Pos = (size_t)(Pos - p->BufferPos);
+    return Pos;
+}
+
+static err_t WBufSkip(wbufstream* p,intptr_t* Skip)
+{
+    if (WBufSeek(p,*Skip,SEEK_CUR) == INVALID_FILEPOS_T)
+        return ERR_NOT_SUPPORTED;
+    *Skip = 0;
+    return ERR_NONE;
+}
+
+static err_t WBufStreamFlush(wbufstream* p)
+{
+    return WBufFlush(p);
+}
+
+static err_t WBufGetLength(wbufstream* p,dataid UNUSED_PARAM(Id),filepos_t* Data,size_t UNUSED_PARAM(Size))
+{
+    *Data = p->Length;
+    if (*Data != INVALID_FILEPOS_T && p->BufferPos + (filepos_t)p->End > *Data)
+        *Data = p->BufferPos + p->End; // pending writes grow the file
+    return ERR_NONE;
+}
+
+static err_t WBufSetLength(wbufstream* p,dataid UNUSED_PARAM(Id),const filepos_t* Data,size_t Size)
+{
+    if (Size != sizeof(filepos_t))
+        return ERR_INVALID_DATA;
+    if (WBufFlush(p) != ERR_NONE || ftruncate(p->fd, *Data)!=0)
+		return ERR_BUFFER_FULL;
+    p->Length = *Data;
+	return ERR_NONE;
+}
+
+static err_t WBufSetSize(wbufstream* p,dataid UNUSED_PARAM(Id),const size_t* Data,size_t Size)
+{
+    if (Size != sizeof(size_t))
+        return ERR_INVALID_DATA;
+    if (WBufFlush(p) != ERR_NONE)
+        return ERR_WRITE;
+    p->BufferSize = max(*Data,(size_t)2*WBUFSTREAM_ALIGN);
+    if (p->fd != -1 && !ArrayResize(&p->Buffer,p->BufferSize,0))
+        return ERR_OUT_OF_MEMORY;
+    return ERR_NONE;
+}
+
+static err_t WBufCreate(wbufstream* p)
+{
+    p->BufferSize = WBUFSTREAM_DEFAULT_SIZE;
+    return ERR_NONE;
+}
+
+static void WBufDelete(wbufstream* p)
+{
+    if (p->fd != -1)
+    {
+        WBufFlush(p);
+		close(p->fd);
+	    p->fd = -1;
+    }
+    ArrayClear(&p->Buffer);
+}
+
+META_START(WBufStream_Class,WBUFSTREAM_CLASS)
+META_CLASS(SIZE,sizeof(wbufstream))
+META_CLASS(PRIORITY,PRI_MINIMUM)
+META_CLASS(CREATE,WBufCreate)
+META_CLASS(DELETE,WBufDelete)
+META_VMT(TYPE_FUNC,stream_vmt,Open,WBufOpen)
+META_VMT(TYPE_FUNC,stream_vmt,Read,WBufRead)
+META_VMT(TYPE_FUNC,stream_vmt,ReadBlock,WBufReadBlock)
+META_VMT(TYPE_FUNC,stream_vmt,Write,WBufWrite)
+META_VMT(TYPE_FUNC,stream_vmt,Seek,WBufSeek)
+META_VMT(TYPE_FUNC,stream_vmt,Skip,WBufSkip)
+META_VMT(TYPE_FUNC,stream_vmt,Flush,WBufStreamFlush)
+META_CONST(TYPE_INT,wbufstream,fd,-1)
+META_DATA_RDONLY(TYPE_STRING,STREAM_URL,wbufstream,URL)
+META_PARAM(GET,STREAM_LENGTH,WBufGetLength)
+META_PARAM(SET,STREAM_LENGTH,WBufSetLength)
+META_PARAM(SET,WBUFSTREAM_SIZE,WBufSetSize)
+META_DATA(TYPE_SIZE,WBUFSTREAM_SIZE,wbufstream,BufferSize)
+META_END(STREAM_CLASS)
+
+#if defined(__linux__)
+static int CopyOutput(stream* Output, off_t* Pos)
+{
+    // the descriptor and offset the copied bytes go to, -1 when it's not a local file
+    if (Node_IsPartOf(Output,FILE_CLASS))
+    {
+        filestream* File = (filestream*)Output;
+        if (File->fd == -1 || File->Pos == INVALID_FILEPOS_T)
+            return -1;
+        *Pos = File->Pos;
+        return File->fd;
+    }
+    if (Node_IsPartOf(Output,WBUFSTREAM_CLASS))
+    {
+        wbufstream* File = (wbufstream*)Output;
+        if (File->fd == -1 || WBufFlush(File) != ERR_NONE)
+            return -1;
+        *Pos = File->BufferPos;
+        return File->fd;
+    }
+    return -1;
+}
+#endif
+
+static err_t CopyTo(filestream* p,stream* Output,filepos_t Size,filepos_t* Copied)
+{
+    filepos_t n = 0, Rest;
+    err_t Err;
+#if defined(__linux__)
+    off_t InPos, OutPos;
+    int OutFd;
+
+    if (Size > 0 && p->fd != -1 && (InPos = (p->Pos != INVALID_FILEPOS_T) ? p->Pos : lseek(p->fd,0,SEEK_CUR)) >= 0 &&
+        (OutFd = CopyOutput(Output,&OutPos)) != -1)
+    {
+        // copy_file_range() shares the blocks when the filesystem can, sendfile() still avoids the user copy
+        bool_t Range = 1;
+        while (n < Size)
+        {
+            size_t Chunk = (size_t)min(Size - n,(filepos_t)0x40000000);
+            ssize_t Done = -1;
+#if defined(__NR_copy_file_range)
+            if (Range)
+            {
+                loff_t From = InPos, To = OutPos;
+                Done = syscall(__NR_copy_file_range, p->fd, &From, OutFd, &To, Chunk, 0);
+                if (Done < 0 && errno != EINTR)
+                    Range = 0;
+            }
+#else
+            Range = 0;
+#endif
+            if (!Range)
+            {
+                off_t From = InPos;
+                if (lseek(OutFd,OutPos,SEEK_SET) != OutPos)
+                    break;
+                Done = sendfile(OutFd, p->fd, &From, Chunk);
+                if (Done < 0 && errno != EINTR)
+                    break;
+            }
+            if (Done == 0)
+                break;
+            if (Done > 0)
+            {
+                InPos += Done;
+                OutPos += Done;
+                n += Done;
+            }
+        }
+
+        p->Pos = lseek(p->fd,InPos,SEEK_SET);
+        if (p->Pos < 0)
+            p->Pos = INVALID_FILEPOS_T;
+        if (Node_IsPartOf(Output,WBUFSTREAM_CLASS))
+        {
+            wbufstream* File = (wbufstream*)Output;
+            File->BufferPos = OutPos;
+            if (OutPos > File->Length)
+                File->Length = OutPos;
+        }
+        else
+        {
+            filestream* File = (filestream*)Output;
+            File->Pos = lseek(File->fd,OutPos,SEEK_SET);
+            if (File->Pos < 0)
+                File->Pos = INVALID_FILEPOS_T;
+        }
+        if (n == Size || p->Pos == INVALID_FILEPOS_T)
+        {
+            if (Copied)
+                *Copied = n;
+            return n == Size ? ERR_NONE : ERR_READ;
+        }
+    }
+#endif
+    // whatever the kernel could not do goes through a buffer
+    Err = INHERITED(p,stream_vmt,FILE_CLASS)->CopyTo(p,Output,Size - n,&Rest);
+    if (Copied)
+        *Copied = n + Rest;
+    return Err;
+}
+
 bool_t FileExists(nodecontext *p,const tchar_t* Path)
 {
 	struct stat file_stats;
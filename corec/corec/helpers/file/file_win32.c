@@ -184,6 +184,10 @@ static filepos_t Seek(filestream* p,filepos_t Pos,int SeekMode)
 	filepos_t Result;
 	DWORD Error;
 
+    // no system call when the position doesn't change
+    if (p->Handle && ((SeekMode == SEEK_SET && Pos == p->Pos) || (SeekMode == SEEK_CUR && Pos == 0)))
+        return p->Pos;
+
 	switch (SeekMode)
 	{
 	default:
@@ -50,6 +50,17 @@ static err_t MemRead(memstream* p,void* Data,size_t Size,size_t* Readed)
 	return Err;
 }
 
+static err_t MemPeek(memstream* p,const uint8_t** Data,size_t Size)
+{
+    if (Size > p->Size - p->Pos)
+    {
+        *Data = NULL;
+        return ERR_END_OF_FILE;
+    }
+    *Data = p->Ptr + p->Pos;
+    return ERR_NONE;
+}
+
 static err_t MemWrite(memstream* p, const void* Data, size_t Size, size_t* Written)
 {
     *Written = 0;
@@ -107,10 +118,12 @@ static err_t MemData(memstream* p, dataid UNUSED_PARAM(Id), const void* Data, si
 META_START(MemStream_Class,MEMSTREAM_CLASS)
 META_CLASS(SIZE,sizeof(memstream))
 META_VMT(TYPE_FUNC,stream_vmt,Read,MemRead)
+META_VMT(TYPE_FUNC,stream_vmt,Peek,MemPeek)
 META_VMT(TYPE_FUNC,stream_vmt,Write,MemWrite)
 META_VMT(TYPE_FUNC,stream_vmt,Seek,MemSeek)
 META_PARAM(GET,STREAM_LENGTH,MemLength)
 META_PARAM(SET,MEMSTREAM_DATA,MemData)
 META_DATA(TYPE_FILEPOS,MEMSTREAM_OFFSET,memstream,VirtualOffset)
 META_DATA_RDONLY(TYPE_PTR,MEMSTREAM_PTR,memstream,Ptr)
+META_DATA_RDONLY(TYPE_SIZE,MEMSTREAM_SIZE,memstream,Size)
 META_END(STREAM_CLASS)
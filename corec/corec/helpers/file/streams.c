@@ -155,6 +155,48 @@ static err_t DummyResetReadTimeout(void* UNUSED_PARAM(p))
     return ERR_NOT_SUPPORTED;
 }
 
+static err_t DummyPeek(void* UNUSED_PARAM(p),const uint8_t** Data,size_t UNUSED_PARAM(Size))
+{
+    *Data = NULL;
+    return ERR_NOT_SUPPORTED;
+}
+
+#define COPY_BUFFER_SIZE    (1024*1024)
+
+static err_t DummyCopyTo(void* p,stream* Output,filepos_t Size,filepos_t* Copied)
+{
+    // no faster way known, go through a large buffer
+    array Buffer;
+    filepos_t n = 0;
+    size_t Readed, Written;
+    err_t Err = ERR_NONE, WriteErr;
+
+    ArrayInit(&Buffer);
+    if (Size > 0 && !ArrayResize(&Buffer,(size_t)min(Size,(filepos_t)COPY_BUFFER_SIZE),0))
+        Err = ERR_OUT_OF_MEMORY;
+    while (Err == ERR_NONE && n < Size)
+    {
+        Err = Stream_ReadOneOrMore(p,ARRAYBEGIN(Buffer,uint8_t),(size_t)min(Size-n,(filepos_t)ARRAYCOUNT(Buffer,uint8_t)),&Readed);
+        if (Err == ERR_NEED_MORE_DATA)
+            Err = ERR_NONE;
+        if (Readed == 0)
+        {
+            if (Err == ERR_NONE)
+                Err = ERR_END_OF_FILE;
+            break;
+        }
+        WriteErr = Stream_Write(Output,ARRAYBEGIN(Buffer,uint8_t),Readed,&Written);
+        n += Written;
+        if (WriteErr != ERR_NONE)
+            Err = WriteErr;
+    }
+    ArrayClear(&Buffer);
+
+    if (Copied)
+        *Copied = n;
+    return n == Size ? ERR_NONE : Err;
+}
+
 static err_t ProcessBlocking(void* p,bool_t State)
 { 
     stream* Input;
@@ -230,6 +272,8 @@ META_VMT(TYPE_FUNC,stream_vmt,Wait,DummyWait)
 META_VMT(TYPE_FUNC,stream_vmt,Skip,DummySkip)
 META_VMT(TYPE_FUNC,stream_vmt,Flush,DummyFlush)
 META_VMT(TYPE_FUNC,stream_vmt,ResetReadTimeout,DummyResetReadTimeout)
+META_VMT(TYPE_FUNC,stream_vmt,Peek,DummyPeek)
+META_VMT(TYPE_FUNC,stream_vmt,CopyTo,DummyCopyTo)
 META_END_CONTINUE(MEDIA_CLASS) // STREAMPROCESS_CLASS can have NODE_EXTS
 
 META_START_CONTINUE(STREAMPROCESS_CLASS)
@@ -247,15 +291,31 @@ stream* StreamOpen(anynode *AnyNode, const tchar_t* Path, int Flags)
 	if (File)
 	{
 		err_t Err = Stream_Open(File,Path,Flags);
+        if (Err == ERR_NOT_SUPPORTED && Node_IsPartOf(File,MMAPSTREAM_CLASS))
+        {
+            // the file can't be mapped, use the regular file access
+            NodeDelete((node*)File);
+            File = GetStream(AnyNode,Path,Flags & ~SFLAG_MEMORY_MAP);
+            Err = File ? Stream_Open(File,Path,Flags) : ERR_FILE_NOT_FOUND;
+        }
+        else if (Err == ERR_NOT_SUPPORTED && Node_IsPartOf(File,WBUFSTREAM_CLASS))
+        {
+            // not a regular file, use a generic buffer over the regular file access
+            NodeDelete((node*)File);
+            File = GetStream(AnyNode,Path,Flags & ~SFLAG_BUFFERED);
+            Err = File ? Stream_Open(File,Path,Flags) : ERR_FILE_NOT_FOUND;
+        }
         if (Err != ERR_NONE && Err != ERR_NEED_MORE_DATA)
 		{
-			NodeDelete((node*)File);
+            if (File)
+			    NodeDelete((node*)File);
 			File = NULL;
 		}
         else
         {
             stream* Buf;
-            if ((Flags & SFLAG_BUFFERED) && (Buf = (stream*)NodeCreate(AnyNode,BUFSTREAM_CLASS)) != NULL)
+            // memory streams and write-behind files don't need another buffer
+            if ((Flags & SFLAG_BUFFERED) && !Node_IsPartOf(File,MEMSTREAM_CLASS) && !Node_IsPartOf(File,WBUFSTREAM_CLASS) && (Buf = (stream*)NodeCreate(AnyNode,BUFSTREAM_CLASS)) != NULL)
             {
                 Node_SET(Buf,BUFSTREAM_STREAM,&File);
                 File = Buf;
@@ -354,6 +414,12 @@ stream* GetStream(anynode *AnyNode, const tchar_t* URL, int Flags)
         Stream = (stream*)NodeCreate(AnyNode,NodeClass_Meta(NodeContext_FindClass(AnyNode,FourCC),STREAM_CACHE_CLASS,META_PARAM_CUSTOM));
 #endif
 
+    if (!Stream && (Flags & SFLAG_MEMORY_MAP) && FourCC==FILE_CLASS && (Flags & (SFLAG_WRONLY|SFLAG_CREATE))==0)
+        Stream = (stream*)NodeCreate(AnyNode,MMAPSTREAM_CLASS);
+
+    if (!Stream && (Flags & SFLAG_BUFFERED) && FourCC==FILE_CLASS && (Flags & (SFLAG_RDONLY|SFLAG_WRONLY))==SFLAG_WRONLY)
+        Stream = (stream*)NodeCreate(AnyNode,WBUFSTREAM_CLASS);
+
     if (!Stream)
         Stream = (stream*)NodeCreate(AnyNode,FourCC);
 
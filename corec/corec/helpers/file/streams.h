@@ -72,7 +72,7 @@
 #define SFLAG_WRONLY               0x2
 #define SFLAG_CREATE               0x4
 #define SFLAG_SILENT               0x8
-#define SFLAG_BUFFERED            0x10   // used only by StreamOpen helper function
+#define SFLAG_BUFFERED            0x10   // used only by StreamOpen helper function, write-only local files get a WBUFSTREAM_CLASS
 #define SFLAG_REOPEN              0x20   // private inside stream
 #define SFLAG_NO_PRAGMA           0x40
 #define SFLAG_NO_PROXY            0x80
@@ -85,6 +85,7 @@
 #define SFLAG_FORCE_CACHING     0x4000
 #define SFLAG_LONGTERM_CACHING  0x8000
 #define SFLAG_RECONNECT        0x10000
+#define SFLAG_MEMORY_MAP       0x20000   // used only by StreamOpen helper function, read-only local files
 
 #define MAX_NETWORK_PACKET      2048
 
@@ -163,6 +164,8 @@ typedef struct stream_vmt
     err_t (*Skip)(thisnode,intptr_t* Skip);
     err_t (*Flush)(thisnode);
     err_t (*ResetReadTimeout)(thisnode,int Secs);
+    err_t (*Peek)(thisnode,const uint8_t** Data,size_t Size); // the next Size bytes in place, valid until the next call on the stream
+    err_t (*CopyTo)(thisnode,stream* Output,filepos_t Size,filepos_t* Copied); // the next Size bytes written to Output, in the kernel between local files when possible
 
 } stream_vmt;
 
@@ -180,6 +183,8 @@ typedef struct stream_vmt
 #define Stream_Skip(p,a)                VMT_FUNC(p,stream_vmt)->Skip(p,a)
 #define Stream_Flush(p)                 VMT_FUNC(p,stream_vmt)->Flush(p)
 #define Stream_ResetReadTimeout(p,a)    VMT_FUNC(p,stream_vmt)->ResetReadTimeout(p,a)
+#define Stream_Peek(p,a,b)              VMT_FUNC(p,stream_vmt)->Peek(p,a,b)
+#define Stream_CopyTo(p,a,b,c)          VMT_FUNC(p,stream_vmt)->CopyTo(p,a,b,c)
 
 //--------------------------------------------------------------------------
  
@@ -194,11 +199,22 @@ typedef struct stream_vmt
 #define MEMSTREAM_DATA		0x100
 #define MEMSTREAM_PTR		0x101
 #define MEMSTREAM_OFFSET    0x102
+#define MEMSTREAM_SIZE      0x103 // size_t, bytes available from MEMSTREAM_PTR
+
+//---------------------------------------------------------------------------
+
+#define MMAPSTREAM_CLASS	FOURCC('M','M','A','P') // memory mapped local file, a MEMSTREAM_CLASS
+
+//---------------------------------------------------------------------------
+
+#define WBUFSTREAM_CLASS	FOURCC('W','B','U','F') // write-behind local file
+#define WBUFSTREAM_SIZE		0x100 // size_t, size of the write window
 
 //---------------------------------------------------------------------------
 
 #define BUFSTREAM_CLASS		FOURCC('B','U','F','S')
 #define BUFSTREAM_STREAM	0x100
+#define BUFSTREAM_SIZE		0x101 // size_t, size of the read/write window
 
 //---------------------------------------------------------------------------
 
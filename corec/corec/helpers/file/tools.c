@@ -789,6 +789,10 @@ extern const nodemeta BufStream_Class[];
 extern const nodemeta MemStream_Class[];
 extern const nodemeta Streams_Class[];
 extern const nodemeta File_Class[];
+#if !defined(TARGET_WIN)
+extern const nodemeta MMapStream_Class[];
+extern const nodemeta WBufStream_Class[];
+#endif
 #if defined(CONFIG_STDIO)
 extern const nodemeta Stdio_Class[];
 #endif
@@ -799,6 +803,10 @@ void CoreC_FileInit(nodemodule* Module)
 	NodeRegisterClassEx(Module,MemStream_Class);
 	NodeRegisterClassEx(Module,Streams_Class);
 	NodeRegisterClassEx(Module,File_Class);
+#if !defined(TARGET_WIN)
+	NodeRegisterClassEx(Module,MMapStream_Class);
+	NodeRegisterClassEx(Module,WBufStream_Class);
+#endif
 #if defined(CONFIG_STDIO)
 	NodeRegisterClassEx(Module,Stdio_Class);
 #endif
@@ -70,6 +70,7 @@ typedef struct parsercontext
 } parsercontext;
 
 NODE_DLL void ParserContext_Init(parsercontext* p,const nodemeta* Custom, const cc_memheap* Heap, const cc_memheap* ConstHeap);
+NODE_DLL void ParserContext_InitEx(parsercontext* p,const nodemeta* Custom, const cc_memheap* Heap, const cc_memheap* ConstHeap, int Flags); // Flags: NODECONTEXT_xxx
 NODE_DLL void ParserContext_Done(parsercontext* p);
 
 NODE_DLL void Node_ToUTF8(anynode*, char* Out,size_t OutLen, const tchar_t*);
@@ -39,9 +39,19 @@ static const tchar_t* ExternalStr(nodecontext* p,fourcc_t Class,int Id)
 
 void ParserContext_Init(parsercontext* p,const nodemeta* Custom, const cc_memheap* Heap, const cc_memheap* ConstHeap)
 {
-    NodeContext_Init(&p->Base,Custom,Heap,ConstHeap);
+    ParserContext_InitEx(p,Custom,Heap,ConstHeap,0);
+}
+
+void ParserContext_InitEx(parsercontext* p,const nodemeta* Custom, const cc_memheap* Heap, const cc_memheap* ConstHeap, int Flags)
+{
+    NodeContext_InitEx(&p->Base,Custom,Heap,ConstHeap,Flags);
     p->Base.ExternalStr = ExternalStr;
     StrTab_Init(&p->StrTab,p->Base.NodeConstHeap,5120);
+    if (Flags & NODECONTEXT_SINGLE_THREAD)
+    {
+        LockDelete(p->StrTab.Lock);
+        p->StrTab.Lock = NULL;
+    }
 	p->ToUTF8    = CharConvOpen(NULL,CHARSET_UTF8);
 	p->FromUTF8  = CharConvOpen(CHARSET_UTF8,NULL);
     p->ToStr     = CharConvOpen(NULL,CHARSET_DEFAULT);
@@ -103,6 +103,16 @@ MULTITHREAD_DLL void ThreadStorageSet(void *Storage, const void *Value);
 MULTITHREAD_DLL void *ThreadStorageGet(void *Storage);
 MULTITHREAD_DLL void ThreadStorageDelete(void *Storage);
 
+// number of CPUs in ThreadCPUMask(), at least 1
+static INLINE size_t ThreadCPUCount(void)
+{
+    uint32_t Mask = ThreadCPUMask();
+    size_t Count = 0;
+    for (;Mask;Mask>>=1)
+        Count += Mask & 1;
+    return Count ? Count : 1;
+}
+
 #else
 static INLINE int ThreadGetPriority(void* UNUSED_PARAM(p)) { return MULTITHREAD_PRIORITY_NORMAL; }
 static INLINE void ThreadSetPriority(void* UNUSED_PARAM(p), int UNUSED_PARAM(n)) {}
@@ -195,7 +195,7 @@ uint32_t ThreadCPUMask()
     if (n<0) 
         n=0;
 #endif
-    return (1<<n)-1;
+    return n>=32 ? 0xFFFFFFFF : (((uint32_t)1<<n)-1);
 }
 
 #ifndef TARGET_IPHONE
@@ -232,6 +232,16 @@ static NOINLINE int CmpNodeClass(void* UNUSED_PARAM(p), const node* const* a, co
 	return 0;
 }
 
+static INLINE size_t NodeCacheIndex(fourcc_t ClassId)
+{
+    return (size_t)(((uint32_t)ClassId * 0x9E3779B1) >> (32-NODE_CACHE_BITS));
+}
+
+static void NodeCacheClear(nodecontext* p)
+{
+    memset((void*)p->NodeCache,0,sizeof(p->NodeCache));
+}
+
 NOINLINE const nodeclass* NodeContext_FindClass(anynode* Any,fourcc_t ClassId)
 {
 	size_t Pos;
@@ -243,7 +253,7 @@ NOINLINE const nodeclass* NodeContext_FindClass(anynode* Any,fourcc_t ClassId)
     if (ClassId == 0)
         return NULL;
 
-    Ptr = (const nodeclass*)p->NodeCache;
+    Ptr = (const nodeclass*)p->NodeCache[NodeCacheIndex(ClassId)];
     if (Ptr && NodeClass_ClassId(Ptr) == ClassId)
         return Ptr;
 
@@ -273,7 +283,8 @@ NOINLINE const nodeclass* NodeContext_FindClass(anynode* Any,fourcc_t ClassId)
 		else
 			Ptr = ARRAYBEGIN(p->NodeClass,const nodeclass*)[Pos];
 
-        p->NodeCache = Ptr;
+        if (Ptr)
+            p->NodeCache[NodeCacheIndex(ClassId)] = Ptr;
 	}
 	else
 	{
@@ -1244,7 +1255,7 @@ static void InitClass(nodecontext* p,nodeclass* Class)
 			    if (((int(*)(fourcc_t,void*))i->Data)(NodeClass_ClassId(Class),Class+1) != ERR_NONE)
                 {
                     ReleaseMetaLookup(p,Class);
-                    p->NodeCache = NULL;
+                    NodeCacheClear(p);
 				    Class->State = CLASS_FAILED;
                 }
 			    break;
@@ -1268,7 +1279,7 @@ static void InitClass(nodecontext* p,nodeclass* Class)
  
 	    if (Class->State>=CLASS_INITED && (Class->Flags & (CFLAG_SINGLETON|CFLAG_OWN_MEMORY))==CFLAG_SINGLETON && !NodeCreateFromClass(p,Class,1))
 	    {
-            p->NodeCache = NULL;
+            NodeCacheClear(p);
             Class->State = CLASS_FAILED;
             UnInitClass(p,Class,0); // just to call META_CLASS_VMT_DELETE
 	    }
@@ -1293,6 +1304,42 @@ void NodeContext_UpdateParents(nodecontext* p)
     }
 }
 
+// must be called with NodeLock held
+static node* NodeAlloc(nodecontext* p, size_t Size)
+{
+    size_t Bucket = (Size-1)/NODE_FREE_STEP;
+    if (Bucket < NODE_FREE_BUCKETS)
+    {
+        node* Node = (node*)p->NodeFree[Bucket];
+        if (Node)
+        {
+            p->NodeFree[Bucket] = *(void**)Node;
+            --p->NodeFreeCount[Bucket];
+            return Node;
+        }
+        Size = (Bucket+1)*NODE_FREE_STEP; // so it can be reused by any class of that bucket
+    }
+    return (node*)MemHeap_Alloc(p->NodeHeap,Size,0);
+}
+
+// must be called with NodeLock held
+static void NodeFree(nodecontext* p, node* Node, size_t Size)
+{
+    size_t Bucket = (Size-1)/NODE_FREE_STEP;
+    if (Bucket < NODE_FREE_BUCKETS)
+    {
+        if (p->NodeFreeCount[Bucket] < NODE_FREE_MAX)
+        {
+            *(void**)Node = p->NodeFree[Bucket];
+            p->NodeFree[Bucket] = Node;
+            ++p->NodeFreeCount[Bucket];
+            return;
+        }
+        Size = (Bucket+1)*NODE_FREE_STEP;
+    }
+    MemHeap_Free(p->NodeHeap,Node,Size);
+}
+
 static node* NodeCreateFromClass(nodecontext* p, const nodeclass* Class, bool_t Singleton)
 {
 	node* Node;
@@ -1308,18 +1355,24 @@ static node* NodeCreateFromClass(nodecontext* p, const nodeclass* Class, bool_t
 		return Node;
 	}
 
-	Class = LockModulesWithLock(p,Class);
+    LockEnter(p->NodeLock);
+	Class = LockModules(p,Class);
     if (!Class)
+    {
+        LockLeave(p->NodeLock);
 		return NULL;
+    }
 
 	Size = NodeSize(Class);
 	if (!Size)
 	{
-        UnlockModulesWithLock(p,Class);
+        UnlockModules(Class);
+        LockLeave(p->NodeLock);
 		return NULL;
 	}
 
-    Node = (node*)MemHeap_Alloc(p->NodeHeap,Size,0);
+    Node = NodeAlloc(p,Size);
+    LockLeave(p->NodeLock);
     if (Node)
     {
 		memset(Node,0,Size);
@@ -1342,9 +1395,8 @@ static node* NodeCreateFromClass(nodecontext* p, const nodeclass* Class, bool_t
             if (Singleton)
                 ArrayRemove(&p->NodeSingleton,node*,&Node,NULL,NULL); // can't use CmpNode, because Node->VMT is NULL
 			UnlockModules(Class);
+            NodeFree(p,Node,Size);
         	LockLeave(p->NodeLock);
-
-            MemHeap_Free(p->NodeHeap,Node,Size);
 			Node = NULL;
 		}
 	}
@@ -1360,7 +1412,7 @@ nodeclass* NodeContext_CreateClass(nodecontext* p, fourcc_t ClassId, size_t VMTS
 
     assert(VMTSize>=DEFAULT_VMT);
 
-    p->NodeCache = NULL;
+    NodeCacheClear(p);
 
 	for (i=ARRAYBEGIN(p->NodeClass,nodeclass*);i!=ARRAYEND(p->NodeClass,nodeclass*);++i)
 		if (NodeClass_ClassId(*i) == ClassId && (*i)->Module == Module)
@@ -1467,10 +1519,11 @@ static void EraseNode(nodecontext* p,node* Node,const nodeclass* Class)
     Node->Magic = 0;
 #endif
 
-    UnlockModulesWithLock(p,Class);
-
+    LockEnter(p->NodeLock);
+    UnlockModules(Class);
     if (!(Class->Flags & CFLAG_OWN_MEMORY))
-        MemHeap_Free(p->NodeHeap,Node,Size);
+        NodeFree(p,Node,Size);
+    LockLeave(p->NodeLock);
 }
 
 void Node_AddRef(thisnode p)
@@ -2730,6 +2783,11 @@ META_END(NODEMODULE_CLASS)
 MEMHEAP_DEFAULT
 
 void NodeContext_Init(nodecontext* p,const nodemeta* Custom, const cc_memheap* Heap, const cc_memheap* ConstHeap)
+{
+    NodeContext_InitEx(p,Custom,Heap,ConstHeap,0);
+}
+
+void NodeContext_InitEx(nodecontext* p,const nodemeta* Custom, const cc_memheap* Heap, const cc_memheap* ConstHeap, int Flags)
 {
     fourcc_t ClassId = NODECONTEXT_CLASS;
     node_vmt Tmp;
@@ -2751,7 +2809,8 @@ void NodeContext_Init(nodecontext* p,const nodemeta* Custom, const cc_memheap* H
 #if defined(CONFIG_MULTITHREAD)
     p->PostNotifyParam = p;
 #endif
-	p->NodeLock = LockCreate();
+    if (!(Flags & NODECONTEXT_SINGLE_THREAD))
+	    p->NodeLock = LockCreate(); // LockEnter/LockLeave do nothing on a NULL lock
     p->NodeHeap = Heap;
     p->NodeConstHeap = ConstHeap;
 
@@ -2777,6 +2836,7 @@ void NodeContext_Init(nodecontext* p,const nodemeta* Custom, const cc_memheap* H
 void NodeContext_Done(nodecontext* p)
 {
 	nodeclass **i;
+    size_t Bucket;
 
     NodeSingletonEvent(p,NODE_SINGLETON_SHUTDOWN,NULL);
 
@@ -2813,6 +2873,15 @@ void NodeContext_Done(nodecontext* p)
 		MemHeap_Free(p->NodeHeap,*i,sizeof(nodeclass)+(*i)->VMTSize);
 	}
 
+    // free the recycled nodes
+    for (Bucket=0;Bucket<NODE_FREE_BUCKETS;++Bucket)
+        while (p->NodeFree[Bucket])
+        {
+            void* Node = p->NodeFree[Bucket];
+            p->NodeFree[Bucket] = *(void**)Node;
+            MemHeap_Free(p->NodeHeap,Node,(Bucket+1)*NODE_FREE_STEP);
+        }
+
     assert(ARRAYEMPTY(p->Collect));
 	ArrayClear(&p->Collect);
 	ArrayClear(&p->NodeSingleton);
@@ -493,11 +493,17 @@ struct nodemodule
     uint8_t Changed;
 };
 
+#define NODE_CACHE_BITS     6 // number of bits of the class lookup cache index
+
+#define NODE_FREE_STEP      16
+#define NODE_FREE_BUCKETS   32 // nodes up to 512 bytes are recycled
+#define NODE_FREE_MAX       4096
+
 struct nodecontext
 {
     nodemodule Base;
 	void* NodeLock;
-    const void* NodeCache;
+    const void* NodeCache[1<<NODE_CACHE_BITS]; // direct mapped by class id, read without the lock
 	array NodeSingleton; 
 	array NodeClass; // ordered by id
     const cc_memheap* NodeHeap;
@@ -524,6 +530,8 @@ struct nodecontext
     array Collect;
     bool_t InCollect;
     fourcc_t DynamicClass;
+    void* NodeFree[NODE_FREE_BUCKETS]; // released node memory by size
+    size_t NodeFreeCount[NODE_FREE_BUCKETS];
 };
 
 #define NODECONTEXT_CLASS		        FOURCC('N','C','T','X')
@@ -536,7 +544,10 @@ struct nodecontext
 // notify
 #define NODECONTEXT_CRASH               0x201
 
+#define NODECONTEXT_SINGLE_THREAD       0x01 // the context is only used by one thread, no locking
+
 NODE_DLL void NodeContext_Init(nodecontext*,const nodemeta* Custom, const cc_memheap* Heap, const cc_memheap* ConstHeap);
+NODE_DLL void NodeContext_InitEx(nodecontext*,const nodemeta* Custom, const cc_memheap* Heap, const cc_memheap* ConstHeap, int Flags);
 NODE_DLL void NodeContext_Done(nodecontext*);
 NODE_DLL bool_t NodeContext_Cleanup(nodecontext* p,bool_t Force);
 NODE_DLL dataflags NodeContext_FindDataType(const tchar_t* Type, const tchar_t* Format);
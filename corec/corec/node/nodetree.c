@@ -65,16 +65,20 @@ void NodeTree_Clear(nodetree* p)
 
 static err_t AddChild(nodetree* p,nodetree* Child, nodetree* Before)
 {
-    nodetree** i;
 	LockEnter(Node_Context(p)->NodeLock);
 
-    for (i=&p->Children;*i;i=&(*i)->Next)
-        if (*i == Before)
-            break;
-
     Child->Parent = p;
     Child->Next = Before;
-    *i = Child;
+    Child->Prev = Before ? Before->Prev : p->LastChild;
+    if (Child->Prev)
+        Child->Prev->Next = Child;
+    else
+        p->Children = Child;
+    if (Before)
+        Before->Prev = Child;
+    else
+        p->LastChild = Child;
+    ++p->ChildCount;
 
     LockLeave(Node_Context(p)->NodeLock);
     return ERR_NONE;
@@ -82,17 +86,21 @@ static err_t AddChild(nodetree* p,nodetree* Child, nodetree* Before)
 
 static void RemoveChild(nodetree* p,nodetree* Child)
 {
-	nodetree** i;
 	LockEnter(Node_Context(p)->NodeLock);
 
-	for (i=&p->Children;*i;i=&(*i)->Next)
-		if (*i==Child)
-		{
-			*i=Child->Next;
-			break;
-		}
+    assert(Child->Parent == p);
+    if (Child->Prev)
+        Child->Prev->Next = Child->Next;
+    else
+        p->Children = Child->Next;
+    if (Child->Next)
+        Child->Next->Prev = Child->Prev;
+    else
+        p->LastChild = Child->Prev;
+    --p->ChildCount;
 
 	Child->Next = NULL;
+	Child->Prev = NULL;
     Child->Parent = NULL;
 
     LockLeave(Node_Context(p)->NodeLock);
@@ -54,7 +54,10 @@ struct nodetree
     node Base;
 	nodetree* Parent;
 	nodetree* Next;
+	nodetree* Prev;
 	nodetree* Children;
+	nodetree* LastChild;
+	size_t ChildCount;
 };
 
 #define NodeTree_SetParent(p,a,b) VMT_FUNC(p,nodetree_vmt)->SetParent(p,a,b)
@@ -62,6 +65,9 @@ struct nodetree
 #define NodeTree_FindChild(p,a)   VMT_FUNC(p,nodetree_vmt)->FindChild(p,a)
 #define NodeTree_Parent(p)        ((nodetree*)(p))->Parent
 #define NodeTree_Children(p)      ((nodetree*)(p))->Children
+#define NodeTree_LastChild(p)     ((nodetree*)(p))->LastChild
+#define NodeTree_ChildCount(p)    ((const nodetree*)(p))->ChildCount
+#define NodeTree_Prev(p)          ((nodetree*)(p))->Prev
 #if defined(NDEBUG)
 #define NodeTree_Next(p)          ((nodetree*)(p))->Next
 #else
@@ -1,10 +1,323 @@
 #include "corec/helpers/file/file.h"
 
+#include <stdio.h>
+
+#define TEST_DATA_SIZE  (256*1024)
+
+static int test_bufstream(nodecontext *Context)
+{
+    static uint8_t Data[TEST_DATA_SIZE];
+    uint8_t Read[9000];
+    stream *Mem, *Buf;
+    size_t i, Readed, WindowSize = 8192;
+    filepos_t Pos;
+    int Result = 0;
+
+    for (i=0;i<TEST_DATA_SIZE;++i)
+        Data[i] = (uint8_t)(i*7 + (i>>8));
+
+    Mem = (stream*)NodeCreate(Context,MEMSTREAM_CLASS);
+    Buf = (stream*)NodeCreate(Context,BUFSTREAM_CLASS);
+    if (!Mem || !Buf)
+    {
+        printf("bufstream: cannot create the streams\n");
+        return 1;
+    }
+    Node_Set(Mem,MEMSTREAM_DATA,Data,sizeof(Data));
+    Node_SET(Buf,BUFSTREAM_STREAM,&Mem);
+    Node_SET(Buf,BUFSTREAM_SIZE,&WindowSize);
+
+    // sequential small reads, mixed with seeks inside and outside the window
+    for (Pos=0, i=0; Pos + (filepos_t)sizeof(Read) < TEST_DATA_SIZE; ++i)
+    {
+        size_t Size = 1 + (i*37) % sizeof(Read);
+        if (Stream_Seek(Buf,Pos,SEEK_SET) != Pos)
+        {
+            printf("bufstream: seek to %d failed\n",(int)Pos);
+            Result = 1;
+            break;
+        }
+        if (Stream_Read(Buf,Read,Size,&Readed) != ERR_NONE || Readed != Size || memcmp(Read,Data+Pos,Size)!=0)
+        {
+            printf("bufstream: read of %d bytes at %d failed\n",(int)Size,(int)Pos);
+            Result = 1;
+            break;
+        }
+        if (Stream_Seek(Buf,0,SEEK_CUR) != Pos + (filepos_t)Size)
+        {
+            printf("bufstream: wrong position after read at %d\n",(int)Pos);
+            Result = 1;
+            break;
+        }
+        Pos += (i & 1) ? (filepos_t)Size/2 : (filepos_t)Size*3; // go back a little or skip ahead
+    }
+
+    // look at the data in place, across the window end
+    {
+        const uint8_t *Peeked;
+        Pos = 3*WindowSize - 100;
+        if (Stream_Seek(Buf,Pos,SEEK_SET) != Pos || Stream_Read(Buf,Read,1,&Readed) != ERR_NONE ||
+            Stream_Peek(Buf,&Peeked,5000) != ERR_NONE || memcmp(Peeked,Data+Pos+1,5000)!=0 ||
+            Stream_Seek(Buf,0,SEEK_CUR) != Pos+1 ||
+            Stream_Peek(Buf,&Peeked,WindowSize+1) != ERR_NOT_SUPPORTED)
+        {
+            printf("bufstream: peek at %d failed\n",(int)Pos+1);
+            Result = 1;
+        }
+    }
+
+    // end of the stream
+    if (Stream_Seek(Buf,-10,SEEK_END) != TEST_DATA_SIZE-10 ||
+        Stream_Read(Buf,Read,20,&Readed) != ERR_END_OF_FILE || Readed != 10 ||
+        memcmp(Read,Data+TEST_DATA_SIZE-10,10)!=0)
+    {
+        printf("bufstream: read at the end failed\n");
+        Result = 1;
+    }
+
+    NodeDelete((node*)Buf); // also deletes Mem
+    return Result;
+}
+
+static int test_mmapstream(nodecontext *Context, const char *Path)
+{
+    uint8_t Mapped[5000], Read[5000];
+    stream *Map, *File;
+    filepos_t Length, Pos;
+    size_t MapReaded, Readed;
+    int Result = 0;
+
+    Map = StreamOpen(Context,Path,SFLAG_RDONLY|SFLAG_MEMORY_MAP);
+    File = StreamOpen(Context,Path,SFLAG_RDONLY);
+    if (!Map || !File)
+    {
+        printf("mmapstream: cannot open %s\n",Path);
+        return 1;
+    }
+    if (!Node_IsPartOf(Map,MMAPSTREAM_CLASS))
+    {
+        printf("mmapstream: %s not mapped\n",Path);
+        Result = 1;
+    }
+    else if (Node_GET(Map,STREAM_LENGTH,&Length) != ERR_NONE || Length <= 0)
+    {
+        printf("mmapstream: invalid length\n");
+        Result = 1;
+    }
+    else
+    {
+        // read both streams backward and compare
+        for (Pos = Length - 1000; Pos > -5000; Pos -= 4000)
+        {
+            filepos_t SeekPos = Pos < 0 ? 0 : Pos;
+            if (Stream_Seek(Map,SeekPos,SEEK_SET) != SeekPos || Stream_Seek(File,SeekPos,SEEK_SET) != SeekPos)
+            {
+                printf("mmapstream: seek to %d failed\n",(int)SeekPos);
+                Result = 1;
+                break;
+            }
+            Stream_Read(Map,Mapped,sizeof(Mapped),&MapReaded);
+            Stream_Read(File,Read,sizeof(Read),&Readed);
+            if (MapReaded != Readed || memcmp(Mapped,Read,Readed)!=0)
+            {
+                printf("mmapstream: read at %d differs\n",(int)SeekPos);
+                Result = 1;
+                break;
+            }
+        }
+    }
+
+    StreamClose(Map);
+    StreamClose(File);
+    return Result;
+}
+
+static int test_wbufstream(nodecontext *Context, const char *Path)
+{
+    static uint8_t Data[TEST_DATA_SIZE], Written[TEST_DATA_SIZE];
+    stream *Out, *In;
+    size_t i, Readed, WindowSize = 128*1024;
+    filepos_t Pos;
+    int Result = 0;
+
+    for (i=0;i<TEST_DATA_SIZE;++i)
+        Data[i] = (uint8_t)(i*13 + (i>>9));
+
+    Out = StreamOpen(Context,Path,SFLAG_WRONLY|SFLAG_CREATE|SFLAG_BUFFERED);
+    if (!Out || !Node_IsPartOf(Out,WBUFSTREAM_CLASS))
+    {
+        printf("wbufstream: cannot open %s\n",Path);
+        if (Out)
+            StreamClose(Out);
+        return 1;
+    }
+    Node_SET(Out,WBUFSTREAM_SIZE,&WindowSize);
+
+    // zeroes first, patched below
+    memset(Written,0,sizeof(Written));
+    Stream_Write(Out,Written,1000,NULL);
+
+    // small writes, each one followed by a patch of its start like a CRC or a size
+    for (Pos=1000, i=0; Pos < TEST_DATA_SIZE/2; ++i)
+    {
+        size_t Size = 1 + (i*37) % 3000;
+        if (Pos + (filepos_t)Size > TEST_DATA_SIZE/2)
+            Size = (size_t)(TEST_DATA_SIZE/2 - Pos);
+        memset(Written,0xFF,Size);
+        Stream_Write(Out,Written,Size,NULL);
+        if (Stream_Seek(Out,Pos,SEEK_SET) != Pos || Stream_Write(Out,Data+Pos,Size/2,NULL) != ERR_NONE ||
+            Stream_Seek(Out,Size - Size/2,SEEK_CUR) != Pos + (filepos_t)Size ||
+            Stream_Seek(Out,Pos + Size/2,SEEK_SET) != Pos + (filepos_t)(Size/2) || Stream_Write(Out,Data+Pos+Size/2,Size - Size/2,NULL) != ERR_NONE)
+        {
+            printf("wbufstream: patch at %d failed\n",(int)Pos);
+            Result = 1;
+            break;
+        }
+        Pos += Size;
+    }
+
+    // one write larger than the window
+    Stream_Write(Out,Data+TEST_DATA_SIZE/2,TEST_DATA_SIZE/2,NULL);
+    if (Stream_Seek(Out,0,SEEK_CUR) != TEST_DATA_SIZE || Stream_Seek(Out,0,SEEK_END) != TEST_DATA_SIZE)
+    {
+        printf("wbufstream: wrong position after writing\n");
+        Result = 1;
+    }
+
+    // patch the start, long flushed
+    if (Stream_Seek(Out,0,SEEK_SET) != 0 || Stream_Write(Out,Data,1000,NULL) != ERR_NONE)
+    {
+        printf("wbufstream: patch at the start failed\n");
+        Result = 1;
+    }
+    StreamClose(Out);
+
+    In = StreamOpen(Context,Path,SFLAG_RDONLY);
+    if (!In)
+    {
+        printf("wbufstream: cannot read %s\n",Path);
+        return 1;
+    }
+    if (Stream_Read(In,Written,sizeof(Written),&Readed) != ERR_NONE || Readed != TEST_DATA_SIZE || memcmp(Written,Data,Readed)!=0 ||
+        Stream_Read(In,Written,1,&Readed) != ERR_END_OF_FILE)
+    {
+        printf("wbufstream: %s content differs\n",Path);
+        Result = 1;
+    }
+    StreamClose(In);
+    FileErase(Context,Path,1,0);
+    return Result;
+}
+
+// Output: 0 for a file, 1 for a write buffered file, 2 for a bufstream on a file that the kernel can't copy to
+static int test_copyto(nodecontext *Context, const char *Path, int Output)
+{
+    static uint8_t Data[TEST_DATA_SIZE], Written[TEST_DATA_SIZE];
+    stream *File, *Buf, *Out;
+    size_t i, Readed, WindowSize = 8192;
+    filepos_t Copied, Start = 5000, Size = 100000;
+    char OutPath[MAXPATH];
+    int Result = 0;
+
+    for (i=0;i<TEST_DATA_SIZE;++i)
+        Data[i] = (uint8_t)(i*11 + (i>>10));
+    stprintf_s(OutPath,TSIZEOF(OutPath),T("%s.out"),Path);
+
+    File = StreamOpen(Context,Path,SFLAG_WRONLY|SFLAG_CREATE);
+    if (!File || Stream_Write(File,Data,TEST_DATA_SIZE,NULL) != ERR_NONE)
+        Result = 1;
+    if (File)
+        StreamClose(File);
+    File = Result ? NULL : StreamOpen(Context,Path,SFLAG_RDONLY);
+    Buf = (stream*)NodeCreate(Context,BUFSTREAM_CLASS);
+    Out = StreamOpen(Context,OutPath,SFLAG_WRONLY|SFLAG_CREATE|(Output==1 ? SFLAG_BUFFERED : 0));
+    if (Output==2 && Out)
+    {
+        stream *OutFile = Out;
+        Out = (stream*)NodeCreate(Context,BUFSTREAM_CLASS);
+        if (Out)
+            Node_SET(Out,BUFSTREAM_STREAM,&OutFile);
+        else
+            StreamClose(OutFile);
+    }
+    if (!File || !Buf || !Out || Node_IsPartOf(Out,WBUFSTREAM_CLASS) != (Output==1))
+    {
+        printf("copyto %d: cannot open the streams\n",Output);
+        if (File) StreamClose(File);
+        if (Buf) NodeDelete((node*)Buf);
+        if (Out) StreamClose(Out);
+        FileErase(Context,Path,1,0);
+        FileErase(Context,OutPath,1,0);
+        return 1;
+    }
+    Node_SET(Buf,BUFSTREAM_STREAM,&File);
+    Node_SET(Buf,BUFSTREAM_SIZE,&WindowSize);
+
+    // start in the middle of the read window, after something was written in the output
+    Stream_Write(Out,Data,100,NULL);
+    if (Stream_Seek(Buf,Start,SEEK_SET) != Start || Stream_Read(Buf,Written,1000,&Readed) != ERR_NONE || Readed != 1000)
+    {
+        printf("copyto %d: read at %d failed\n",Output,(int)Start);
+        Result = 1;
+    }
+    else if (Stream_CopyTo(Buf,Out,Size,&Copied) != ERR_NONE || Copied != Size)
+    {
+        printf("copyto %d: copied %d bytes instead of %d\n",Output,(int)Copied,(int)Size);
+        Result = 1;
+    }
+    else if (Stream_Seek(Buf,0,SEEK_CUR) != Start+1000+Size || Stream_Seek(Out,0,SEEK_CUR) != 100+Size)
+    {
+        printf("copyto %d: positions %d and %d after the copy\n",Output,(int)Stream_Seek(Buf,0,SEEK_CUR),(int)Stream_Seek(Out,0,SEEK_CUR));
+        Result = 1;
+    }
+    // both streams go on from there
+    else if (Stream_Read(Buf,Written,1000,&Readed) != ERR_NONE || Readed != 1000 || memcmp(Written,Data+Start+1000+Size,1000)!=0 ||
+             Stream_Write(Out,Data,50,NULL) != ERR_NONE)
+    {
+        printf("copyto %d: reading or writing after the copy failed\n",Output);
+        Result = 1;
+    }
+    NodeDelete((node*)Buf); // also closes File
+    StreamClose(Out);
+
+    if (!Result)
+    {
+        Out = StreamOpen(Context,OutPath,SFLAG_RDONLY);
+        if (!Out || Stream_Read(Out,Written,sizeof(Written),&Readed) != ERR_END_OF_FILE || (filepos_t)Readed != 100+Size+50 ||
+            memcmp(Written,Data,100)!=0 || memcmp(Written+100,Data+Start+1000,(size_t)Size)!=0 || memcmp(Written+100+Size,Data,50)!=0)
+        {
+            printf("copyto %d: %s content differs\n",Output,OutPath);
+            Result = 1;
+        }
+        if (Out)
+            StreamClose(Out);
+    }
+    FileErase(Context,Path,1,0);
+    FileErase(Context,OutPath,1,0);
+    return Result;
+}
+
 int main(int argc,char** argv)
 {
+    int Result = 0;
     nodecontext Context;
     NodeContext_Init(&Context,NULL,NULL,NULL);
+    CoreC_FileInit(&Context.Base);
+
+    Result |= test_bufstream(&Context);
+#if !defined(TARGET_WIN)
+    Result |= test_mmapstream(&Context,argv[0]);
+    {
+        char Path[MAXPATH];
+        stprintf_s(Path,TSIZEOF(Path),T("%s.wbuf"),argv[0]);
+        Result |= test_wbufstream(&Context,Path);
+        stprintf_s(Path,TSIZEOF(Path),T("%s.copy"),argv[0]);
+        Result |= test_copyto(&Context,Path,0);
+        Result |= test_copyto(&Context,Path,1);
+        Result |= test_copyto(&Context,Path,2);
+    }
+#endif
 
     NodeContext_Done(&Context);
-    return 0;
+    return Result;
 }
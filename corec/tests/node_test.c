@@ -1,9 +1,67 @@
 #include "corec/node/node.h"
 
+#include <stdio.h>
+
+#define TREE_CHILDREN  100000
+
+static int check_tree(nodetree* Parent, size_t Count)
+{
+    nodetree *i, *Prev = NULL;
+    size_t n = 0;
+    for (i=NodeTree_Children(Parent);i;Prev=i,i=NodeTree_Next(i))
+    {
+        if (NodeTree_Parent(i) != Parent || NodeTree_Prev(i) != Prev)
+            break;
+        ++n;
+    }
+    if (i || n != Count || NodeTree_ChildCount(Parent) != Count || NodeTree_LastChild(Parent) != Prev)
+    {
+        printf("nodetree: inconsistent children list (%d/%d)\n",(int)n,(int)Count);
+        return 1;
+    }
+    return 0;
+}
+
+static int test_nodetree(nodecontext* Context)
+{
+    nodetree *Parent, *Child, *First, *Last;
+    int i, Result = 0;
+
+    Parent = (nodetree*)NodeCreate(Context,NODETREE_CLASS);
+    for (i=0;i<TREE_CHILDREN;++i)
+        NodeTree_CreateChild(Parent,NULL,NODETREE_CLASS,NULL); // must not be quadratic
+    Result |= check_tree(Parent,TREE_CHILDREN);
+
+    // insert at the front, then move the last one to the front
+    First = NodeTree_CreateChild(Parent,NULL,NODETREE_CLASS,NodeTree_Children(Parent));
+    Last = NodeTree_LastChild(Parent);
+    NodeTree_MoveBefore(Last,First);
+    Result |= check_tree(Parent,TREE_CHILDREN+1);
+    if (NodeTree_Children(Parent) != Last || NodeTree_Next(Last) != First)
+    {
+        printf("nodetree: wrong order after insertion\n");
+        Result = 1;
+    }
+
+    // remove every other child
+    for (Child=NodeTree_Children(Parent);Child;)
+    {
+        Child = NodeTree_DetachAndRelease(Child);
+        if (Child)
+            Child = NodeTree_Next(Child);
+    }
+    Result |= check_tree(Parent,(TREE_CHILDREN+1)/2);
+
+    NodeTree_Clear(Parent);
+    Result |= check_tree(Parent,0);
+    NodeDelete((node*)Parent);
+    return Result;
+}
+
 int main(int argc,char** argv)
 {
     node* p[10000];
-    int i;
+    int i, Result = 0;
     nodecontext Context;
     NodeContext_Init(&Context,NULL,NULL,NULL);
 
@@ -16,6 +74,8 @@ int main(int argc,char** argv)
     for (i=0;i<10000;++i)
         NodeDelete(p[i]);
 
+    Result |= test_nodetree(&Context);
+
     NodeContext_Done(&Context);
-    return 0;
+    return Result;
 }
@@ -38,6 +38,7 @@ extern "C" {
 #endif
 
 #define CONTEXT_LIBEBML_VERSION  0x400
+#define CONTEXT_SEMANTIC_INDEX   0x401 // pointer, lookup of the element IDs in the semantic tables of the context
 
 #define EBML_MAX_VERSION    1
 #define EBML_MAX_ID         4
@@ -46,6 +47,7 @@ extern "C" {
 #define SCOPE_PARTIAL_DATA  0  // read all data, except inside some binary elements (useful for binary data with a (internal) header)
 #define SCOPE_ALL_DATA      1
 #define SCOPE_NO_DATA       2
+#define SCOPE_SHALLOW_DATA  3  // like SCOPE_PARTIAL_DATA, but masters that support it only record the position of their bulk children
 
 #define EBML_ANY_PROFILE    0xFFFFFFFF
 
@@ -141,6 +143,8 @@ EBML_DLL err_t EBML_Init(parsercontext *p);
 EBML_DLL void EBML_Done(parsercontext *p);
 
 EBML_DLL ebml_element *EBML_ElementCreate(anynode *Any, const ebml_context *Context, bool_t SetDefault, int ForProfile, const void *Cookie);
+/// index the semantic tables reachable from this context to identify their elements faster in p, call it before parsing with p
+EBML_DLL void EBML_IndexContext(parsercontext *p, const ebml_context *Context);
 
 EBML_DLL ebml_element *EBML_FindNextId(stream *Input, const ebml_context *Context, size_t MaxDataSize);
 EBML_DLL ebml_element *EBML_FindNextElement(stream *Input, const ebml_parser_context *Context, int *UpperLevels, bool_t AllowDummy);
@@ -150,6 +154,8 @@ EBML_DLL uint8_t EBML_CodedValueLength(filepos_t Length, size_t CodedSize, uint8
 EBML_DLL uint8_t EBML_CodedValueLengthSigned(filepos_t Length, size_t CodedSize, uint8_t * OutBuffer); // TODO: turn into a macro ?
 EBML_DLL filepos_t EBML_ReadCodedSizeValue(const uint8_t *InBuffer, size_t *BufferSize, filepos_t *SizeUnknown);
 EBML_DLL filepos_t EBML_ReadCodedSizeSignedValue(const uint8_t *InBuffer, size_t *BufferSize, filepos_t *SizeUnknown);
+/// decode the ID and coded size at the start of Buffer, returns the size of the head or 0 if it's not complete or invalid
+EBML_DLL size_t EBML_DecodeHead(const uint8_t *Buffer, size_t BufferSize, fourcc_t *Id, uint8_t *IdLength, filepos_t *DataSize, uint8_t *SizeLength, bool_t *bSizeIsFinite);
 
 EBML_DLL void EBML_ElementGetName(const ebml_element *Element, tchar_t *Out, size_t OutLen);
 EBML_DLL const char *EBML_ElementGetClassName(const ebml_element *Element);
@@ -162,6 +168,7 @@ EBML_DLL void EBML_ElementSetInfiniteSize(const ebml_element *Element, bool_t Se
 EBML_DLL bool_t EBML_ElementIsDummy(const ebml_element *Element);
 
 EBML_DLL fourcc_t EBML_ElementClassID(const ebml_element *Element);
+EBML_DLL fourcc_t EBML_ContextClassID(const ebml_context *Context);
 EBML_DLL filepos_t EBML_ElementPosition(const ebml_element *Element);
 EBML_DLL filepos_t EBML_ElementPositionData(const ebml_element *Element);
 EBML_DLL filepos_t EBML_ElementPositionEnd(const ebml_element *Element);
@@ -200,6 +207,17 @@ EBML_DLL bool_t EBML_MasterCheckMandatory(const ebml_master *Element, bool_t bWi
 EBML_DLL void EBML_MasterSort(ebml_master *Element, arraycmp Cmp, const void* CmpParam);
 EBML_DLL bool_t EBML_MasterUseChecksum(ebml_master *Element, bool_t Use);
 EBML_DLL bool_t EBML_MasterIsChecksumValid(const ebml_master *Element);
+
+// CRC-32 of masters checked on worker threads (with CONFIG_MULTITHREAD), Threads=0 for one per CPU if there are several
+typedef struct ebml_crc_pool ebml_crc_pool;
+EBML_DLL ebml_crc_pool *EBML_CRCPoolCreate(size_t Threads);
+EBML_DLL void EBML_CRCPoolDelete(ebml_crc_pool *Pool);
+// the reads of Element checking its CRC hand it to the Pool, the checksum is considered valid until it's collected
+EBML_DLL void EBML_MasterDeferChecksum(ebml_master *Element, ebml_crc_pool *Pool);
+// the first master handed to the Pool not returned yet, with its checksum status set, or NULL if it's not checked yet (and !Wait) or there's none
+EBML_DLL ebml_master *EBML_CRCPoolCollect(ebml_crc_pool *Pool, bool_t Wait);
+// the Element is in a Pool and can't be deleted until it's collected
+EBML_DLL bool_t EBML_MasterIsChecksumPending(const ebml_master *Element);
 #define EBML_MasterGetChild(e,c,p) EBML_MasterFindFirstElt(e,c,1,1,p)
 #define EBML_MasterFindChild(e,c)  EBML_MasterFindFirstElt((ebml_master*)e,c,0,0,0)
 #define EBML_MasterNextChild(e,c)  EBML_MasterFindNextElt((ebml_master*)e,(ebml_element*)c,0,0,0)
@@ -69,7 +69,8 @@ struct ebml_element
 struct ebml_master
 {
     ebml_element Base;
-    int CheckSumStatus; // 0: not set, 1: requested/invalid, 2: verified
+    int CheckSumStatus; // 0: not set, 1: requested/invalid, 2: verified, 3: being verified
+    struct ebml_crc_pool *CRCPool; // checks the CRC of the reads when set
 
 };
 
@@ -29,8 +29,12 @@
 #ifndef __LIBEBML_CRC_H
 #define __LIBEBML_CRC_H
 
+/* update a CRC-32 IEEE value (without the initial/final inversion) with a buffer */
+extern uint32_t EBML_CRCUpdate(uint32_t CRC, const uint8_t *Buf, size_t Size);
 extern bool_t EBML_CRCMatches(ebml_crc *CRC, const uint8_t *Buf, size_t Size);
 extern void EBML_CRCAddBuffer(ebml_crc *CRC, const uint8_t *Buf, size_t Size);
 extern void EBML_CRCFinalize(ebml_crc *CRC);
+/* check the CRC of Data (taken over) on the Pool, the Element status is set when collected */
+extern void EBML_CRCPoolAdd(ebml_crc_pool *Pool, ebml_master *Element, const ebml_crc *CRC, array *Data);
 
 #endif /* __LIBEBML_CRC_H */
\ No newline at end of file
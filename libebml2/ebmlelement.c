@@ -174,6 +174,11 @@ fourcc_t EBML_ElementClassID(const ebml_element *Element)
     return Element->Context->Id;
 }
 
+fourcc_t EBML_ContextClassID(const ebml_context *Context)
+{
+    return Context->Id;
+}
+
 filepos_t EBML_ElementPosition(const ebml_element *Element)
 {
     return Element->ElementPosition;
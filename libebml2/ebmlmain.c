@@ -27,6 +27,9 @@
  */
 #include "ebml2/ebml.h"
 #include "internal.h"
+#include "ebmlcrc.h"
+
+static void SemanticIndexDone(parsercontext *p);
 
 err_t EBML_Init(parsercontext *p)
 {
@@ -41,11 +44,14 @@ err_t EBML_Init(parsercontext *p)
 	NodeRegisterClassEx(&p->Base.Base,EBMLCRC_Class);
 	NodeRegisterClassEx(&p->Base.Base,EBMLVoid_Class);
 
+    EBML_IndexContext(p,EBML_getContextHead());
+
     return ERR_NONE;
 }
 
 void EBML_Done(parsercontext *p)
 {
+    SemanticIndexDone(p);
 }
 
 static CONTEXT_CONST ebml_context EBML_ContextDummy = {0xFF, EBML_DUMMY_ID, 0, 0, "DummyElement", NULL, NULL};
@@ -134,43 +140,19 @@ const ebml_semantic *EBML_getSemanticGlobals()
 
 filepos_t EBML_ReadCodedSizeValue(const uint8_t *InBuffer, size_t *BufferSize, filepos_t *SizeUnknown)
 {
-	uint8_t SizeBitMask = 1 << 7;
-	filepos_t Result = 0x7F;
-	unsigned int SizeIdx, PossibleSizeLength = 0;
-	uint8_t PossibleSize[8];
-    unsigned int i;
-
-	*SizeUnknown = 0x7F; // the last bit is discarded when computing the size
-	for (SizeIdx = 0; SizeIdx < *BufferSize && SizeIdx < 8; SizeIdx++) {
-		if (InBuffer[0] & (SizeBitMask >> SizeIdx)) {
-			// ID found
-			PossibleSizeLength = SizeIdx + 1;
-			SizeBitMask >>= SizeIdx;
-			for (SizeIdx = 0; SizeIdx < PossibleSizeLength; SizeIdx++) {
-				PossibleSize[SizeIdx] = InBuffer[SizeIdx];
-			}
-			for (SizeIdx = 0; SizeIdx < PossibleSizeLength - 1; SizeIdx++) {
-				Result <<= 7;
-				Result |= 0xFF;
-			}
+    // the BufferSize may be larger than the actual buffer, only read the coded octets
+    size_t Length = *BufferSize ? EBML_VIntLength(InBuffer[0]) : 0;
 
-			Result = 0;
-			Result |= PossibleSize[0] & ~SizeBitMask;
-			for (i = 1; i<PossibleSizeLength; i++) {
-				Result <<= 8;
-				Result |= PossibleSize[i];
-			}
-
-			*BufferSize = PossibleSizeLength;
-
-			return Result;
-		}
-		*SizeUnknown <<= 7;
-		*SizeUnknown |= 0xFF;
-	}
+    if (Length == 0 || Length > *BufferSize)
+    {
+        *SizeUnknown = 0x7F;
+        *BufferSize = 0;
+        return 0;
+    }
 
-	*BufferSize = 0;
-	return 0;
+    *SizeUnknown = ((filepos_t)1 << (7*Length)) - 1;
+    *BufferSize = Length;
+    return (filepos_t)EBML_LoadBE(InBuffer, Length, Length) & *SizeUnknown;
 }
 
 filepos_t EBML_ReadCodedSizeSignedValue(const uint8_t *InBuffer, size_t *BufferSize, filepos_t *SizeUnknown)
@@ -215,6 +197,138 @@ static bool_t EBML_IdMatch(const uint8_t *PossibleId, int8_t IdLength, fourcc_t
     return ContextId == EBML_IdFromBuffer(PossibleId,IdLength);
 }
 
+/*
+ * Lookup of an ID in the semantic tables, one per parser context so parsers
+ * in other threads never see it change.
+ * The (table,ID) pairs of the tables reachable from an indexed context go in an
+ * open addressing hash table. An entry with the ID 0 (never a valid EBML ID)
+ * marks a table as indexed, so a miss doesn't need to scan it.
+ */
+#define SEMANTIC_INDEX_SIZE  2048 // power of 2
+
+typedef struct semantic_index
+{
+    const ebml_semantic *Table;
+    fourcc_t Id;
+    const ebml_semantic *Semantic;
+
+} semantic_index;
+
+typedef struct semantic_index_table
+{
+    size_t Count;
+    semantic_index Entry[SEMANTIC_INDEX_SIZE];
+
+} semantic_index_table;
+
+static INLINE size_t SemanticHash(const ebml_semantic *Table, fourcc_t Id)
+{
+    return (size_t)((((uintptr_t)Table >> 3) * 0x9E3779B1 + Id * 0x85EBCA6B) >> 7) & (SEMANTIC_INDEX_SIZE-1);
+}
+
+static const semantic_index *SemanticIndexFind(const semantic_index_table *Index, const ebml_semantic *Table, fourcc_t Id)
+{
+    size_t i;
+    if (!Index)
+        return NULL;
+    i = SemanticHash(Table,Id);
+    while (Index->Entry[i].Table)
+    {
+        if (Index->Entry[i].Table == Table && Index->Entry[i].Id == Id)
+            return &Index->Entry[i];
+        i = (i+1) & (SEMANTIC_INDEX_SIZE-1);
+    }
+    return NULL;
+}
+
+static bool_t SemanticIndexAdd(semantic_index_table *Index, const ebml_semantic *Table, fourcc_t Id, const ebml_semantic *Semantic)
+{
+    size_t i;
+    if (Index->Count >= SEMANTIC_INDEX_SIZE/2)
+        return 0; // keep the probing short, the other tables will be scanned
+    i = SemanticHash(Table,Id);
+    while (Index->Entry[i].Table)
+    {
+        if (Index->Entry[i].Table == Table && Index->Entry[i].Id == Id)
+            return 1; // keep the first one, like the table scan
+        i = (i+1) & (SEMANTIC_INDEX_SIZE-1);
+    }
+    Index->Entry[i].Table = Table;
+    Index->Entry[i].Id = Id;
+    Index->Entry[i].Semantic = Semantic;
+    ++Index->Count;
+    return 1;
+}
+
+static void IndexSemanticTable(semantic_index_table *Index, const ebml_semantic *Table)
+{
+    const ebml_semantic *Semantic;
+    if (!Table || SemanticIndexFind(Index,Table,0))
+        return; // already indexed
+
+    for (Semantic=Table;Semantic->eClass;Semantic++)
+        if (!SemanticIndexAdd(Index,Table,Semantic->eClass->Id,Semantic))
+            return;
+    // the table is complete in the index
+    if (!SemanticIndexAdd(Index,Table,0,NULL))
+        return;
+
+    for (Semantic=Table;Semantic->eClass;Semantic++)
+    {
+        IndexSemanticTable(Index,Semantic->eClass->Semantic);
+        IndexSemanticTable(Index,Semantic->eClass->GlobalContext);
+    }
+}
+
+static semantic_index_table *SemanticIndexGet(anynode *Any)
+{
+    semantic_index_table **Index = Node_GetData((node*)Node_Context(Any),CONTEXT_SEMANTIC_INDEX,TYPE_PTR);
+    return Index ? *Index : NULL;
+}
+
+static void SemanticIndexDone(parsercontext *p)
+{
+    semantic_index_table *Index = SemanticIndexGet(p);
+    if (Index)
+    {
+        Node_RemoveData((node*)p,CONTEXT_SEMANTIC_INDEX,TYPE_PTR);
+        free(Index);
+    }
+}
+
+void EBML_IndexContext(parsercontext *p, const ebml_context *Context)
+{
+    semantic_index_table *Index = SemanticIndexGet(p);
+    if (!Index)
+    {
+        Index = calloc(1,sizeof(*Index));
+        if (!Index)
+            return; // the tables will be scanned
+        if (!Node_AddData((node*)p,CONTEXT_SEMANTIC_INDEX,TYPE_PTR,&Index))
+        {
+            free(Index);
+            return;
+        }
+    }
+    IndexSemanticTable(Index,Context->Semantic);
+    IndexSemanticTable(Index,Context->GlobalContext);
+}
+
+static const ebml_semantic *EBML_SemanticFind(const semantic_index_table *SemanticIndex, const ebml_semantic *Table, fourcc_t Id)
+{
+    const semantic_index *Index = SemanticIndexFind(SemanticIndex,Table,Id);
+    const ebml_semantic *Semantic;
+    if (Index)
+        return Index->Semantic;
+    if (SemanticIndexFind(SemanticIndex,Table,0))
+        return NULL; // the table is indexed and doesn't contain this ID
+
+    for (Semantic=Table;Semantic->eClass;Semantic++)
+        if (Semantic->eClass->Id == Id)
+            return Semantic;
+    return NULL;
+}
+
 ebml_element *EBML_ElementCreate(anynode *Any, const ebml_context *Context, bool_t SetDefault, int ForProfile, const void *Cookie)
 {
     ebml_element *Result;
@@ -261,151 +375,129 @@ static ebml_element *CreateElement(anynode *Any, const uint8_t *PossibleId, int8
 }
 
 static ebml_element *EBML_ElementCreateUsingContext(void *AnyNode, const uint8_t *PossibleId, int8_t IdLength, const ebml_parser_context *Context,
-                                                    int *LowLevel, bool_t IsGlobalContext, bool_t bAllowDummy)
+                                                    int *LowLevel, bool_t bAllowDummy)
 {
-    int MaxLowerLevel=1; //TODO: remove ?
-//	unsigned int ContextIndex;
-	ebml_element *Result = NULL;
     const ebml_semantic *Semantic;
+    const semantic_index_table *Index = SemanticIndexGet(AnyNode);
+    fourcc_t Id = EBML_IdFromBuffer(PossibleId,IdLength);
+    int Level = *LowLevel;
 
-    if (!Context || !Context->Context || !Context->Context->Semantic)
-        return NULL;
-
-	// elements at the current level
-    for (Semantic=Context->Context->Semantic;Semantic->eClass;Semantic++)
+    for (;;)
     {
-        if (EBML_IdMatch(PossibleId, IdLength, Semantic->eClass->Id)) // && (bAllowDummy || bAllowOutOfProfile || !(Context->Profile & Semantic->DisabledProfile)))
+        if (!Context || !Context->Context || !Context->Context->Semantic)
+            return NULL;
+
+        // elements at the current level
+        Semantic = EBML_SemanticFind(Index, Context->Context->Semantic, Id);
+        if (Semantic) // && (bAllowDummy || bAllowOutOfProfile || !(Context->Profile & Semantic->DisabledProfile)))
         {
-            Result = EBML_ElementCreate(AnyNode,Semantic->eClass,0, Context->Profile, NULL);
-			return Result;
-		}
-	}
+            *LowLevel = Level;
+            return EBML_ElementCreate(AnyNode,Semantic->eClass,0, Context->Profile, NULL);
+        }
 
-	// global elements
-	assert(Context->Context->GlobalContext != NULL); // global should always exist, at least the EBML ones
-	if (Context->Context->GlobalContext == Context->Context->Semantic)
-		return NULL;
-    else
-    {
-        ebml_context ContextGlobals;
-        ebml_parser_context GlobalContext;
-
-        ContextGlobals.Semantic = Context->Context->GlobalContext;
-        ContextGlobals.GlobalContext = Context->Context->GlobalContext;
-
-        GlobalContext.Context = &ContextGlobals;
-        GlobalContext.UpContext = Context;
-        GlobalContext.EndPosition = INVALID_FILEPOS_T;
-        GlobalContext.Profile = Context->Profile;
-		(*LowLevel)--;
-		MaxLowerLevel--;
-		// recursive is good, but be carefull...
-        Result = EBML_ElementCreateUsingContext(AnyNode,PossibleId,IdLength,&GlobalContext,LowLevel,1,bAllowDummy);
-        if (Result)
-            return Result;
-		(*LowLevel)++;
-		MaxLowerLevel++;
-	}
+        // global elements
+        assert(Context->Context->GlobalContext != NULL); // global should always exist, at least the EBML ones
+        if (Context->Context->GlobalContext == Context->Context->Semantic)
+            return NULL;
+        Semantic = EBML_SemanticFind(Index, Context->Context->GlobalContext, Id);
+        if (Semantic)
+        {
+            *LowLevel = Level - 1;
+            return EBML_ElementCreate(AnyNode,Semantic->eClass,0, Context->Profile, NULL);
+        }
 
 #ifdef TODO
-	// parent elements
-	if (Context.MasterElt != NULL && aID == Context.MasterElt->GlobalId) {
-		(*LowLevel)++; // already one level up (same as context)
-		return &Context.MasterElt->Create();
-	}
+        // parent elements
+        if (Context.MasterElt != NULL && aID == Context.MasterElt->GlobalId) {
+            (*LowLevel)++; // already one level up (same as context)
+            return &Context.MasterElt->Create();
+        }
 #endif
 
-	// check wether it's not part of an upper context
-	if (Context->UpContext != NULL) {
-		(*LowLevel)++;
-		MaxLowerLevel++;
-		return EBML_ElementCreateUsingContext(AnyNode, PossibleId, IdLength, Context->UpContext, LowLevel, IsGlobalContext, bAllowDummy);
-	}
+        // check wether it's not part of an upper context
+        if (Context->UpContext == NULL)
+            break;
+        Context = Context->UpContext;
+        Level++;
+    }
 
     // dummy fallback
-	if (!IsGlobalContext && bAllowDummy && IdLength!=0) {
-		(*LowLevel) = 0;
-        Result = CreateElement(AnyNode,PossibleId,IdLength,Context->Context,NULL, Context->Profile);
-	}
+    if (bAllowDummy && IdLength!=0)
+    {
+        *LowLevel = 0;
+        return CreateElement(AnyNode,PossibleId,IdLength,Context->Context,NULL, Context->Profile);
+    }
+    *LowLevel = Level;
+    return NULL;
+}
 
-	return Result;
+size_t EBML_DecodeHead(const uint8_t *Buffer, size_t BufferSize, fourcc_t *Id, uint8_t *IdLength, filepos_t *DataSize, uint8_t *SizeLength, bool_t *bSizeIsFinite)
+{
+    size_t _IdLength, _SizeLength;
+    filepos_t SizeUnknown;
+    uint64_t Value;
+
+    if (BufferSize == 0)
+        return 0;
+    _IdLength = EBML_VIntLength(Buffer[0]);
+    if (_IdLength == 0 || _IdLength > EBML_MAX_ID || _IdLength >= BufferSize)
+        return 0;
+    _SizeLength = EBML_VIntLength(Buffer[_IdLength]);
+    if (_SizeLength == 0 || _IdLength + _SizeLength > BufferSize)
+        return 0;
+
+    SizeUnknown = ((filepos_t)1 << (7*_SizeLength)) - 1;
+    Value = EBML_LoadBE(Buffer + _IdLength, _SizeLength, BufferSize - _IdLength) & SizeUnknown;
+
+    if (Id)
+        *Id = (fourcc_t)EBML_LoadBE(Buffer, _IdLength, BufferSize);
+    if (IdLength)
+        *IdLength = (uint8_t)_IdLength;
+    if (DataSize)
+        *DataSize = (filepos_t)Value;
+    if (SizeLength)
+        *SizeLength = (uint8_t)_SizeLength;
+    if (bSizeIsFinite)
+        *bSizeIsFinite = (filepos_t)Value != SizeUnknown;
+    return _IdLength + _SizeLength;
 }
 
 ebml_element *EBML_FindNextId(stream *Input, const ebml_context *Context, size_t MaxDataSize)
 {
-    filepos_t aElementPosition, aSizePosition;
-    filepos_t SizeFound=0, SizeUnknown=8;
-    int ReadSize;
-    uint8_t BitMask;
-    uint8_t PossibleId[4];
-    uint8_t PossibleSize[8]; // we don't support size stored in more than 64 bits
-    bool_t bElementFound = 0;
-    int8_t PossibleID_Length = 0;
-    size_t _SizeLength=0;
-    uint8_t PossibleSizeLength = 0;
+    filepos_t aElementPosition;
+    filepos_t SizeFound;
+    uint8_t Head[EBML_MAX_HEAD];
+    uint8_t IdLength, SizeLength;
+    size_t HeadSize;
+    bool_t bSizeIsFinite;
     ebml_element *Result = NULL;
 
-    while (!bElementFound)
-    {
-        aElementPosition = Stream_Seek(Input,0,SEEK_CUR);
-        ReadSize = 0;
-        BitMask = 1 << 7;
-        for (;;)
-        {
-            if (Stream_ReadOneOrMore(Input,&PossibleId[PossibleID_Length], 1, NULL)!=ERR_NONE)
-                break;
-            ReadSize++;
-            if (ReadSize == PossibleID_Length)
-                return NULL; // No more data ?
-			if (++PossibleID_Length > 4)
-				return NULL; // we don't support element IDs over class D
-            if (PossibleId[0] & BitMask)
-            {
-                bElementFound = 1;
-                break;
-            }
-            BitMask >>= 1;
-        }
+    aElementPosition = Stream_Seek(Input,0,SEEK_CUR);
+    if (aElementPosition == INVALID_FILEPOS_T)
+        return NULL;
 
-	    // read the data size
-	    aSizePosition = Stream_Seek(Input,0,SEEK_CUR);
-	    do {
-		    if (PossibleSizeLength >= 8)
-			    // Size is larger than 8 bytes
-			    return NULL;
-
-            if (Stream_ReadOneOrMore(Input,&PossibleSize[PossibleSizeLength++], 1, NULL)!=ERR_NONE)
-                break;
-		    ReadSize++;
-		    _SizeLength = PossibleSizeLength;
-		    SizeFound = EBML_ReadCodedSizeValue(&PossibleSize[0], &_SizeLength, &SizeUnknown);
-	    } while (_SizeLength == 0);
-    }
+    // read the maximum possible head at once and decode it in memory
+    Stream_Read(Input,Head,sizeof(Head),&HeadSize);
+    HeadSize = EBML_DecodeHead(Head,HeadSize,NULL,&IdLength,&SizeFound,&SizeLength,&bSizeIsFinite);
+    if (HeadSize == 0)
+        return NULL;
 
     // look for the ID in the provided context
-    Result = CreateElement(Input, PossibleId, PossibleID_Length, Context,NULL, EBML_ANY_PROFILE);
+    Result = CreateElement(Input, Head, IdLength, Context,NULL, EBML_ANY_PROFILE);
     assert(Result != NULL);
-#if 0
-if (PossibleID_Length==4)
-printf("Elt: size %d id %d %02X%02X%02X%02X\n",SizeFound,PossibleID_Length,PossibleId[0],PossibleId[1],PossibleId[2],PossibleId[3]);
-else if (PossibleID_Length==3)
-printf("Elt: size %d id %d %02X%02X%02X\n",SizeFound,PossibleID_Length,PossibleId[0],PossibleId[1],PossibleId[2]);
-else if (PossibleID_Length==2)
-printf("Elt: size %d id %d %02X%02X\n",SizeFound,PossibleID_Length,PossibleId[0],PossibleId[1]);
-else if (PossibleID_Length==1)
-printf("Elt: size %d id %d %02X\n",SizeFound,PossibleID_Length,PossibleId[0]);
-#endif
-	Result->SizeLength = PossibleSizeLength;
+	Result->SizeLength = SizeLength;
 	Result->DataSize = SizeFound;
-    if (!EBML_ElementValidateSize(Result) || (SizeFound != SizeUnknown && MaxDataSize < (size_t)Result->DataSize))
+    if (!EBML_ElementValidateSize(Result) || (bSizeIsFinite && MaxDataSize < (size_t)Result->DataSize))
     {
         NodeDelete((node*)Result);
         return NULL;
     }
     Result->ElementPosition = aElementPosition;
-    Result->SizePosition = aSizePosition;
-    Result->EndPosition = aSizePosition + _SizeLength + SizeFound;
+    Result->SizePosition = aElementPosition + IdLength;
+    Result->EndPosition = aElementPosition + HeadSize + SizeFound;
 
+    // place the file at the beginning of the data
+    Stream_Seek(Input,Result->EndPosition - SizeFound,SEEK_SET);
     return Result;
 }
 
@@ -502,16 +594,14 @@ uint8_t EBML_CodedValueLengthSigned(filepos_t Length, size_t CodedSize, uint8_t
 
 ebml_element *EBML_FindNextElement(stream *Input, const ebml_parser_context *pContext, int *UpperLevels, bool_t AllowDummyElt)
 {
-	uint8_t PossibleID_Length = 0;
-	uint8_t PossibleIdNSize[16];
-	int PossibleSizeLength;
-	filepos_t SizeUnknown;
-	int8_t SizeIdx,ReadIndex = 0; // trick for the algo, start index at 0
-	uint32_t ReadSize = 0;
+	uint8_t Window[EBML_MAX_HEAD]; // the possible head of the element, read once and decoded in memory
+	size_t WindowSize = 0;
+	filepos_t WindowPos;
+	uint8_t IdLength, SizeLength;
 	filepos_t SizeFound;
-	bool_t bFound;
+	bool_t bFound, bSizeIsFinite, bEndOfData = 0;
 	int UpperLevel_original = *UpperLevels;
-    filepos_t CurrentPos;
+    filepos_t ElementPos, CurrentPos;
     filepos_t StartPos = Stream_Seek(Input,0,SEEK_CUR);
 	ebml_parser_context OrigContext;
 	const ebml_parser_context *Context = &OrigContext;
@@ -531,75 +621,63 @@ ebml_element *EBML_FindNextElement(stream *Input, const ebml_parser_context *pCo
         (*UpperLevels)++;
     }
 
-    do {
-		size_t _SizeLength;
-
-		// read a potential ID
-		do {
-			uint8_t IdBitMask = 1 << 7;
-
-            assert(ReadIndex < 16);
-			// build the ID with the current Read Buffer
-			bFound = 0;
-			for (SizeIdx = 0; SizeIdx < ReadIndex && SizeIdx < 4; SizeIdx++) {
-				if (PossibleIdNSize[0] & (IdBitMask >> SizeIdx)) {
-					// ID found
-					PossibleID_Length = SizeIdx + 1;
-					IdBitMask >>= SizeIdx;
-					bFound = 1;
-					break;
-				}
-			}
-			if (bFound)
-				break;
-            if (Context->EndPosition == StartPos+ReadSize)
-                break; // we should not read further than our limit
-
-			if (ReadIndex >= 4) {
-				// ID not found
-				// shift left the read octets
-				memmove(&PossibleIdNSize[0],&PossibleIdNSize[1], --ReadIndex);
-			}
-
-            if (Stream_ReadOneOrMore(Input,&PossibleIdNSize[ReadIndex++], 1, NULL)!=ERR_NONE)
-				return NULL; // no more data ?
-			ReadSize++;
+    WindowPos = ElementPos = StartPos;
+    for (;;)
+    {
+        size_t Avail;
+        bool_t bLimited = 0;
 
-        } while (!bFound);
+        // keep a whole possible head in the window
+        if (ElementPos != WindowPos)
+        {
+            size_t Skip = (size_t)(ElementPos - WindowPos);
+            assert(Skip <= WindowSize);
+            WindowSize -= Skip;
+            memmove(Window, Window + Skip, WindowSize);
+            WindowPos = ElementPos;
+        }
+        if (WindowSize < sizeof(Window) && !bEndOfData)
+        {
+            size_t Readed;
+            if (Stream_Read(Input, Window + WindowSize, sizeof(Window) - WindowSize, &Readed) != ERR_NONE)
+                bEndOfData = 1;
+            WindowSize += Readed;
+        }
 
-		SizeIdx = ReadIndex;
-		ReadIndex = ReadIndex - PossibleID_Length;
+        // we should not read further than our limit
+        Avail = WindowSize;
+        if (Context->EndPosition != INVALID_FILEPOS_T && Context->EndPosition >= ElementPos && Context->EndPosition - ElementPos < (filepos_t)Avail)
+        {
+            Avail = (size_t)(Context->EndPosition - ElementPos);
+            bLimited = 1;
+        }
 
-		// read the data size
-		PossibleSizeLength = ReadIndex;
-        bFound = 0;
-		while (1)
-		{
-			_SizeLength = PossibleSizeLength;
-			SizeFound = EBML_ReadCodedSizeValue(&PossibleIdNSize[PossibleID_Length], &_SizeLength, &SizeUnknown);
-			if (_SizeLength != 0) {
-				bFound = 1;
-				break;
-			}
-			if (PossibleSizeLength >= 8)
-				break;
-            if (PossibleSizeLength > 0 && PossibleIdNSize[PossibleID_Length] == 0)
-                break; // invalid all zero size
-            if (Context->EndPosition == StartPos+ReadSize)
-                break; // we should not read further than our limit
-            if (Stream_ReadOneOrMore(Input,&PossibleIdNSize[SizeIdx++], 1, NULL)!=ERR_NONE)
+        CurrentPos = ElementPos + EBML_DecodeHead(Window, Avail, NULL, &IdLength, &SizeFound, &SizeLength, &bSizeIsFinite);
+        bFound = (CurrentPos != ElementPos);
+        if (!bFound)
+        {
+            IdLength = Avail ? (uint8_t)EBML_VIntLength(Window[0]) : 0;
+            if (Avail && (IdLength == 0 || IdLength > EBML_MAX_ID))
+            {
+                // not an ID, try at the next octet
+                ElementPos++;
+                continue;
+            }
+            if (Avail <= IdLength || Window[IdLength] != 0)
+            {
+                // the head is cut by the end of the data or our limit
+                if (bLimited)
+                    Stream_Seek(Input, ElementPos + Avail, SEEK_SET);
                 return NULL;
-			ReadSize++;
-			PossibleSizeLength++;
-		}
-
-        CurrentPos = Stream_Seek(Input,0,SEEK_CUR);
-		if (bFound)
+            }
+            CurrentPos = ElementPos + IdLength + 1; // invalid all zero size
+        }
+		else
         {
             // make sure the element we found is contained in the Context
-            if (SizeFound != SizeUnknown)
+            if (bSizeIsFinite)
             {
-                while (Context && Context->EndPosition != INVALID_FILEPOS_T && (CurrentPos + SizeFound - SizeIdx > Context->EndPosition))
+                while (Context && Context->EndPosition != INVALID_FILEPOS_T && (ElementPos + SizeFound > Context->EndPosition))
                 {
                     if (AllowDummyElt || Context->UpContext==NULL)
                     {
@@ -616,25 +694,24 @@ ebml_element *EBML_FindNextElement(stream *Input, const ebml_parser_context *pCo
         {
 			// find the element in the context and use the correct creator
             int LevelChange = 0;
-			ebml_element *Result = EBML_ElementCreateUsingContext(Input, PossibleIdNSize, PossibleID_Length, Context, &LevelChange, 0, AllowDummyElt);
+			ebml_element *Result = EBML_ElementCreateUsingContext(Input, Window, IdLength, Context, &LevelChange, AllowDummyElt);
 			if (Result != NULL)
             {
 				if (AllowDummyElt || !EBML_ElementIsDummy(Result)) {
-                    assert(_SizeLength <= 8);
-                    Result->SizeLength = (int8_t)_SizeLength;
+                    Result->SizeLength = (int8_t)SizeLength;
 					Result->DataSize = SizeFound;
-                    Result->EndPosition = (SizeFound == SizeUnknown) ? Context->EndPosition : CurrentPos - SizeIdx + PossibleID_Length + _SizeLength + SizeFound;
-                    EBML_ElementSetInfiniteSize(Result, SizeFound == SizeUnknown);
+                    Result->EndPosition = !bSizeIsFinite ? Context->EndPosition : CurrentPos + SizeFound;
+                    EBML_ElementSetInfiniteSize(Result, !bSizeIsFinite);
 
 					if (AllowDummyElt && !EBML_ElementValidateSize(Result) && !EBML_ElementIsDummy(Result))
 					{
 						// the element has a good ID but wrong size, so replace with a dummy
 						NodeDelete((node*)Result);
-						Result = CreateElement(Input, PossibleIdNSize, PossibleID_Length, &EBML_ContextDummy, NULL, EBML_ANY_PROFILE);
-						Result->SizeLength = (int8_t)_SizeLength;
+						Result = CreateElement(Input, Window, IdLength, &EBML_ContextDummy, NULL, EBML_ANY_PROFILE);
+						Result->SizeLength = (int8_t)SizeLength;
 						Result->DataSize = SizeFound;
-                        Result->EndPosition = (SizeFound == SizeUnknown) ? Context->EndPosition : CurrentPos - SizeIdx + PossibleID_Length + _SizeLength + SizeFound;
-                        EBML_ElementSetInfiniteSize(Result, SizeFound == SizeUnknown);
+                        Result->EndPosition = !bSizeIsFinite ? Context->EndPosition : CurrentPos + SizeFound;
+                        EBML_ElementSetInfiniteSize(Result, !bSizeIsFinite);
 					}
 
 					// LevelChange values
@@ -644,17 +721,17 @@ ebml_element *EBML_FindNextElement(stream *Input, const ebml_parser_context *pCo
 					//  + : further parent
 					if (EBML_ElementValidateSize(Result))
                     {
-						if (SizeFound == SizeUnknown)
+						if (!bSizeIsFinite)
                         {
                             Result->DataSize = INVALID_FILEPOS_T;
                         }
 
                         if (LevelChange > 0)
                             *UpperLevels += LevelChange;
-						Result->SizePosition = CurrentPos - SizeIdx + PossibleID_Length;
-						Result->ElementPosition = Result->SizePosition - PossibleID_Length;
+						Result->SizePosition = ElementPos + IdLength;
+						Result->ElementPosition = ElementPos;
 						// place the file at the beggining of the data
-						Stream_Seek(Input,Result->SizePosition + _SizeLength,SEEK_SET);
+						Stream_Seek(Input,CurrentPos,SEEK_SET);
 						return Result;
 					}
 				}
@@ -667,14 +744,11 @@ ebml_element *EBML_FindNextElement(stream *Input, const ebml_parser_context *pCo
             if (AllowDummyElt && Context->EndPosition != CurrentPos)
             {
                 /* add a dummy placeholder for the remaining of the parent */
-                int LevelChange = 0;
-                ebml_element *Result = CreateElement(Input, PossibleIdNSize, PossibleID_Length, &EBML_ContextDummy, NULL, EBML_ANY_PROFILE);
+                ebml_element *Result = CreateElement(Input, Window, IdLength, &EBML_ContextDummy, NULL, EBML_ANY_PROFILE);
 			    if (Result != NULL)
                 {
-                    if (LevelChange > 0)
-                        *UpperLevels += LevelChange;
-				    Result->SizePosition = CurrentPos - SizeIdx + PossibleID_Length;
-				    Result->ElementPosition = Result->SizePosition - PossibleID_Length;
+				    Result->SizePosition = ElementPos + IdLength;
+				    Result->ElementPosition = ElementPos;
 				    Result->DataSize = 0;
                     Result->SizeLength = (int8_t)(Context->EndPosition - Result->SizePosition);
                     Result->EndPosition = Context->EndPosition;
@@ -686,13 +760,15 @@ ebml_element *EBML_FindNextElement(stream *Input, const ebml_parser_context *pCo
             break; // we should not read further than our limit
         }
 
-		// recover all the data in the buffer minus one byte
-		ReadIndex = SizeIdx - 1;
-		memmove(&PossibleIdNSize[0], &PossibleIdNSize[1], ReadIndex);
+		// try again one octet further
 		*UpperLevels = UpperLevel_original;
 		OrigContext = *pContext;
 		Context = &OrigContext;
-    } while (Context->EndPosition==INVALID_FILEPOS_T || (Context->EndPosition > CurrentPos - SizeIdx + PossibleID_Length));
+        if (Context->EndPosition!=INVALID_FILEPOS_T && Context->EndPosition <= ElementPos + IdLength)
+            break;
+        ElementPos++;
+    }
 
+    Stream_Seek(Input,CurrentPos,SEEK_SET);
 	return NULL;
 }
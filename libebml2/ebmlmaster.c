@@ -123,11 +123,7 @@ err_t EBML_MasterRemove(ebml_master *Element, ebml_element *Append)
 
 size_t EBML_MasterCount(const ebml_master *Element)
 {
-    size_t Result = 0;
-    ebml_element *i;
-    for (i=EBML_MasterChildren(Element);i;i=EBML_MasterNext(i))
-        ++Result;
-    return Result;
+    return NodeTree_ChildCount(Element);
 }
 
 static int EbmlCmp(const ebml_element* Element, const ebml_element** a,const ebml_element** b)
@@ -338,15 +334,25 @@ static err_t ReadData(ebml_master *Element, stream *Input, const ebml_parser_con
                     {
                         if (EBML_ElementIsFiniteSize((ebml_element*)Element))
                         {
-                            if (Node_IsPartOf(Input, MEMSTREAM_CLASS))
+                            filepos_t DataPos, OffSet;
+                            size_t MemSize;
+                            const uint8_t *MemData;
+                            CRCDataSize = (size_t)(EBML_ElementDataSize((ebml_element*)Element,1) - EBML_ElementFullSize(SubElement,1));
+                            if (Node_IsPartOf(Input, MEMSTREAM_CLASS) &&
+                                (DataPos = Stream_Seek(Input,EBML_ElementPositionEnd(SubElement),SEEK_SET)) != INVALID_FILEPOS_T &&
+                                Node_GET(Input,MEMSTREAM_OFFSET,&OffSet) == ERR_NONE &&
+                                Node_GET(Input,MEMSTREAM_SIZE,&MemSize) == ERR_NONE &&
+                                Node_GET(Input,MEMSTREAM_PTR,&MemData) == ERR_NONE && MemData &&
+                                DataPos >= OffSet && DataPos - OffSet + CRCDataSize <= MemSize)
                             {
-                                filepos_t DataPos = Stream_Seek(Input,EBML_ElementPositionEnd(SubElement),SEEK_SET);
-                                filepos_t OffSet;
-                                Node_GET(Input,MEMSTREAM_OFFSET,&OffSet);
-                                Node_GET(Input,MEMSTREAM_PTR,&CRCData);
-                                CRCData += (DataPos - OffSet);
-                                CRCDataSize = (size_t)(EBML_ElementDataSize((ebml_element*)Element,1) - EBML_ElementFullSize(SubElement,1));
-                                Stream_Read(Input, CRCData, CRCDataSize, NULL);
+                                // the data are already in memory (memory stream or mapped file), use them before
+                                // reading the children, a mapped window may move meanwhile
+                                const uint8_t *InPlace = MemData + (size_t)(DataPos - OffSet);
+                                ArrayInit(&CrcBuffer);
+                                if (Element->CRCPool && ArrayAppend(&CrcBuffer,InPlace,CRCDataSize,0))
+                                    CRCData = ARRAYBEGIN(CrcBuffer,uint8_t); // the pool needs its own copy
+                                else
+                                    Element->CheckSumStatus = EBML_CRCMatches((ebml_crc*)SubElement, InPlace, CRCDataSize)?2:1;
                             }
                             else
                             {
@@ -362,6 +368,7 @@ static err_t ReadData(ebml_master *Element, stream *Input, const ebml_parser_con
                                     {
                                         ReadStream=Input; // revert back to normal reading
                                         ArrayClear(&CrcBuffer);
+                                        CRCData = NULL;
                                     }
                                     else
                                     {
@@ -373,6 +380,8 @@ static err_t ReadData(ebml_master *Element, stream *Input, const ebml_parser_con
                                         {
                                             ReadStream=Input; // revert back to normal reading
                                             ArrayClear(&CrcBuffer);
+                                            CRCData = NULL;
+                                            Element->CheckSumStatus = 1; // data cut by the end of the stream can't match
                                         }
                                     }
                                 }
@@ -418,12 +427,14 @@ static err_t ReadData(ebml_master *Element, stream *Input, const ebml_parser_con
 processCrc:
     if (CRCData!=NULL)
     {
-        Element->CheckSumStatus = EBML_CRCMatches(CRCElement, CRCData, CRCDataSize)?2:1;
-        if (CRCData == ARRAYBEGIN(CrcBuffer,uint8_t))
-        {
+        // the data are in CrcBuffer, the memory stream reading them goes first
+        if (ReadStream != Input)
             StreamClose(ReadStream);
-            ArrayClear(&CrcBuffer);
-        }
+        if (Element->CRCPool)
+            EBML_CRCPoolAdd(Element->CRCPool, Element, CRCElement, &CrcBuffer);
+        else
+            Element->CheckSumStatus = EBML_CRCMatches(CRCElement, CRCData, CRCDataSize)?2:1;
+        ArrayClear(&CrcBuffer);
     }
 
     Element->Base.bValueIsSet = 1;
@@ -37,6 +37,42 @@ extern "C" {
 
 INTERNAL_C_API size_t GetIdLength(fourcc_t Id);
 
+#define EBML_MAX_HEAD   (EBML_MAX_ID + EBML_MAX_SIZE)
+
+/// number of octets used by a coded value starting with this octet, 0 if the octet is invalid
+static INLINE size_t EBML_VIntLength(uint8_t First)
+{
+#if defined(__GNUC__)
+    return First ? (size_t)__builtin_clz((unsigned int)First) - (sizeof(unsigned int)*8 - 8) + 1 : 0;
+#else
+    size_t Length = 1;
+    if (!First)
+        return 0;
+    while (!(First & 0x80))
+    {
+        First <<= 1;
+        ++Length;
+    }
+    return Length;
+#endif
+}
+
+/// big-endian value of Length octets (1 to 8), Available is the number of readable octets at Buffer
+static INLINE uint64_t EBML_LoadBE(const uint8_t *Buffer, size_t Length, size_t Available)
+{
+    uint64_t Value;
+#if defined(__GNUC__) && defined(IS_LITTLE_ENDIAN)
+    if (Available >= 8)
+    {
+        memcpy(&Value, Buffer, 8); // unaligned load
+        return __builtin_bswap64(Value) >> ((8 - Length) << 3);
+    }
+#endif
+    for (Value=0;Length;--Length)
+        Value = (Value << 8) | *Buffer++;
+    return Value;
+}
+
 extern const nodemeta EBMLElement_Class[];
 extern const nodemeta EBMLMaster_Class[];
 extern const nodemeta EBMLBinary_Class[];
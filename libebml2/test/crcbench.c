@@ -0,0 +1,95 @@
+/*
+ * $Id$
+ * Copyright (c) 2008-2010, Matroska Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Matroska assocation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY the Matroska association ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL The Matroska Foundation BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <time.h>
+
+#include "ebml2/ebml.h"
+#include "ebmlcrc.h"
+
+#define BENCH_SIZE    (16*1024*1024)
+#define BENCH_LOOPS   16
+#define CHECK_SIZE    (64*1024)
+
+static uint32_t BitwiseCRC(uint32_t CRC, const uint8_t *Buf, size_t Size)
+{
+    int i;
+    while (Size--)
+    {
+        CRC ^= *Buf++;
+        for (i=0;i<8;++i)
+            CRC = (CRC >> 1) ^ (0xEDB88320 & (0-(CRC & 1)));
+    }
+    return CRC;
+}
+
+int main(void)
+{
+    parsercontext p;
+    uint8_t *Buf;
+    size_t i, Offset;
+    uint32_t CRC = 0;
+    clock_t Start;
+    double Seconds;
+    int Result = 0;
+
+    ParserContext_InitEx(&p,NULL,NULL,NULL,NODECONTEXT_SINGLE_THREAD);
+    EBML_Init(&p);
+
+    Buf = malloc(BENCH_SIZE+8);
+    if (!Buf)
+        return 1;
+    for (i=0;i<BENCH_SIZE+8;++i)
+        Buf[i] = (uint8_t)(i*31 + (i>>9));
+
+    // check the result against the reference for all alignments and small sizes
+    for (Offset=0;Offset<8;++Offset)
+        for (i=0;i<CHECK_SIZE;i = i*2+1)
+            if (EBML_CRCUpdate(0xFFFFFFFF,Buf+Offset,i) != BitwiseCRC(0xFFFFFFFF,Buf+Offset,i))
+            {
+                fprintf(stderr,"CRC mismatch for %d bytes at offset %d\r\n",(int)i,(int)Offset);
+                Result = 1;
+            }
+    if (EBML_CRCUpdate(0xFFFFFFFF,(const uint8_t*)"123456789",9) != ~0xCBF43926U)
+    {
+        fprintf(stderr,"CRC mismatch for the check value\r\n");
+        Result = 1;
+    }
+
+    Start = clock();
+    for (i=0;i<BENCH_LOOPS;++i)
+        CRC = EBML_CRCUpdate(CRC,Buf+(i&7),BENCH_SIZE);
+    Seconds = (double)(clock() - Start) / CLOCKS_PER_SEC;
+    if (Seconds > 0)
+        fprintf(stdout,"CRC-32: %.0f MB/s (%08X)\r\n",(double)BENCH_SIZE*BENCH_LOOPS/(1024*1024)/Seconds,CRC);
+
+    free(Buf);
+    EBML_Done(&p);
+    ParserContext_Done(&p);
+    return Result;
+}
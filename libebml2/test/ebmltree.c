@@ -181,7 +181,7 @@ int main(int argc, const char *argv[])
     }
 
     // Core-C init phase
-    ParserContext_Init(&p,NULL,NULL,NULL);
+    ParserContext_InitEx(&p,NULL,NULL,NULL,NODECONTEXT_SINGLE_THREAD);
     // EBML Init
     EBML_Init(&p);
 
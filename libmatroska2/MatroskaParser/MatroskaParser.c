@@ -52,6 +52,7 @@ struct MatroskaFile
 	ebml_element *SegmentInfo;
 	ebml_element *TrackList;
 	ebml_element *CueList;
+	array CueIndex; // matroska_cue_index
 	SegmentInfo Seg;
 
 	ebml_parser_context L0Context;
@@ -1172,6 +1173,7 @@ MatroskaFile *mkv_Open(InputStream *io, char *err_msg, size_t err_msgSize)
 		}
 
 		MATROSKA_CuesSort(File->CueList);
+		MATROSKA_CuesBuildIndex((ebml_master*)File->CueList, &File->CueIndex);
 	}
 
 	return File;
@@ -1246,6 +1248,7 @@ void mkv_Close(MatroskaFile *File)
 	if (File->Seg.WritingApp) Input->io->memfree(Input->io, File->Seg.WritingApp);
 
 	ArrayClear(&File->Tracks);
+	ArrayClear(&File->CueIndex);
     releaseAttachments(&File->Attachments, File);
 	releaseChapters(&File->Chapters, File);
 	releaseTags(&File->Tags, File);
@@ -1464,8 +1467,7 @@ static void SeekToPos(MatroskaFile *File, filepos_t SeekPos)
 
 void mkv_Seek(MatroskaFile *File, mkv_timestamp_t timestamp, int flags)
 {
-	matroska_cuepoint *CuePoint;
-	filepos_t SeekPos;
+	const matroska_cue_index *Cue;
 
 	if (File->flags & MKVF_AVOID_SEEKS || File->pFirstCluster==INVALID_FILEPOS_T || timestamp==INVALID_TIMESTAMP_T)
 		return;
@@ -1478,12 +1480,11 @@ void mkv_Seek(MatroskaFile *File, mkv_timestamp_t timestamp, int flags)
 	if (!File->CueList)
 		return;
 
-	CuePoint = MATROSKA_CuesGetTimestampStart(File->CueList,timestamp);
-	if (CuePoint==NULL)
+	Cue = MATROSKA_CuesIndexGetTimestampStart(&File->CueIndex,timestamp);
+	if (Cue==NULL)
 		return;
 
-	SeekPos = MATROSKA_CuePosInSegment(CuePoint) + EBML_ElementPositionData(File->Segment);
-	SeekToPos(File, SeekPos);
+	SeekToPos(File, Cue->ClusterPosition + EBML_ElementPositionData(File->Segment));
 }
 
 int mkv_TruncFloat(float f)
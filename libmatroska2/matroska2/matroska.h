@@ -77,11 +77,48 @@ typedef struct matroska_frame
 
 } matroska_frame;
 
+typedef struct matroska_frame_view
+{
+    const uint8_t *Head; // header stripped from the track frames, or NULL
+    uint32_t HeadSize;
+    const uint8_t *Data; // the rest of the frame, only valid during the visitor call
+    uint32_t Size;
+    mkv_timestamp_t Timestamp;
+    mkv_timestamp_t Duration;
+
+} matroska_frame_view;
+
+typedef err_t (*matroska_frame_visitor)(void *Cookie, size_t FrameNum, const matroska_frame_view *Frame);
+
+// TrackEntry using a track number and its values needed for each Block
+typedef struct matroska_track_info
+{
+    ebml_master *TrackEntry; // NULL if no TrackEntry uses the number
+    ebml_string *CodecID; // NULL if not set
+    int TrackType; // 0 if not set
+    bool_t Lacing;
+    int EncodingScope; // ContentEncodingScope, 0 if the track has no ContentEncoding
+    mkv_timestamp_t DefaultDuration; // INVALID_TIMESTAMP_T if not set
+
+} matroska_track_info;
+
+// TrackEntries of a Tracks element indexed by TrackNumber, to build again when the Tracks change
+typedef struct matroska_track_map
+{
+    array Tracks; // matroska_track_info
+
+} matroska_track_map;
+
 MATROSKA_DLL err_t MATROSKA_LinkMetaSeekElement(matroska_seekpoint *MetaSeek, ebml_element *Link);
 MATROSKA_DLL err_t MATROSKA_MetaSeekUpdate(matroska_seekpoint *MetaSeek);
 MATROSKA_DLL err_t MATROSKA_LinkClusterReadSegmentInfo(matroska_cluster *Cluster, ebml_master *SegmentInfo, bool_t UseForWriteToo);
 MATROSKA_DLL err_t MATROSKA_LinkBlockWithReadTracks(matroska_block *Block, ebml_master *Tracks, bool_t UseForWriteToo, int ForProfile);
 MATROSKA_DLL err_t MATROSKA_LinkBlockReadTrack(matroska_block *Block, ebml_master *Track, bool_t UseForWriteToo, int ForProfile);
+// the Map must be zeroed or built before, the first TrackEntry using a number is kept like MATROSKA_LinkBlockWithReadTracks()
+MATROSKA_DLL err_t MATROSKA_TrackMapBuild(matroska_track_map *Map, ebml_master *Tracks);
+MATROSKA_DLL void MATROSKA_TrackMapClear(matroska_track_map *Map);
+MATROSKA_DLL const matroska_track_info *MATROSKA_TrackMapGet(const matroska_track_map *Map, uint16_t TrackNum);
+MATROSKA_DLL err_t MATROSKA_LinkBlockWithTrackMap(matroska_block *Block, const matroska_track_map *Map, bool_t UseForWriteToo, int ForProfile);
 MATROSKA_DLL err_t MATROSKA_LinkBlockReadSegmentInfo(matroska_block *Block, ebml_master *SegmentInfo, bool_t UseForWriteToo);
 #if defined(CONFIG_EBML_WRITING)
 MATROSKA_DLL err_t MATROSKA_LinkClusterWriteSegmentInfo(matroska_cluster *Cluster, ebml_master *SegmentInfo);
@@ -118,6 +155,23 @@ MATROSKA_DLL filepos_t MATROSKA_MetaSeekAbsolutePos(const matroska_seekpoint *Me
 
 MATROSKA_DLL matroska_cuepoint *MATROSKA_CuesGetTimestampStart(const ebml_element *Cues, mkv_timestamp_t Timestamp);
 
+// CueTrackPositions of a sorted Cues index
+typedef struct matroska_cue_index
+{
+    mkv_timestamp_t Timestamp;
+    filepos_t ClusterPosition; // in the Segment data
+    filepos_t RelativePosition; // of the Block in the Cluster data, INVALID_FILEPOS_T if not set
+    int16_t TrackNum;
+
+} matroska_cue_index;
+
+// fill Index with the CueTrackPositions of Cues sorted by timestamp and track, the CuePoints must be linked with the SegmentInfo
+MATROSKA_DLL err_t MATROSKA_CuesBuildIndex(const ebml_master *Cues, array *Index);
+// entry of the Index with the last timestamp at or before Timestamp (the first one if none is) and the earliest position
+MATROSKA_DLL const matroska_cue_index *MATROSKA_CuesIndexGetTimestampStart(const array *Index, mkv_timestamp_t Timestamp);
+// move Input to the Block of the entry at or before Timestamp when it has a RelativePosition, to its Cluster otherwise
+MATROSKA_DLL const matroska_cue_index *MATROSKA_SeekToTimestamp(stream *Input, const array *Index, filepos_t SegmentDataStart, mkv_timestamp_t Timestamp);
+
 #if defined(CONFIG_EBML_WRITING)
 MATROSKA_DLL MatroskaTrackEncodingCompAlgo MATROSKA_TrackGetBlockCompression(const matroska_trackentry *TrackEntry, int ForProfile);
 MATROSKA_DLL bool_t MATROSKA_TrackSetCompressionZlib(matroska_trackentry *TrackEntry, int Scope, int ForProfile);
@@ -125,16 +179,43 @@ MATROSKA_DLL bool_t MATROSKA_TrackSetCompressionHeader(matroska_trackentry *Trac
 MATROSKA_DLL bool_t MATROSKA_TrackSetCompressionNone(matroska_trackentry *TrackEntry);
 #if defined(CONFIG_ZLIB)
 MATROSKA_DLL err_t CompressFrameZLib(const uint8_t *Cursor, size_t CursorSize, uint8_t **OutBuf, size_t *OutSize);
+// zlib level and strategy of the Blocks written with this track, 9 and Z_DEFAULT_STRATEGY by default
+MATROSKA_DLL void MATROSKA_TrackSetCompressionZlibParams(matroska_trackentry *TrackEntry, int Level, int Strategy);
+// compress the read frames of the zlib tracks in the Clusters on Threads workers (0 for one per CPU), before their size is updated
+MATROSKA_DLL err_t MATROSKA_ClustersCompressFrames(matroska_cluster * const *Clusters, size_t Count, size_t Threads);
 #else // !CONFIG_ZLIB
 static INLINE err_t CompressFrameZLib(const uint8_t *Cursor, size_t CursorSize, uint8_t **OutBuf, size_t *OutSize)
 {
     return ERR_NOT_SUPPORTED;
 }
+static INLINE void MATROSKA_TrackSetCompressionZlibParams(matroska_trackentry *UNUSED_PARAM(TrackEntry), int UNUSED_PARAM(Level), int UNUSED_PARAM(Strategy)) {}
+static INLINE err_t MATROSKA_ClustersCompressFrames(matroska_cluster * const *UNUSED_PARAM(Clusters), size_t UNUSED_PARAM(Count), size_t UNUSED_PARAM(Threads))
+{
+    return ERR_NONE;
+}
 #endif // !CONFIG_ZLIB
 #endif
 
 MATROSKA_DLL void MATROSKA_ClusterSort(matroska_cluster *Cluster); // not good with P frames!!!
 
+// SimpleBlock/BlockGroup of a Cluster read with SCOPE_SHALLOW_DATA, no element is created for it
+typedef struct matroska_cluster_block
+{
+    filepos_t Position; // of the element head
+    filepos_t DataSize;
+    fourcc_t Id;
+    uint16_t TrackNumber;
+    int16_t LocalTimestamp;
+    uint8_t Flags; // flags octet of the SimpleBlock/Block
+    uint8_t HeadSize;
+
+} matroska_cluster_block;
+
+// the Blocks recorded by the last SCOPE_SHALLOW_DATA read of the Cluster, the other children are read as usual
+MATROSKA_DLL const matroska_cluster_block *MATROSKA_ClusterShallowBlocks(const matroska_cluster *Cluster, size_t *Count);
+// create and read the element of a recorded Block, it's added to the Cluster children in file order
+MATROSKA_DLL err_t MATROSKA_ClusterReadShallowBlock(matroska_cluster *Cluster, stream *Input, const ebml_parser_context *ParserContext, const matroska_cluster_block *Block, int Scope, ebml_element **Element);
+
 MATROSKA_DLL ebml_element *MATROSKA_BlockReadTrack(const matroska_block *Block);
 MATROSKA_DLL ebml_element *MATROSKA_BlockReadSegmentInfo(const matroska_block *Block);
 #if defined(CONFIG_EBML_WRITING)
@@ -153,12 +234,32 @@ MATROSKA_DLL mkv_timestamp_t MATROSKA_BlockGetFrameEnd(const matroska_block *Blo
 MATROSKA_DLL size_t MATROSKA_BlockGetLength(const matroska_block *Block, size_t FrameNum);
 
 MATROSKA_DLL err_t MATROSKA_BlockGetFrame(const matroska_block *Block, size_t FrameNum, matroska_frame *Frame, bool_t WithData);
+// the frames of an unread Block are given in place from a memory/buffered Input, compressed tracks are read in the Block first
+MATROSKA_DLL err_t MATROSKA_BlockVisitFrames(matroska_block *Block, stream *Input, matroska_frame_visitor Visitor, void *Cookie, int ForProfile);
+// read one whole frame in Dest, ERR_BUFFER_FULL when DestSize is smaller than the returned Size
+MATROSKA_DLL err_t MATROSKA_BlockReadFrame(matroska_block *Block, stream *Input, size_t FrameNum, uint8_t *Dest, size_t DestSize, size_t *Size, int ForProfile);
 MATROSKA_DLL err_t MATROSKA_BlockAppendFrame(matroska_block *Block, const matroska_frame *Frame, mkv_timestamp_t ClusterTimestamp);
 MATROSKA_DLL bool_t MATROSKA_BlockIsKeyframe(const matroska_block *Block);
 
 
 MATROSKA_DLL matroska_block *MATROSKA_GetBlockForTimestamp(matroska_cluster *Cluster, mkv_timestamp_t Timestamp, int16_t Track);
+
+// position of a read keyframe in the index of its Track
+typedef struct matroska_block_index
+{
+    mkv_timestamp_t Timestamp;
+    filepos_t ClusterPosition;
+    filepos_t BlockPosition; // of the Block/BlockGroup relative to the Cluster
+
+} matroska_block_index;
+
+// add the linked keyframes of a read Cluster to the index of their Track, the other Blocks can't start a seek
+MATROSKA_DLL err_t MATROSKA_ClusterIndexBlocks(matroska_cluster *Cluster);
+// first indexed keyframe of the Track at Timestamp in the Cluster at ClusterPosition (any Cluster if INVALID_FILEPOS_T), NULL if there is none
+MATROSKA_DLL const matroska_block_index *MATROSKA_TrackFindBlock(const matroska_trackentry *TrackEntry, mkv_timestamp_t Timestamp, filepos_t ClusterPosition);
+MATROSKA_DLL void MATROSKA_TrackClearBlockIndex(matroska_trackentry *TrackEntry);
 MATROSKA_DLL void MATROSKA_LinkClusterBlocks(matroska_cluster *Cluster, ebml_master *RSegmentInfo, ebml_master *Tracks, bool_t KeepUnmatched, int ForProfile);
+MATROSKA_DLL void MATROSKA_LinkClusterBlocksWithMap(matroska_cluster *Cluster, ebml_master *RSegmentInfo, const matroska_track_map *Map, bool_t KeepUnmatched, int ForProfile);
 
 MATROSKA_DLL const ebml_context *MATROSKA_getContextStream();
 
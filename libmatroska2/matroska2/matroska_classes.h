@@ -56,6 +56,8 @@ struct matroska_block
 #if defined(CONFIG_EBML_WRITING)
     ebml_master *WriteTrack;
     ebml_master *WriteSegInfo;
+    array Compressed; // uint8_t, the frames zlib compressed for the WriteTrack
+    array SizeListCompressed; // int32_t
 #endif
     bool_t IsKeyframe;
     bool_t IsDiscardable;
@@ -66,4 +68,32 @@ struct matroska_block
     char Lacing;
 };
 
+typedef enum
+{
+    MATROSKA_FRAME_CODEC_UNKNOWN, // not computed yet
+    MATROSKA_FRAME_CODEC_NOT_AUDIO,
+    MATROSKA_FRAME_CODEC_NO_CODECID,
+    MATROSKA_FRAME_CODEC_OTHER, // no duration helper for this codec
+    MATROSKA_FRAME_CODEC_MPEG,
+    MATROSKA_FRAME_CODEC_AC3,
+    MATROSKA_FRAME_CODEC_EAC3,
+    MATROSKA_FRAME_CODEC_DTS,
+    MATROSKA_FRAME_CODEC_CONSTANT, // all frames have the same duration
+    MATROSKA_FRAME_CODEC_VORBIS,
+    MATROSKA_FRAME_CODEC_VORBIS_INVALID,
+} matroska_frame_codec;
+
+// codec parameters of a TrackEntry used to compute the frame durations of its Blocks
+typedef struct matroska_frame_params
+{
+    matroska_frame_codec Codec;
+    mkv_timestamp_t FrameDuration; // for MATROSKA_FRAME_CODEC_CONSTANT, INVALID_TIMESTAMP_T if unknown
+    int VorbisModeBits;
+    int VorbisModes;
+    mkv_timestamp_t VorbisDurations[64]; // duration of a packet for each Vorbis mode
+
+} matroska_frame_params;
+
+MATROSKA_DLL matroska_frame_params *MATROSKA_TrackFrameParams(matroska_trackentry *TrackEntry);
+
 #endif /* LIBMATROSKA2_CLASSES_H */
@@ -28,11 +28,6 @@
 #include "matroska2/matroska.h"
 #include "matroska2/matroska_sem.h"
 #include "matroska2/matroska_classes.h"
-#if !defined(CONFIG_NOCODEC_HELPER)
-#include "ivorbiscodec.h"
-#include "codec_internal.h"
-#include "misc.h"
-#endif
 
 static int A_MPEG_freq[4][4] =
 {
@@ -67,256 +62,537 @@ static const int A_DTS_freq[16] = {
 };
 
 
-err_t MATROSKA_BlockProcessFrameDurations(matroska_block *Block, stream *Input, int ForProfile)
+#if !defined(CONFIG_NOCODEC_HELPER)
+// Vorbis headers are only walked to find the block size of each mode, nothing is allocated
+typedef struct vorbis_bits
+{
+    const uint8_t *Data;
+    size_t Size;
+    size_t Pos; // in bits
+    bool_t Overrun;
+    // the setup elements already read, for the index checks
+    int Channels;
+    int Books;
+    int Times;
+    int Floors;
+    int Residues;
+    int Maps;
+
+} vorbis_bits;
+
+static uint32_t VorbisRead(vorbis_bits *Bits, int Count)
+{
+    uint32_t Value = 0;
+    int i;
+    for (i=0;i<Count;++i,++Bits->Pos)
+    {
+        if ((Bits->Pos >> 3) >= Bits->Size)
+        {
+            Bits->Overrun = 1;
+            return 0;
+        }
+        Value |= (uint32_t)((Bits->Data[Bits->Pos >> 3] >> (Bits->Pos & 7)) & 1) << i;
+    }
+    return Value;
+}
+
+static void VorbisSkip(vorbis_bits *Bits, uint64_t Count)
+{
+    if (Count > (uint64_t)Bits->Size*8 - Bits->Pos)
+        Bits->Overrun = 1;
+    else
+        Bits->Pos += (size_t)Count;
+}
+
+static int VorbisILog(uint32_t v)
+{
+    int Result = 0;
+    while (v)
+    {
+        ++Result;
+        v >>= 1;
+    }
+    return Result;
+}
+
+static bool_t VorbisSkipCodebook(vorbis_bits *Bits)
+{
+    uint32_t Dim, Entries, Entry, Lookup;
+    uint64_t Values;
+    int ValueBits;
+
+    if (VorbisRead(Bits,24)!=0x564342)
+        return 0;
+    Dim = VorbisRead(Bits,16);
+    Entries = VorbisRead(Bits,24);
+    if (VorbisRead(Bits,1)) // ordered
+    {
+        VorbisSkip(Bits,5);
+        for (Entry=0;Entry<Entries && !Bits->Overrun;)
+            Entry += VorbisRead(Bits,VorbisILog(Entries-Entry));
+        if (Entry>Entries)
+            return 0;
+    }
+    else if (VorbisRead(Bits,1)) // sparse
+    {
+        for (Entry=0;Entry<Entries && !Bits->Overrun;++Entry)
+            if (VorbisRead(Bits,1))
+                VorbisSkip(Bits,5);
+    }
+    else
+        VorbisSkip(Bits,(uint64_t)Entries*5);
+
+    Lookup = VorbisRead(Bits,4);
+    if (Lookup==1 || Lookup==2)
+    {
+        VorbisSkip(Bits,32+32);
+        ValueBits = VorbisRead(Bits,4)+1;
+        VorbisSkip(Bits,1);
+        if (Lookup==2)
+            Values = (uint64_t)Entries*Dim;
+        else
+        {
+            // largest value which to the power of Dim is not above Entries
+            uint32_t Low = 0, High = Entries, d;
+            uint64_t Power;
+            if (Dim==0)
+                return 0;
+            while (Low<High)
+            {
+                Values = Low + (High-Low+1)/2;
+                for (Power=1,d=0;d<Dim && Power<=Entries;++d)
+                    Power *= Values;
+                if (Power>Entries)
+                    High = Values-1;
+                else
+                    Low = Values;
+            }
+            Values = Low;
+        }
+        VorbisSkip(Bits,Values*ValueBits);
+    }
+    else if (Lookup!=0)
+        return 0;
+    return !Bits->Overrun;
+}
+
+static bool_t VorbisSkipFloor(vorbis_bits *Bits)
+{
+    int Type = VorbisRead(Bits,16);
+    if (Type==0)
+    {
+        int Order, Rate, BarkMap, Books;
+        Order = VorbisRead(Bits,8);
+        Rate = VorbisRead(Bits,16);
+        BarkMap = VorbisRead(Bits,16);
+        VorbisSkip(Bits,6+8);
+        if (Order<1 || Rate<1 || BarkMap<1)
+            return 0;
+        for (Books=VorbisRead(Bits,4)+1;Books;--Books)
+            if ((int)VorbisRead(Bits,8)>=Bits->Books)
+                return 0;
+    }
+    else if (Type==1)
+    {
+        int Partitions, Classes=0, i, j, RangeBits;
+        uint8_t PartitionClass[31];
+        uint8_t ClassDim[16];
+
+        Partitions = VorbisRead(Bits,5);
+        for (i=0;i<Partitions;++i)
+        {
+            PartitionClass[i] = (uint8_t)VorbisRead(Bits,4);
+            if (Classes<=PartitionClass[i])
+                Classes = PartitionClass[i]+1;
+        }
+        for (i=0;i<Classes;++i)
+        {
+            int SubClasses;
+            ClassDim[i] = (uint8_t)(VorbisRead(Bits,3)+1);
+            SubClasses = VorbisRead(Bits,2);
+            if (SubClasses && (int)VorbisRead(Bits,8)>=Bits->Books)
+                return 0;
+            for (j=0;j<(1<<SubClasses);++j)
+                if ((int)VorbisRead(Bits,8)>Bits->Books) // stored plus one
+                    return 0;
+        }
+        VorbisSkip(Bits,2);
+        RangeBits = VorbisRead(Bits,4);
+        for (i=0,j=0;i<Partitions;++i)
+            j += ClassDim[PartitionClass[i]];
+        VorbisSkip(Bits,(uint64_t)j*RangeBits);
+    }
+    else
+        return 0;
+    return !Bits->Overrun;
+}
+
+static bool_t VorbisSkipResidue(vorbis_bits *Bits)
+{
+    int Classifications, i, Books = 0;
+    uint32_t Cascade;
+    if (VorbisRead(Bits,16)>2)
+        return 0;
+    VorbisSkip(Bits,24+24+24);
+    Classifications = VorbisRead(Bits,6)+1;
+    if ((int)VorbisRead(Bits,8)>=Bits->Books)
+        return 0;
+    for (i=0;i<Classifications;++i)
+    {
+        Cascade = VorbisRead(Bits,3);
+        if (VorbisRead(Bits,1))
+            Cascade |= VorbisRead(Bits,5) << 3;
+        for (;Cascade;Cascade>>=1)
+            Books += Cascade & 1;
+    }
+    for (;Books;--Books)
+        if ((int)VorbisRead(Bits,8)>=Bits->Books)
+            return 0;
+    return !Bits->Overrun;
+}
+
+static bool_t VorbisSkipMapping(vorbis_bits *Bits)
+{
+    int SubMaps = 1, ChannelBits = VorbisILog(Bits->Channels-1), i;
+    if (VorbisRead(Bits,16)!=0)
+        return 0;
+    if (VorbisRead(Bits,1))
+        SubMaps = VorbisRead(Bits,4)+1;
+    if (VorbisRead(Bits,1)) // coupling
+    {
+        int Steps, Magnitude, Angle;
+        for (Steps=VorbisRead(Bits,8)+1;Steps;--Steps)
+        {
+            Magnitude = VorbisRead(Bits,ChannelBits);
+            Angle = VorbisRead(Bits,ChannelBits);
+            if (Magnitude==Angle || Magnitude>=Bits->Channels || Angle>=Bits->Channels)
+                return 0;
+        }
+    }
+    if (VorbisRead(Bits,2)!=0) // reserved
+        return 0;
+    if (SubMaps>1)
+        for (i=0;i<Bits->Channels;++i)
+            if ((int)VorbisRead(Bits,4)>=SubMaps)
+                return 0;
+    for (i=0;i<SubMaps;++i)
+    {
+        if ((int)VorbisRead(Bits,8)>=Bits->Times || (int)VorbisRead(Bits,8)>=Bits->Floors || (int)VorbisRead(Bits,8)>=Bits->Residues)
+            return 0;
+    }
+    return !Bits->Overrun;
+}
+
+static bool_t VorbisHeader(vorbis_bits *Bits, const uint8_t *Data, size_t Size, int Type)
+{
+    if (Size<7 || Data[0]!=Type || memcmp(Data+1,"vorbis",6)!=0)
+        return 0;
+    Bits->Data = Data + 7;
+    Bits->Size = Size - 7;
+    Bits->Pos = 0;
+    Bits->Overrun = 0;
+    return 1;
+}
+
+static bool_t ReadVorbisParams(const uint8_t *Data, size_t Size, matroska_frame_params *Params)
+{
+    vorbis_bits Bits;
+    size_t Packet[3], Pos;
+    int Rate, BlockSize[2], i;
+
+    // the 3 Xiph laced header packets
+    if (Size<1 || Data[0]!=2)
+        return 0;
+    Pos = 1;
+    for (i=0;i<2;++i)
+    {
+        Packet[i] = 0;
+        do
+        {
+            if (Pos>=Size)
+                return 0;
+            Packet[i] += Data[Pos];
+        }
+        while (Data[Pos++]==255);
+    }
+    if (Packet[0]+Packet[1] > Size-Pos)
+        return 0;
+    Packet[2] = Size-Pos-Packet[0]-Packet[1];
+
+    if (!VorbisHeader(&Bits,Data+Pos,Packet[0],1) || VorbisRead(&Bits,32)!=0)
+        return 0;
+    Bits.Channels = VorbisRead(&Bits,8);
+    Rate = VorbisRead(&Bits,32);
+    VorbisSkip(&Bits,3*32);
+    BlockSize[0] = 1 << VorbisRead(&Bits,4);
+    BlockSize[1] = 1 << VorbisRead(&Bits,4);
+    if (Bits.Overrun || Rate<1 || Bits.Channels<1 || BlockSize[0]<64 || BlockSize[1]<BlockSize[0] || BlockSize[1]>8192)
+        return 0;
+
+    if (!VorbisHeader(&Bits,Data+Pos+Packet[0]+Packet[1],Packet[2],5))
+        return 0;
+    Bits.Books = VorbisRead(&Bits,8)+1;
+    for (i=0;i<Bits.Books;++i)
+        if (!VorbisSkipCodebook(&Bits))
+            return 0;
+    Bits.Times = VorbisRead(&Bits,6)+1;
+    for (i=0;i<Bits.Times;++i)
+        if (VorbisRead(&Bits,16)!=0) // no time domain transform in Vorbis I
+            return 0;
+    Bits.Floors = VorbisRead(&Bits,6)+1;
+    for (i=0;i<Bits.Floors;++i)
+        if (!VorbisSkipFloor(&Bits))
+            return 0;
+    Bits.Residues = VorbisRead(&Bits,6)+1;
+    for (i=0;i<Bits.Residues;++i)
+        if (!VorbisSkipResidue(&Bits))
+            return 0;
+    Bits.Maps = VorbisRead(&Bits,6)+1;
+    for (i=0;i<Bits.Maps;++i)
+        if (!VorbisSkipMapping(&Bits))
+            return 0;
+
+    Params->VorbisModes = VorbisRead(&Bits,6)+1;
+    Params->VorbisModeBits = VorbisILog(Params->VorbisModes-1);
+    for (i=0;i<Params->VorbisModes;++i)
+    {
+        Params->VorbisDurations[i] = Scale64(1000000000,BlockSize[VorbisRead(&Bits,1)],Rate);
+        if (VorbisRead(&Bits,16)!=0 || VorbisRead(&Bits,16)!=0 || (int)VorbisRead(&Bits,8)>=Bits.Maps) // window and transform types
+            return 0;
+    }
+    return !Bits.Overrun && VorbisRead(&Bits,1)==1;
+}
+#endif
+
+static void ReadFrameParams(ebml_master *Track, matroska_frame_params *Params)
 {
-    ebml_master *Track=NULL;
     ebml_element *Elt;
     tchar_t CodecID[MAXPATH];
+
+    Elt = EBML_MasterFindChild(Track,MATROSKA_getContextTrackType());
+    if (!Elt || EBML_IntegerValue((ebml_integer*)Elt)!=MATROSKA_TRACK_TYPE_AUDIO) // other track types not supported for now
+    {
+        Params->Codec = MATROSKA_FRAME_CODEC_NOT_AUDIO;
+        return;
+    }
+
+    Elt = EBML_MasterFindChild(Track,MATROSKA_getContextCodecID());
+    if (!Elt) // missing codec ID
+    {
+        Params->Codec = MATROSKA_FRAME_CODEC_NO_CODECID;
+        return;
+    }
+
+    EBML_StringGet((ebml_string*)Elt,CodecID,TSIZEOF(CodecID));
+    Params->Codec = MATROSKA_FRAME_CODEC_OTHER;
+    if (tcsisame_ascii(CodecID,T("A_MPEG/L3")) || tcsisame_ascii(CodecID,T("A_MPEG/L2")) || tcsisame_ascii(CodecID,T("A_MPEG/L1")))
+        Params->Codec = MATROSKA_FRAME_CODEC_MPEG;
+    else if (tcsisame_ascii(CodecID,T("A_AC3")))
+        Params->Codec = MATROSKA_FRAME_CODEC_AC3;
+    else if (tcsisame_ascii(CodecID,T("A_EAC3")))
+        Params->Codec = MATROSKA_FRAME_CODEC_EAC3;
+    else if (tcsisame_ascii(CodecID,T("A_DTS")))
+        Params->Codec = MATROSKA_FRAME_CODEC_DTS;
+    else if (tcsisame_ascii(CodecID,T("A_AAC")) || tcsncmp(CodecID,T("A_AAC/"),6)==0)
+    {
+        Params->Codec = MATROSKA_FRAME_CODEC_CONSTANT;
+        Params->FrameDuration = INVALID_TIMESTAMP_T;
+        Elt = EBML_MasterFindChild(Track,MATROSKA_getContextAudio());
+        if (Elt)
+        {
+            Elt = EBML_MasterFindChild((ebml_master*)Elt,MATROSKA_getContextSamplingFrequency());
+            if (Elt)
+                Params->FrameDuration = Scale64(1000000000,1024,(int)((ebml_float*)Elt)->Value);
+        }
+    }
+#if !defined(CONFIG_NOCODEC_HELPER)
+    else if (tcsisame_ascii(CodecID,T("A_VORBIS")))
+    {
+        Params->Codec = MATROSKA_FRAME_CODEC_CONSTANT;
+        Params->FrameDuration = INVALID_TIMESTAMP_T;
+        Elt = EBML_MasterFindChild(Track,MATROSKA_getContextCodecPrivate());
+        if (Elt)
+        {
+            if (ReadVorbisParams(EBML_BinaryGetData((ebml_binary*)Elt),(size_t)EBML_ElementDataSize(Elt, 1),Params))
+                Params->Codec = MATROSKA_FRAME_CODEC_VORBIS;
+            else
+                Params->Codec = MATROSKA_FRAME_CODEC_VORBIS_INVALID;
+        }
+    }
+#endif
+}
+
+err_t MATROSKA_BlockProcessFrameDurations(matroska_block *Block, stream *Input, int ForProfile)
+{
+    ebml_master *Track=NULL;
+    matroska_frame_params *Params;
     err_t Err;
     bool_t ReadData;
     uint8_t *Cursor;
-    size_t Frame;
+    mkv_timestamp_t *Duration;
+    size_t Frame, FrameCount;
     int Version, Layer, SampleRate, Samples, fscod, fscod2;
 
     Err = Node_GET(Block,MATROSKA_BLOCK_READ_TRACK,&Track);
     if (Err==ERR_NONE)
     {
         assert(Track!=NULL);
-        Elt = EBML_MasterFindChild(Track,MATROSKA_getContextTrackType());
-        if (!Elt || EBML_IntegerValue((ebml_integer*)Elt)!=MATROSKA_TRACK_TYPE_AUDIO) // other track types not supported for now
+        Params = MATROSKA_TrackFrameParams((matroska_trackentry*)Track);
+        if (Params->Codec==MATROSKA_FRAME_CODEC_UNKNOWN)
+            ReadFrameParams(Track,Params);
+
+        if (Params->Codec==MATROSKA_FRAME_CODEC_NOT_AUDIO)
+            Err = ERR_INVALID_DATA;
+        else if (Block->FirstFrameLocation==0)
+            Err = ERR_READ;
+        else if (Params->Codec==MATROSKA_FRAME_CODEC_NO_CODECID)
             Err = ERR_INVALID_DATA;
         else
         {
-            if (Block->FirstFrameLocation==0)
-                Err = ERR_READ;
-            else
+            ReadData = 0;
+            if (!ArraySize(&Block->Data))
             {
-                Elt = EBML_MasterFindChild(Track,MATROSKA_getContextCodecID());
-                if (!Elt) // missing codec ID
-                    Err = ERR_INVALID_DATA;
-                else
+                Err = MATROSKA_BlockReadData(Block,Input,ForProfile);
+                if (Err!=ERR_NONE)
+                    goto exit;
+                ReadData = 1;
+            }
+
+            FrameCount = ARRAYCOUNT(Block->SizeList,int32_t);
+            Cursor = ARRAYBEGIN(Block->Data,uint8_t);
+            switch (Params->Codec)
+            {
+            case MATROSKA_FRAME_CODEC_MPEG:
+                Block->IsKeyframe = 1; // safety
+                ArrayResize(&Block->Durations,sizeof(mkv_timestamp_t)*FrameCount,0);
+                Duration = ARRAYBEGIN(Block->Durations,mkv_timestamp_t);
+                for (Frame=0;Frame<FrameCount;++Frame)
                 {
-                    EBML_StringGet((ebml_string*)Elt,CodecID,TSIZEOF(CodecID));
-                    ReadData = 0;
-                    if (!ArraySize(&Block->Data))
-                    {
-                        Err = MATROSKA_BlockReadData(Block,Input,ForProfile);
-                        if (Err!=ERR_NONE)
-                            goto exit;
-                        ReadData = 1;
-                    }
+                    Version = (Cursor[1] >> 3) & 3;
+                    Layer = (Cursor[1] >> 1) & 3;
+                    SampleRate = (Cursor[2] >> 2) & 3;
 
-                    if (tcsisame_ascii(CodecID,T("A_MPEG/L3")) || tcsisame_ascii(CodecID,T("A_MPEG/L2")) || tcsisame_ascii(CodecID,T("A_MPEG/L1")))
+                    Samples = A_MPEG_samples[Layer][Version];
+                    SampleRate = A_MPEG_freq[SampleRate][Version];
+                    if (SampleRate!=0 && Samples!=0)
+                        Duration[Frame] = Scale64(1000000000,Samples,SampleRate);
+                    else
                     {
-                        Block->IsKeyframe = 1; // safety
-                        ArrayResize(&Block->Durations,sizeof(mkv_timestamp_t)*ARRAYCOUNT(Block->SizeList,int32_t),0);
-                        Cursor = ARRAYBEGIN(Block->Data,uint8_t);
-                        for (Frame=0;Frame<ARRAYCOUNT(Block->SizeList,int32_t);++Frame)
-                        {
-                            Version = (Cursor[1] >> 3) & 3;
-                            Layer = (Cursor[1] >> 1) & 3;
-                            SampleRate = (Cursor[2] >> 2) & 3;
-
-                            Samples = A_MPEG_samples[Layer][Version];
-                            SampleRate = A_MPEG_freq[SampleRate][Version];
-                            if (SampleRate!=0 && Samples!=0)
-                                ARRAYBEGIN(Block->Durations,mkv_timestamp_t)[Frame] = Scale64(1000000000,Samples,SampleRate);
-                            else
-                            {
-                                Err = ERR_INVALID_DATA;
-                                ARRAYBEGIN(Block->Durations,mkv_timestamp_t)[Frame] = INVALID_TIMESTAMP_T;
-                                //goto exit;
-                            }
-
-                            Cursor += ARRAYBEGIN(Block->SizeList,int32_t)[Frame];
-                        }
+                        Err = ERR_INVALID_DATA;
+                        Duration[Frame] = INVALID_TIMESTAMP_T;
                     }
-                    else if (tcsisame_ascii(CodecID,T("A_AC3")))
+
+                    Cursor += ARRAYBEGIN(Block->SizeList,int32_t)[Frame];
+                }
+                break;
+
+            case MATROSKA_FRAME_CODEC_AC3:
+                Block->IsKeyframe = 1; // safety
+                ArrayResize(&Block->Durations,sizeof(mkv_timestamp_t)*FrameCount,0);
+                Duration = ARRAYBEGIN(Block->Durations,mkv_timestamp_t);
+                for (Frame=0;Frame<FrameCount;++Frame)
+                {
+                    fscod =  Cursor[5] >> 3;
+                    SampleRate = Cursor[4] >> 6;
+                    if (fscod > 10 || fscod < 8)
                     {
-                        Block->IsKeyframe = 1; // safety
-                        ArrayResize(&Block->Durations,sizeof(mkv_timestamp_t)*ARRAYCOUNT(Block->SizeList,int32_t),0);
-                        Cursor = ARRAYBEGIN(Block->Data,uint8_t);
-                        for (Frame=0;Frame<ARRAYCOUNT(Block->SizeList,int32_t);++Frame)
-                        {
-                            fscod =  Cursor[5] >> 3;
-                            SampleRate = Cursor[4] >> 6;
-                            if (fscod > 10 || fscod < 8)
-                            {
-                                Err = ERR_INVALID_DATA;
-                                ARRAYBEGIN(Block->Durations,mkv_timestamp_t)[Frame] = INVALID_TIMESTAMP_T;
-                                //goto exit;
-                            }
-                            else
-                            {
-                                SampleRate = A_AC3_freq[fscod-8][SampleRate];
-                                ARRAYBEGIN(Block->Durations,mkv_timestamp_t)[Frame] = Scale64(1000000000,1536,SampleRate);
-                            }
-                            Cursor += ARRAYBEGIN(Block->SizeList,int32_t)[Frame];
-                        }
+                        Err = ERR_INVALID_DATA;
+                        Duration[Frame] = INVALID_TIMESTAMP_T;
                     }
-                    else if (tcsisame_ascii(CodecID,T("A_EAC3")))
+                    else
                     {
-                        Block->IsKeyframe = 1; // safety
-                        ArrayResize(&Block->Durations,sizeof(mkv_timestamp_t)*ARRAYCOUNT(Block->SizeList,int32_t),0);
-                        Cursor = ARRAYBEGIN(Block->Data,uint8_t);
-                        for (Frame=0;Frame<ARRAYCOUNT(Block->SizeList,int32_t);++Frame)
-                        {
-                            fscod =  Cursor[4] >> 6;
-                            fscod2 = (Cursor[4] >> 4) & 0x03;
-                            if ((0x03 == fscod) && (0x03 == fscod2))
-                            {
-                                Err = ERR_INVALID_DATA;
-                                ARRAYBEGIN(Block->Durations,mkv_timestamp_t)[Frame] = INVALID_TIMESTAMP_T;
-                                //goto exit;
-                            }
-                            else
-                            {
-                                SampleRate = A_EAC3_freq[0x03 == fscod ? 3 + fscod2 : fscod];
-                                Samples = (0x03 == fscod) ? 1536 : A_EAC3_samples[fscod2];
-                                ARRAYBEGIN(Block->Durations,mkv_timestamp_t)[Frame] = Scale64(1000000000,Samples,SampleRate);
-                            }
-                            Cursor += ARRAYBEGIN(Block->SizeList,int32_t)[Frame];
-                        }
+                        SampleRate = A_AC3_freq[fscod-8][SampleRate];
+                        Duration[Frame] = Scale64(1000000000,1536,SampleRate);
                     }
-                    else if (tcsisame_ascii(CodecID,T("A_DTS")))
+                    Cursor += ARRAYBEGIN(Block->SizeList,int32_t)[Frame];
+                }
+                break;
+
+            case MATROSKA_FRAME_CODEC_EAC3:
+                Block->IsKeyframe = 1; // safety
+                ArrayResize(&Block->Durations,sizeof(mkv_timestamp_t)*FrameCount,0);
+                Duration = ARRAYBEGIN(Block->Durations,mkv_timestamp_t);
+                for (Frame=0;Frame<FrameCount;++Frame)
+                {
+                    fscod =  Cursor[4] >> 6;
+                    fscod2 = (Cursor[4] >> 4) & 0x03;
+                    if ((0x03 == fscod) && (0x03 == fscod2))
                     {
-                        Block->IsKeyframe = 1; // safety
-                        ArrayResize(&Block->Durations,sizeof(mkv_timestamp_t)*ARRAYCOUNT(Block->SizeList,int32_t),0);
-                        Cursor = ARRAYBEGIN(Block->Data,uint8_t);
-                        for (Frame=0;Frame<ARRAYCOUNT(Block->SizeList,int32_t);++Frame)
-                        {
-                            Samples = (((Cursor[4] & 1) << 7) + (Cursor[5] >> 2) + 1) * 32;
-                            // TODO: handle the frame termination
-                            SampleRate = A_DTS_freq[(Cursor[8] >> 2) & 0x0F];
-                            if (Samples==0 || SampleRate==0)
-                            {
-                                Err = ERR_INVALID_DATA;
-                                ARRAYBEGIN(Block->Durations,mkv_timestamp_t)[Frame] = INVALID_TIMESTAMP_T;
-                                //goto exit;
-                            }
-                            else
-                                ARRAYBEGIN(Block->Durations,mkv_timestamp_t)[Frame] = Scale64(1000000000,Samples,SampleRate);
-                            Cursor += ARRAYBEGIN(Block->SizeList,int32_t)[Frame];
-                        }
+                        Err = ERR_INVALID_DATA;
+                        Duration[Frame] = INVALID_TIMESTAMP_T;
                     }
-                    else if (tcsisame_ascii(CodecID,T("A_AAC")) || tcsncmp(CodecID,T("A_AAC/"),6)==0)
+                    else
                     {
-                        Block->IsKeyframe = 1; // safety
-                        Elt = EBML_MasterFindChild(Track,MATROSKA_getContextAudio());
-                        if (Elt)
-                        {
-                            Elt = EBML_MasterFindChild((ebml_master*)Elt,MATROSKA_getContextSamplingFrequency());
-                            if (Elt)
-                            {
-                                ArrayResize(&Block->Durations,sizeof(mkv_timestamp_t)*ARRAYCOUNT(Block->SizeList,int32_t),0);
-                                Samples = 1024;
-                                SampleRate = (int)((ebml_float*)Elt)->Value;
-                                for (Frame=0;Frame<ARRAYCOUNT(Block->SizeList,int32_t);++Frame)
-                                    ARRAYBEGIN(Block->Durations,mkv_timestamp_t)[Frame] = Scale64(1000000000,Samples,SampleRate);
-                            }
-                        }
+                        SampleRate = A_EAC3_freq[0x03 == fscod ? 3 + fscod2 : fscod];
+                        Samples = (0x03 == fscod) ? 1536 : A_EAC3_samples[fscod2];
+                        Duration[Frame] = Scale64(1000000000,Samples,SampleRate);
                     }
-#if !defined(CONFIG_NOCODEC_HELPER)
-                    else if (tcsisame_ascii(CodecID,T("A_VORBIS")))
+                    Cursor += ARRAYBEGIN(Block->SizeList,int32_t)[Frame];
+                }
+                break;
+
+            case MATROSKA_FRAME_CODEC_DTS:
+                Block->IsKeyframe = 1; // safety
+                ArrayResize(&Block->Durations,sizeof(mkv_timestamp_t)*FrameCount,0);
+                Duration = ARRAYBEGIN(Block->Durations,mkv_timestamp_t);
+                for (Frame=0;Frame<FrameCount;++Frame)
+                {
+                    Samples = (((Cursor[4] & 1) << 7) + (Cursor[5] >> 2) + 1) * 32;
+                    // TODO: handle the frame termination
+                    SampleRate = A_DTS_freq[(Cursor[8] >> 2) & 0x0F];
+                    if (Samples==0 || SampleRate==0)
                     {
-                        Block->IsKeyframe = 1; // safety
-                        Elt = EBML_MasterFindChild(Track,MATROSKA_getContextCodecPrivate());
-                        if (Elt)
-                        {
-                            vorbis_info vi;
-                            vorbis_comment vc;
-                            ogg_packet OggPacket;
-                        	ogg_reference OggRef;
-                        	ogg_buffer OggBuffer;
-                            int n,i,j;
-                            codec_setup_info *ci;
-
-		                    vorbis_info_init(&vi);
-		                    vorbis_comment_init(&vc);
-                            memset(&OggPacket,0,sizeof(ogg_packet));
-
-		                    OggBuffer.data = (uint8_t*)EBML_BinaryGetData((ebml_binary*)Elt);
-		                    OggBuffer.size = (long)EBML_ElementDataSize(Elt, 1);
-		                    OggBuffer.refcount = 1;
-
-                            memset(&OggRef,0,sizeof(OggRef));
-		                    OggRef.buffer = &OggBuffer;
-		                    OggRef.next = NULL;
-
-		                    OggPacket.packet = &OggRef;
-		                    OggPacket.packetno = -1; 
-
-		                    n = OggBuffer.data[0];
-		                    i = 1+n;
-		                    j = 1;
-
-		                    while (OggPacket.packetno < 3 && n>=j)
-		                    {
-			                    OggRef.begin = i;
-			                    OggRef.length = 0;
-			                    do
-			                    {
-				                    OggRef.length += OggBuffer.data[j];
-			                    }
-			                    while (OggBuffer.data[j++] == 255 && n>=j);
-			                    i += OggRef.length;
-
-			                    if (i > OggBuffer.size)
-				                    return ERR_INVALID_DATA;
-
-	                            ++OggPacket.packetno;
-	                            OggPacket.b_o_s = OggPacket.packetno == 0;
-	                            OggPacket.bytes = OggPacket.packet->length;
-			                    if (!(vorbis_synthesis_headerin(&vi,&vc,&OggPacket) >= 0) && OggPacket.packetno==0)
-				                    return ERR_INVALID_DATA;
-		                    }
-
-		                    if (OggPacket.packetno < 3)
-		                    {
-			                    OggRef.begin = i;
-			                    OggRef.length = OggBuffer.size - i; 
-
-	                            ++OggPacket.packetno;
-	                            OggPacket.b_o_s = OggPacket.packetno == 0;
-	                            OggPacket.bytes = OggPacket.packet->length;
-
-                                if (!(vorbis_synthesis_headerin(&vi,&vc,&OggPacket) >= 0) && OggPacket.packetno==0)
-				                    return ERR_INVALID_DATA;
-                            }
-
-                            SampleRate = vi.rate;
-                            ArrayResize(&Block->Durations,sizeof(mkv_timestamp_t)*ARRAYCOUNT(Block->SizeList,int32_t),0);
-                            Cursor = ARRAYBEGIN(Block->Data,uint8_t);
-                            ci = vi.codec_setup;
-                            for (Frame=0;Frame<ARRAYCOUNT(Block->SizeList,int32_t);++Frame)
-                            {
-                                fscod = _ilog(ci->modes-1);
-                                fscod = (Cursor[0] & 0x7F) >> (7-fscod);
-                                if (fscod > ci->modes)
-                                {
-                                    Err = ERR_INVALID_DATA;
-                                    ARRAYBEGIN(Block->Durations,mkv_timestamp_t)[Frame] = INVALID_TIMESTAMP_T;
-                                    //goto exit;
-                                }
-                                else
-                                {
-                                    Samples = ci->blocksizes[ci->mode_param[fscod]->blockflag];
-                                    ARRAYBEGIN(Block->Durations,mkv_timestamp_t)[Frame] = Scale64(1000000000,Samples,SampleRate);
-                                }
-                                Cursor += ARRAYBEGIN(Block->SizeList,int32_t)[Frame];
-                            }
-                            vorbis_comment_clear(&vc);
-                            vorbis_info_clear(&vi);
-                        }
+                        Err = ERR_INVALID_DATA;
+                        Duration[Frame] = INVALID_TIMESTAMP_T;
                     }
-#endif
+                    else
+                        Duration[Frame] = Scale64(1000000000,Samples,SampleRate);
+                    Cursor += ARRAYBEGIN(Block->SizeList,int32_t)[Frame];
+                }
+                break;
 
-                    if (ReadData)
+            case MATROSKA_FRAME_CODEC_CONSTANT:
+                Block->IsKeyframe = 1; // safety
+                if (Params->FrameDuration!=INVALID_TIMESTAMP_T)
+                {
+                    ArrayResize(&Block->Durations,sizeof(mkv_timestamp_t)*FrameCount,0);
+                    Duration = ARRAYBEGIN(Block->Durations,mkv_timestamp_t);
+                    for (Frame=0;Frame<FrameCount;++Frame)
+                        Duration[Frame] = Params->FrameDuration;
+                }
+                break;
+
+            case MATROSKA_FRAME_CODEC_VORBIS:
+                Block->IsKeyframe = 1; // safety
+                ArrayResize(&Block->Durations,sizeof(mkv_timestamp_t)*FrameCount,0);
+                Duration = ARRAYBEGIN(Block->Durations,mkv_timestamp_t);
+                for (Frame=0;Frame<FrameCount;++Frame)
+                {
+                    fscod = (Cursor[0] & 0x7F) >> (7-Params->VorbisModeBits);
+                    if (fscod >= Params->VorbisModes)
                     {
-                        ArrayClear(&Block->Data);
-                        Block->Base.Base.bValueIsSet = 0;
+                        Err = ERR_INVALID_DATA;
+                        Duration[Frame] = INVALID_TIMESTAMP_T;
                     }
+                    else
+                        Duration[Frame] = Params->VorbisDurations[fscod];
+                    Cursor += ARRAYBEGIN(Block->SizeList,int32_t)[Frame];
                 }
+                break;
+
+            case MATROSKA_FRAME_CODEC_VORBIS_INVALID:
+                Block->IsKeyframe = 1; // safety
+                Err = ERR_INVALID_DATA;
+                break;
+
+            default:
+                break;
+            }
+
+            if (ReadData)
+            {
+                ArrayClear(&Block->Data);
+                Block->Base.Base.bValueIsSet = 0;
             }
         }
     }
@@ -45,6 +45,9 @@ extern const nodemeta Matroska_Class[];
 ebml_context MATROSKA_ContextStream;
 ebml_semantic EBML_SemanticMatroska[3];
 static int MATROSKA_init_once = 0;
+#if defined(CONFIG_LZO1X)
+static bool_t MATROSKA_LzoReady = 0;
+#endif
 
 const ebml_context *MATROSKA_getContextStream()
 {
@@ -71,7 +74,12 @@ err_t MATROSKA_Init(parsercontext *p)
             EBML_SemanticMatroska[1] = (ebml_semantic){1, 0, MATROSKA_getContextSegment() ,0};
             EBML_SemanticMatroska[2] = (ebml_semantic){0, 0, NULL                         ,0}; // end of the table
             MATROSKA_ContextStream = (ebml_context){FOURCC('M','K','X','_'), EBML_MASTER_CLASS, 0, 0, "Matroska Stream", EBML_SemanticMatroska, EBML_getSemanticGlobals(), NULL};
+#if defined(CONFIG_LZO1X)
+            MATROSKA_LzoReady = lzo_init() == LZO_E_OK;
+#endif
         }
+
+        EBML_IndexContext(p,&MATROSKA_ContextStream);
     }
     return Err;
 }
@@ -109,6 +117,7 @@ struct matroska_cluster
     ebml_master *ReadSegInfo;
     ebml_master *WriteSegInfo;
     mkv_timestamp_t GlobalTimestamp;
+    array ShallowBlocks; // matroska_cluster_block
 };
 
 struct matroska_seekpoint
@@ -121,6 +130,21 @@ struct matroska_trackentry
 {
     ebml_master Base;
     bool_t CodecPrivateCompressed;
+    matroska_frame_params FrameParams; // computed on the first Block that needs its frame durations
+    array BlockIndex; // matroska_block_index sorted by Timestamp
+#if defined(CONFIG_ZLIB) || defined(CONFIG_LZO1X) || defined(CONFIG_BZLIB)
+    // decompression state kept between the Blocks of the track
+    array Compressed; // compressed frames read from the stream
+    uint32_t UnCompressRatio; // output/input size of the last frame in 1/16th, 0 if unknown
+#if defined(CONFIG_ZLIB)
+    bool_t InflateReady;
+    z_stream Inflate;
+#endif
+#endif
+#if defined(CONFIG_EBML_WRITING) && defined(CONFIG_ZLIB)
+    int ZlibLevel;
+    int ZlibStrategy;
+#endif
 };
 
 static err_t BlockTrackChanged(matroska_block *Block)
@@ -129,6 +153,20 @@ static err_t BlockTrackChanged(matroska_block *Block)
 	return ERR_NONE;
 }
 
+#if defined(CONFIG_EBML_WRITING)
+static void BlockClearCompressed(matroska_block *Block)
+{
+    ArrayClear(&Block->Compressed);
+    ArrayClear(&Block->SizeListCompressed);
+}
+
+static err_t BlockWriteTrackChanged(matroska_block *Block)
+{
+    BlockClearCompressed(Block);
+    return BlockTrackChanged(Block);
+}
+#endif
+
 static err_t ClusterTimeChanged(matroska_cluster *Cluster)
 {
     mkv_timestamp_t ClusterTimestamp;
@@ -268,6 +306,93 @@ err_t MATROSKA_LinkBlockReadTrack(matroska_block *Block, ebml_master *Track, boo
     return ERR_INVALID_DATA;
 }
 
+err_t MATROSKA_TrackMapBuild(matroska_track_map *Map, ebml_master *Tracks)
+{
+    ebml_master *Track, *Elt;
+    ebml_element *TrackNum;
+    matroska_track_info *Info;
+    size_t Num, Count;
+
+    assert(EBML_ElementIsType((ebml_element*)Tracks, MATROSKA_getContextTracks()));
+    ArrayClear(&Map->Tracks);
+    for (Track=(ebml_master*)EBML_MasterChildren(Tracks);Track;Track=(ebml_master*)EBML_MasterNext(Track))
+    {
+        if (!EBML_ElementIsType((ebml_element*)Track, MATROSKA_getContextTrackEntry()))
+            continue;
+        TrackNum = EBML_MasterFindChild(Track,MATROSKA_getContextTrackNumber());
+        // Blocks can't be read with track numbers of 0x4000 and above
+        if (!TrackNum || !TrackNum->bValueIsSet || EBML_IntegerValue((ebml_integer*)TrackNum) < 0 || EBML_IntegerValue((ebml_integer*)TrackNum) >= 0x4000)
+            continue;
+        Num = (size_t)EBML_IntegerValue((ebml_integer*)TrackNum);
+        Count = ARRAYCOUNT(Map->Tracks,matroska_track_info);
+        if (Num >= Count)
+        {
+            if (!ArrayResize(&Map->Tracks,(Num+1)*sizeof(matroska_track_info),0))
+            {
+                ArrayClear(&Map->Tracks);
+                return ERR_OUT_OF_MEMORY;
+            }
+            memset(ARRAYBEGIN(Map->Tracks,matroska_track_info)+Count,0,(Num+1-Count)*sizeof(matroska_track_info));
+        }
+        Info = ARRAYBEGIN(Map->Tracks,matroska_track_info)+Num;
+        if (Info->TrackEntry)
+            continue;
+
+        Info->TrackEntry = Track;
+        Info->CodecID = (ebml_string*)EBML_MasterFindChild(Track,MATROSKA_getContextCodecID());
+        Elt = (ebml_master*)EBML_MasterFindChild(Track,MATROSKA_getContextTrackType());
+        Info->TrackType = Elt ? (int)EBML_IntegerValue((ebml_integer*)Elt) : 0;
+        Elt = (ebml_master*)EBML_MasterFindChild(Track,MATROSKA_getContextFlagLacing());
+        Info->Lacing = Elt ? EBML_IntegerValue((ebml_integer*)Elt)!=0 : 1;
+        Elt = (ebml_master*)EBML_MasterFindChild(Track,MATROSKA_getContextDefaultDuration());
+        Info->DefaultDuration = Elt ? EBML_IntegerValue((ebml_integer*)Elt) : INVALID_TIMESTAMP_T;
+        Info->EncodingScope = 0;
+        Elt = (ebml_master*)EBML_MasterFindChild(Track,MATROSKA_getContextContentEncodings());
+        if (Elt)
+            Elt = (ebml_master*)EBML_MasterFindChild(Elt,MATROSKA_getContextContentEncoding());
+        if (Elt)
+        {
+            Elt = (ebml_master*)EBML_MasterFindChild(Elt,MATROSKA_getContextContentEncodingScope());
+            Info->EncodingScope = Elt ? (int)EBML_IntegerValue((ebml_integer*)Elt) : MATROSKA_CONTENTENCODINGSCOPE_BLOCK;
+        }
+    }
+    return ERR_NONE;
+}
+
+void MATROSKA_TrackMapClear(matroska_track_map *Map)
+{
+    ArrayClear(&Map->Tracks);
+}
+
+const matroska_track_info *MATROSKA_TrackMapGet(const matroska_track_map *Map, uint16_t TrackNum)
+{
+    const matroska_track_info *Info;
+    if (TrackNum >= ARRAYCOUNT(Map->Tracks,matroska_track_info))
+        return NULL;
+    Info = ARRAYBEGIN(Map->Tracks,matroska_track_info)+TrackNum;
+    return Info->TrackEntry ? Info : NULL;
+}
+
+err_t MATROSKA_LinkBlockWithTrackMap(matroska_block *Block, const matroska_track_map *Map, bool_t UseForWriteToo, int ForProfile)
+{
+    const matroska_track_info *Info = MATROSKA_TrackMapGet(Map, Block->TrackNumber);
+    ebml_master *Track;
+    bool_t WasLinked = Block->ReadTrack!=NULL;
+
+    assert(Node_IsPartOf(Block,MATROSKA_BLOCK_CLASS));
+    if (!Info)
+        return ERR_INVALID_DATA;
+    Track = Info->TrackEntry;
+    Node_SET(Block,MATROSKA_BLOCK_READ_TRACK,&Track);
+#if defined(CONFIG_EBML_WRITING)
+    if (UseForWriteToo)
+        Node_SET(Block,MATROSKA_BLOCK_WRITE_TRACK,&Track);
+#endif
+    if (WasLinked)
+        return ERR_NONE;
+    return CheckCompression(Block, ForProfile);
+}
+
 #if defined(CONFIG_EBML_WRITING)
 err_t MATROSKA_LinkBlockWithWriteTracks(matroska_block *Block, ebml_master *Tracks, int ForProfile)
 {
@@ -753,10 +878,10 @@ filepos_t MATROSKA_CuePosInSegment(const matroska_cuepoint *Cue)
     assert(EBML_ElementIsType((ebml_element*)Cue, MATROSKA_getContextCuePoint()));
     Timestamp = EBML_MasterFindChild((ebml_master*)Cue,MATROSKA_getContextCueTrackPositions());
     if (!Timestamp)
-        return INVALID_TIMESTAMP_T;
+        return INVALID_FILEPOS_T;
     Timestamp = EBML_MasterFindChild((ebml_master*)Timestamp,MATROSKA_getContextCueClusterPosition());
     if (!Timestamp)
-        return INVALID_TIMESTAMP_T;
+        return INVALID_FILEPOS_T;
     return EBML_IntegerValue((ebml_integer*)Timestamp);
 }
 
@@ -830,13 +955,96 @@ matroska_block *MATROSKA_GetBlockForTimestamp(matroska_cluster *Cluster, mkv_tim
     return NULL;
 }
 
-void MATROSKA_LinkClusterBlocks(matroska_cluster *Cluster, ebml_master *RSegmentInfo, ebml_master *Tracks, bool_t KeepUnmatched, int ForProfile)
+static int CmpBlockIndex(const void* UNUSED_PARAM(Param), const matroska_block_index *a, const matroska_block_index *b)
 {
-    ebml_element *Block, *GBlock,*NextBlock;
+    if (a->Timestamp != b->Timestamp)
+        return a->Timestamp < b->Timestamp ? -1 : 1;
+    if (a->ClusterPosition != b->ClusterPosition)
+        return a->ClusterPosition < b->ClusterPosition ? -1 : 1;
+    if (a->BlockPosition != b->BlockPosition)
+        return a->BlockPosition < b->BlockPosition ? -1 : 1;
+    return 0;
+}
 
-	assert(Node_IsPartOf(Cluster,MATROSKA_CLUSTER_CLASS));
-	assert(EBML_ElementIsType((ebml_element*)RSegmentInfo, MATROSKA_getContextInfo()));
-	assert(EBML_ElementIsType((ebml_element*)Tracks, MATROSKA_getContextTracks()));
+static err_t IndexBlock(matroska_block *Block, const ebml_element *Elt, filepos_t ClusterPosition)
+{
+    matroska_block_index Entry;
+    matroska_trackentry *Track = (matroska_trackentry*)Block->ReadTrack;
+    if (!Track || EBML_ElementPosition(Elt) == INVALID_FILEPOS_T || !MATROSKA_BlockKeyframe(Block))
+        return ERR_NONE;
+    Entry.Timestamp = MATROSKA_BlockTimestamp(Block);
+    if (Entry.Timestamp == INVALID_TIMESTAMP_T)
+        return ERR_NONE;
+    Entry.ClusterPosition = ClusterPosition;
+    Entry.BlockPosition = EBML_ElementPosition(Elt) - ClusterPosition;
+    // the Blocks usually come in order, the insertion is then at the end
+    if (ArrayAdd(&Track->BlockIndex,matroska_block_index,&Entry,(arraycmp)CmpBlockIndex,NULL,4096)<0)
+        return ERR_OUT_OF_MEMORY;
+    return ERR_NONE;
+}
+
+err_t MATROSKA_ClusterIndexBlocks(matroska_cluster *Cluster)
+{
+    ebml_element *Block, *GBlock;
+    filepos_t ClusterPosition = EBML_ElementPosition((ebml_element*)Cluster);
+    err_t Err = ERR_NONE;
+
+    assert(Node_IsPartOf(Cluster,MATROSKA_CLUSTER_CLASS));
+    if (ClusterPosition == INVALID_FILEPOS_T)
+        return ERR_INVALID_PARAM;
+
+    for (Block = EBML_MasterChildren(Cluster);Block && Err==ERR_NONE;Block=EBML_MasterNext(Block))
+    {
+        if (EBML_ElementIsType(Block, MATROSKA_getContextBlockGroup()))
+        {
+            GBlock = EBML_MasterFindChild(Block, MATROSKA_getContextBlock());
+            if (GBlock)
+                Err = IndexBlock((matroska_block*)GBlock, Block, ClusterPosition);
+        }
+        else if (EBML_ElementIsType(Block, MATROSKA_getContextSimpleBlock()))
+            Err = IndexBlock((matroska_block*)Block, Block, ClusterPosition);
+    }
+    return Err;
+}
+
+const matroska_block_index *MATROSKA_TrackFindBlock(const matroska_trackentry *TrackEntry, mkv_timestamp_t Timestamp, filepos_t ClusterPosition)
+{
+    matroska_block_index Key;
+    const matroska_block_index *Entry;
+    bool_t Found;
+    intptr_t Pos;
+
+    assert(Node_IsPartOf(TrackEntry, MATROSKA_TRACKENTRY_CLASS));
+    Key.Timestamp = Timestamp;
+    Key.ClusterPosition = ClusterPosition; // INVALID_FILEPOS_T sorts before any indexed Cluster
+    Key.BlockPosition = 0;
+    Pos = ArrayFind(&TrackEntry->BlockIndex,matroska_block_index,&Key,(arraycmp)CmpBlockIndex,NULL,&Found);
+    if (Pos >= (intptr_t)ARRAYCOUNT(TrackEntry->BlockIndex,matroska_block_index))
+        return NULL;
+    Entry = ARRAYBEGIN(TrackEntry->BlockIndex,matroska_block_index) + Pos;
+    if (Entry->Timestamp != Timestamp)
+        return NULL;
+    if (ClusterPosition != INVALID_FILEPOS_T && Entry->ClusterPosition != ClusterPosition)
+        return NULL;
+    return Entry;
+}
+
+void MATROSKA_TrackClearBlockIndex(matroska_trackentry *TrackEntry)
+{
+    assert(Node_IsPartOf(TrackEntry, MATROSKA_TRACKENTRY_CLASS));
+    ArrayClear(&TrackEntry->BlockIndex);
+}
+
+static err_t LinkBlockReadTrack(matroska_block *Block, ebml_master *Tracks, const matroska_track_map *Map, int ForProfile)
+{
+    if (Map)
+        return MATROSKA_LinkBlockWithTrackMap(Block,Map,1,ForProfile);
+    return MATROSKA_LinkBlockWithReadTracks(Block,Tracks,1,ForProfile);
+}
+
+static void LinkClusterBlocks(matroska_cluster *Cluster, ebml_master *RSegmentInfo, ebml_master *Tracks, const matroska_track_map *Map, bool_t KeepUnmatched, int ForProfile)
+{
+    ebml_element *Block, *GBlock,*NextBlock;
 
 	// link each Block/SimpleBlock with its Track and SegmentInfo
 	MATROSKA_LinkClusterReadSegmentInfo(Cluster,RSegmentInfo,1);
@@ -849,7 +1057,7 @@ void MATROSKA_LinkClusterBlocks(matroska_cluster *Cluster, ebml_master *RSegment
 			{
 				if (EBML_ElementIsType(GBlock, MATROSKA_getContextBlock()))
 				{
-					if (MATROSKA_LinkBlockWithReadTracks((matroska_block*)GBlock,Tracks,1,ForProfile)!=ERR_NONE && !KeepUnmatched)
+					if (LinkBlockReadTrack((matroska_block*)GBlock,Tracks,Map,ForProfile)!=ERR_NONE && !KeepUnmatched)
                         NodeDelete((node*)Block);
                     else
 					    MATROSKA_LinkBlockReadSegmentInfo((matroska_block*)GBlock,RSegmentInfo,1);
@@ -859,7 +1067,7 @@ void MATROSKA_LinkClusterBlocks(matroska_cluster *Cluster, ebml_master *RSegment
 		}
 		else if (EBML_ElementIsType(Block, MATROSKA_getContextSimpleBlock()))
 		{
-			if (MATROSKA_LinkBlockWithReadTracks((matroska_block*)Block,Tracks,1,ForProfile)!=ERR_NONE && !KeepUnmatched)
+			if (LinkBlockReadTrack((matroska_block*)Block,Tracks,Map,ForProfile)!=ERR_NONE && !KeepUnmatched)
                 NodeDelete((node*)Block);
             else
     			MATROSKA_LinkBlockReadSegmentInfo((matroska_block*)Block,RSegmentInfo,1);
@@ -867,6 +1075,30 @@ void MATROSKA_LinkClusterBlocks(matroska_cluster *Cluster, ebml_master *RSegment
 	}
 }
 
+void MATROSKA_LinkClusterBlocks(matroska_cluster *Cluster, ebml_master *RSegmentInfo, ebml_master *Tracks, bool_t KeepUnmatched, int ForProfile)
+{
+    matroska_track_map Map;
+
+	assert(Node_IsPartOf(Cluster,MATROSKA_CLUSTER_CLASS));
+	assert(EBML_ElementIsType((ebml_element*)RSegmentInfo, MATROSKA_getContextInfo()));
+	assert(EBML_ElementIsType((ebml_element*)Tracks, MATROSKA_getContextTracks()));
+
+    // one TrackEntry lookup per Block instead of a scan of the Tracks
+    ArrayInit(&Map.Tracks);
+    if (MATROSKA_TrackMapBuild(&Map,Tracks)==ERR_NONE)
+        LinkClusterBlocks(Cluster,RSegmentInfo,Tracks,&Map,KeepUnmatched,ForProfile);
+    else
+        LinkClusterBlocks(Cluster,RSegmentInfo,Tracks,NULL,KeepUnmatched,ForProfile);
+    MATROSKA_TrackMapClear(&Map);
+}
+
+void MATROSKA_LinkClusterBlocksWithMap(matroska_cluster *Cluster, ebml_master *RSegmentInfo, const matroska_track_map *Map, bool_t KeepUnmatched, int ForProfile)
+{
+	assert(Node_IsPartOf(Cluster,MATROSKA_CLUSTER_CLASS));
+	assert(EBML_ElementIsType((ebml_element*)RSegmentInfo, MATROSKA_getContextInfo()));
+    LinkClusterBlocks(Cluster,RSegmentInfo,NULL,Map,KeepUnmatched,ForProfile);
+}
+
 
 static size_t GetBlockHeadSize(const matroska_block *Element)
 {
@@ -882,6 +1114,9 @@ err_t MATROSKA_BlockReleaseData(matroska_block *Block, bool_t IncludingNotRead)
     if (!IncludingNotRead && Block->GlobalTimestamp==INVALID_TIMESTAMP_T)
         return ERR_NONE;
     ArrayClear(&Block->Data);
+#if defined(CONFIG_EBML_WRITING)
+    BlockClearCompressed(Block);
+#endif
     Block->Base.Base.bValueIsSet = 0;
     if (ARRAYCOUNT(Block->SizeListIn,int32_t))
     {
@@ -914,8 +1149,158 @@ err_t MATROSKA_BlockSkipToFrame(const matroska_block *Block, stream *Input, size
 	return ERR_NONE;
 }
 
-// TODO: support zero copy reading (read the frames directly into a buffer with a callback per frame)
-//       pass the Input stream and the amount to read per frame, give the timestamp of the frame and get the end timestamp in return, get an error code if reading failed
+#if defined(CONFIG_ZLIB) || defined(CONFIG_LZO1X) || defined(CONFIG_BZLIB)
+#define UNCOMPRESS_MAX_GUESS  (16*1024*1024)
+
+static size_t UnCompressGuess(const matroska_trackentry *Track, size_t InSize)
+{
+    uint64_t Guess;
+    if (!Track->UnCompressRatio)
+        return max(InSize << 2, 1024);
+    Guess = (((uint64_t)InSize * Track->UnCompressRatio) >> 4) + 64;
+    return (size_t)min(Guess, UNCOMPRESS_MAX_GUESS);
+}
+
+// append the uncompressed frame in Out at *OutPos, *OutPos is moved after it
+static err_t UnCompressFrame(matroska_trackentry *Track, int Algo, const uint8_t *InBuf, size_t InSize, array *Out, size_t *OutPos)
+{
+    size_t Start = *OutPos;
+    size_t Room = UnCompressGuess(Track, InSize);
+    err_t Err = ERR_INVALID_DATA;
+
+#if defined(CONFIG_ZLIB)
+    if (Algo==MATROSKA_TRACK_ENCODING_COMP_ZLIB)
+    {
+        int Res;
+        if (!Track->InflateReady)
+        {
+            memset(&Track->Inflate,0,sizeof(Track->Inflate));
+            if (inflateInit(&Track->Inflate) != Z_OK)
+                return ERR_INVALID_DATA;
+            Track->InflateReady = 1;
+        }
+        else if (inflateReset(&Track->Inflate) != Z_OK)
+            return ERR_INVALID_DATA;
+
+        Track->Inflate.next_in = (Bytef*)InBuf;
+        Track->Inflate.avail_in = (uInt)InSize;
+        do {
+            if (!ArrayResize(Out, *OutPos + Room, 0))
+            {
+                Res = Z_MEM_ERROR;
+                break;
+            }
+            Track->Inflate.next_out = ARRAYBEGIN(*Out,uint8_t) + *OutPos;
+            Track->Inflate.avail_out = (uInt)Room;
+            Res = inflate(&Track->Inflate, Z_NO_FLUSH);
+            *OutPos = Track->Inflate.next_out - ARRAYBEGIN(*Out,uint8_t);
+            Room = *OutPos - Start; // double the room each time
+        } while (Res==Z_OK && !Track->Inflate.avail_out);
+        if (Res==Z_STREAM_END)
+            Err = ERR_NONE;
+        else if (Res==Z_MEM_ERROR)
+            Err = ERR_OUT_OF_MEMORY;
+    }
+#endif
+#if defined(CONFIG_LZO1X)
+    if (Algo==MATROSKA_TRACK_ENCODING_COMP_LZO1X && MATROSKA_LzoReady)
+    {
+        lzo_uint outSize;
+        int Res;
+        do {
+            if (!ArrayResize(Out, Start + Room, 0))
+                return ERR_OUT_OF_MEMORY;
+            outSize = Room;
+            Res = lzo1x_decompress_safe(InBuf, InSize, ARRAYBEGIN(*Out,uint8_t) + Start, &outSize, NULL);
+            Room <<= 1;
+        } while (Res==LZO_E_OUTPUT_OVERRUN);
+        if (Res==LZO_E_OK)
+        {
+            *OutPos = Start + outSize;
+            Err = ERR_NONE;
+        }
+    }
+#endif
+#if defined(CONFIG_BZLIB)
+    if (Algo==MATROSKA_TRACK_ENCODING_COMP_BZLIB)
+    {
+        // libbz2 can't reset a stream, it has to be created for each frame
+        bz_stream stream;
+        int Res;
+        memset(&stream,0,sizeof(stream));
+        if (BZ2_bzDecompressInit(&stream, 0, 1) != BZ_OK)
+            return ERR_INVALID_DATA;
+        stream.next_in = (char*)InBuf;
+        stream.avail_in = (unsigned int)InSize;
+        do {
+            if (!ArrayResize(Out, *OutPos + Room, 0))
+            {
+                Res = BZ_MEM_ERROR;
+                break;
+            }
+            stream.next_out = ARRAYBEGIN(*Out,char) + *OutPos;
+            stream.avail_out = (unsigned int)Room;
+            Res = BZ2_bzDecompress(&stream);
+            *OutPos = stream.next_out - ARRAYBEGIN(*Out,char);
+            Room = *OutPos - Start;
+        } while (Res==BZ_OK && !stream.avail_out);
+        BZ2_bzDecompressEnd(&stream);
+        if (Res==BZ_STREAM_END)
+            Err = ERR_NONE;
+        else if (Res==BZ_MEM_ERROR)
+            Err = ERR_OUT_OF_MEMORY;
+    }
+#endif
+
+    if (Err==ERR_NONE && InSize)
+        Track->UnCompressRatio = (uint32_t)min((((*OutPos - Start) << 4) / InSize) + 1, 0xFFFF);
+    return Err;
+}
+
+static err_t BlockUnCompress(matroska_block *Element, stream *Input, int Algo)
+{
+    matroska_trackentry *Track = (matroska_trackentry*)Element->ReadTrack;
+    const uint8_t *InBuf;
+    size_t NumFrame, Read, FrameSize, FrameStart, OutPos = 0, BufSize = 0;
+    bool_t InPlace;
+    err_t Err;
+
+    assert(Node_IsPartOf(Track,MATROSKA_TRACKENTRY_CLASS));
+    for (NumFrame=0;NumFrame<ARRAYCOUNT(Element->SizeList,int32_t);++NumFrame)
+        BufSize += ARRAYBEGIN(Element->SizeList,int32_t)[NumFrame];
+
+    // use the mapped or buffered input in place when possible
+    InPlace = Stream_Peek(Input,&InBuf,BufSize) == ERR_NONE;
+    if (!InPlace)
+    {
+        if (!ArrayResize(&Track->Compressed,BufSize,0))
+            return ERR_OUT_OF_MEMORY;
+        InBuf = ARRAYBEGIN(Track->Compressed,uint8_t);
+        Err = Stream_Read(Input,ARRAYBEGIN(Track->Compressed,uint8_t),BufSize,&Read);
+        if (Err==ERR_NONE && Read!=BufSize)
+            Err = ERR_READ;
+        if (Err != ERR_NONE)
+            return Err;
+    }
+
+    Err = ERR_NONE;
+    for (NumFrame=0;Err==ERR_NONE && NumFrame<ARRAYCOUNT(Element->SizeList,int32_t);++NumFrame)
+    {
+        FrameSize = ARRAYBEGIN(Element->SizeList,int32_t)[NumFrame];
+        FrameStart = OutPos;
+        Err = UnCompressFrame(Track,Algo,InBuf,FrameSize,&Element->Data,&OutPos);
+        ARRAYBEGIN(Element->SizeList,int32_t)[NumFrame] = (int32_t)(OutPos - FrameStart);
+        InBuf += FrameSize;
+    }
+    ArrayResize(&Element->Data, OutPos, 0); // shrink the buffer
+
+    if (InPlace && Stream_Seek(Input,BufSize,SEEK_CUR)==INVALID_FILEPOS_T && Err==ERR_NONE)
+        Err = ERR_READ;
+    return Err;
+}
+#endif
+
+// use MATROSKA_BlockVisitFrames() or MATROSKA_BlockReadFrame() to get the frames without copying them in the Block
 err_t MATROSKA_BlockReadData(matroska_block *Element, stream *Input, int ForProfile)
 {
     size_t Read,BufSize;
@@ -984,130 +1369,7 @@ err_t MATROSKA_BlockReadData(matroska_block *Element, stream *Input, int ForProf
         case LACING_NONE:
 #if defined(CONFIG_ZLIB) || defined(CONFIG_LZO1X) || defined(CONFIG_BZLIB)
             if (Header && Header->Context==MATROSKA_getContextContentCompAlgo())
-            {
-                // zlib handling, read the buffer in temp memory
-                array TmpBuf;
-                ArrayInit(&TmpBuf);
-                if (!ArrayResize(&TmpBuf,(size_t)ARRAYBEGIN(Element->SizeList,int32_t)[0],0))
-                    Err = ERR_OUT_OF_MEMORY;
-                InBuf = ARRAYBEGIN(TmpBuf,uint8_t);
-                Err = Stream_Read(Input,InBuf,(size_t)ARRAYBEGIN(Element->SizeList,int32_t)[0],&Read);
-                if (Err==ERR_NONE)
-                {
-                    if (Read!=(size_t)ARRAYBEGIN(Element->SizeList,int32_t)[0])
-                        Err = ERR_READ;
-                    else
-                    {
-#if defined(CONFIG_ZLIB)
-                        if (EBML_IntegerValue((ebml_integer*)Header)==MATROSKA_TRACK_ENCODING_COMP_ZLIB)
-                        {
-                            // get the ouput size, adjust the Element->SizeList value, write in Element->Data
-                            z_stream stream;
-                            int Res;
-                            memset(&stream,0,sizeof(stream));
-                            Res = inflateInit(&stream);
-                            if (Res != Z_OK)
-                                Err = ERR_INVALID_DATA;
-                            else
-                            {
-                                size_t Count = 0;
-                                stream.next_in = InBuf;
-                                stream.avail_in = ARRAYBEGIN(Element->SizeList,int32_t)[0];
-                                stream.next_out = ARRAYBEGIN(Element->Data,uint8_t);
-                                do {
-                                    Count = stream.next_out - ARRAYBEGIN(Element->Data,uint8_t);
-                                    stream.avail_out = 1024;
-                                    if (!ArrayResize(&Element->Data, Count + stream.avail_out, 0))
-                                    {
-                                        Res = Z_MEM_ERROR;
-                                        break;
-                                    }
-                                    stream.next_out = ARRAYBEGIN(Element->Data,uint8_t) + Count;
-                                    Res = inflate(&stream, Z_NO_FLUSH);
-                                    if (Res!=Z_STREAM_END && Res!=Z_OK)
-                                        break;
-                                } while (Res!=Z_STREAM_END && stream.avail_in && !stream.avail_out);
-                                ArrayResize(&Element->Data, stream.total_out, 0);
-                                ARRAYBEGIN(Element->SizeList,int32_t)[0] = stream.total_out;
-                                inflateEnd(&stream);
-                                if (Res != Z_STREAM_END)
-                                    Err = ERR_INVALID_DATA;
-                            }
-                        }
-#endif
-#if defined(CONFIG_LZO1X)
-                        if (EBML_IntegerValue((ebml_integer*)Header)==MATROSKA_TRACK_ENCODING_COMP_LZO1X)
-                        {
-                            if (lzo_init() != LZO_E_OK)
-                                Err = ERR_INVALID_DATA;
-                            else
-                            {
-                                lzo_uint outSize = max(2048, ARRAYBEGIN(Element->SizeList,int32_t)[0] << 2);
-                                if (!ArrayResize(&Element->Data, outSize, 0))
-                                    Err = ERR_OUT_OF_MEMORY;
-                                else
-                                {
-                                    if (lzo1x_decompress_safe(InBuf, ARRAYBEGIN(Element->SizeList,int32_t)[0], ARRAYBEGIN(Element->Data,uint8_t), &outSize, NULL) != LZO_E_OK)
-                                        Err = ERR_INVALID_DATA;
-                                    else
-                                    {
-                                        ARRAYBEGIN(Element->SizeList,int32_t)[0] = outSize;
-                                        ArrayResize(&Element->Data,outSize,0);
-                                    }
-                                }
-                            }
-                        }
-#endif
-#if defined(CONFIG_BZLIB)
-                        if (EBML_IntegerValue((ebml_integer*)Header)==MATROSKA_TRACK_ENCODING_COMP_BZLIB)
-                        {
-                            unsigned int outSize = ARRAYBEGIN(Element->SizeList,int32_t)[0] << 2;
-                            bz_stream strm;
-                            int Res;
-
-                            if (!ArrayResize(&Element->Data, outSize, 0))
-                                Err = ERR_OUT_OF_MEMORY;
-                            else
-                            {
-                               strm.bzalloc = NULL;
-                               strm.bzfree = NULL;
-                               strm.opaque = NULL;
-                               if (BZ2_bzDecompressInit (&strm, 0, 1) != BZ_OK)
-                                   Err = ERR_INVALID_DATA;
-                               else
-                               {
-                                    size_t Count = 0;
-                                    strm.next_in = (char*)InBuf;
-                                    strm.avail_in = ARRAYBEGIN(Element->SizeList,int32_t)[0];
-                                    strm.next_out = ARRAYBEGIN(Element->Data,char);
-                                    strm.avail_out = 0;
-
-                                    do {
-                                        Count = strm.next_out - ARRAYBEGIN(Element->Data,char);
-                                        strm.avail_out = 1024;
-                                        if (!ArrayResize(&Element->Data, Count + strm.avail_out, 0))
-                                        {
-                                            Res = BZ_MEM_ERROR;
-                                            break;
-                                        }
-                                        strm.next_out = ARRAYBEGIN(Element->Data,char) + Count;
-                                        Res = BZ2_bzDecompress(&strm);
-                                        if (Res!=BZ_STREAM_END && Res!=BZ_OK)
-                                            break;
-                                    } while (Res!=BZ_STREAM_END && strm.avail_in && !strm.avail_out);
-                                    ArrayResize(&Element->Data, strm.total_out_lo32, 0);
-                                    ARRAYBEGIN(Element->SizeList,int32_t)[0] = strm.total_out_lo32;
-                                    BZ2_bzDecompressEnd(&strm);
-                                    if (Res != BZ_STREAM_END)
-                                        Err = ERR_INVALID_DATA;
-                                }
-                            }
-                        }
-#endif
-                    }
-                }
-                ArrayClear(&TmpBuf);
-            }
+                Err = BlockUnCompress(Element,Input,(int)EBML_IntegerValue((ebml_integer*)Header));
             else
 #endif
             {
@@ -1141,132 +1403,7 @@ err_t MATROSKA_BlockReadData(matroska_block *Element, stream *Input, int ForProf
                 BufSize += ARRAYBEGIN(Element->SizeList,int32_t)[NumFrame];
 #if defined(CONFIG_ZLIB) || defined(CONFIG_LZO1X) || defined(CONFIG_BZLIB)
             if (Header && Header->Context==MATROSKA_getContextContentCompAlgo())
-            {
-                // zlib handling, read the buffer in temp memory
-                // get the ouput size, adjust the Element->SizeList value, write in Element->Data
-                array TmpBuf;
-                int32_t FrameSize;
-                size_t OutSize = 0;
-
-                ArrayInit(&TmpBuf);
-                if (!ArrayResize(&TmpBuf,BufSize,0))
-                {
-                    Err = ERR_OUT_OF_MEMORY;
-                    goto failed;
-                }
-                InBuf = ARRAYBEGIN(TmpBuf,uint8_t);
-                Err = Stream_Read(Input,InBuf,BufSize,&Read);
-                if (Err != ERR_NONE || Read!=BufSize)
-                {
-                    if (Err==ERR_NONE)
-                        Err = ERR_READ;
-                    ArrayClear(&TmpBuf);
-                    goto failed;
-                }
-                for (NumFrame=0;Err==ERR_NONE && NumFrame<ARRAYCOUNT(Element->SizeList,int32_t);++NumFrame)
-                {
-#if defined(CONFIG_ZLIB)
-                    if (EBML_IntegerValue((ebml_integer*)Header)==MATROSKA_TRACK_ENCODING_COMP_ZLIB)
-                    {
-                        z_stream stream;
-                        int Res;
-                        memset(&stream,0,sizeof(stream));
-                        Res = inflateInit(&stream);
-                        if (Res != Z_OK)
-                            Err = ERR_INVALID_DATA;
-                        else
-                        {
-                            size_t Count;
-                            stream.next_in = InBuf;
-                            stream.avail_in = FrameSize = ARRAYBEGIN(Element->SizeList,int32_t)[NumFrame];
-                            stream.next_out = ARRAYBEGIN(Element->Data,uint8_t) + OutSize;
-                            do {
-                                Count = stream.next_out - ARRAYBEGIN(Element->Data,uint8_t);
-                                if (!ArrayResize(&Element->Data, Count + 1024, 0))
-                                {
-                                    Res = Z_MEM_ERROR;
-                                    break;
-                                }
-                                stream.avail_out = ARRAYCOUNT(Element->Data,uint8_t) - Count;
-                                stream.next_out = ARRAYBEGIN(Element->Data,uint8_t) + Count;
-                                Res = inflate(&stream, Z_NO_FLUSH);
-                                if (Res!=Z_STREAM_END && Res!=Z_OK)
-                                    break;
-                            } while (Res!=Z_STREAM_END && stream.avail_in && !stream.avail_out);
-                            ARRAYBEGIN(Element->SizeList,int32_t)[NumFrame] = stream.total_out;
-                            OutSize += stream.total_out;
-                            inflateEnd(&stream);
-                            if (Res != Z_STREAM_END)
-                                Err = ERR_INVALID_DATA;
-                        }
-                    }
-#endif
-#if defined(CONFIG_LZO1X)
-                    if (EBML_IntegerValue((ebml_integer*)Header)==MATROSKA_TRACK_ENCODING_COMP_LZO1X)
-                    {
-                        if (lzo_init() != LZO_E_OK)
-                            Err = ERR_INVALID_DATA;
-                        else
-                        {
-                            lzo_uint outSize = max(2048, ARRAYBEGIN(Element->SizeList,int32_t)[NumFrame] << 2);
-                            FrameSize = ARRAYBEGIN(Element->SizeList,int32_t)[NumFrame];
-                            if (!ArrayResize(&Element->Data, OutSize + outSize, 0))
-                                Err = ERR_OUT_OF_MEMORY;
-                            else
-                            {
-                                if (lzo1x_decompress_safe(InBuf, ARRAYBEGIN(Element->SizeList,int32_t)[NumFrame], ARRAYBEGIN(Element->Data,uint8_t) + OutSize, &outSize, NULL) != LZO_E_OK)
-                                    Err = ERR_INVALID_DATA;
-                                else
-                                {
-                                    OutSize += outSize;
-                                    ARRAYBEGIN(Element->SizeList,int32_t)[NumFrame] = outSize;
-                                    ArrayResize(&Element->Data,OutSize,0);
-                                }
-                            }
-                        }
-                    }
-#endif
-#if defined(CONFIG_BZLIB)
-                    if (EBML_IntegerValue((ebml_integer*)Header)==MATROSKA_TRACK_ENCODING_COMP_BZLIB)
-                    {
-                        bz_stream stream;
-                        int Res;
-                        memset(&stream,0,sizeof(stream));
-                        Res = BZ2_bzDecompressInit (&stream, 0, 1);
-                        if (Res != BZ_OK)
-                            Err = ERR_INVALID_DATA;
-                        else
-                        {
-                            size_t Count;
-                            stream.next_in = (char*)InBuf;
-                            stream.avail_in = FrameSize = ARRAYBEGIN(Element->SizeList,int32_t)[NumFrame];
-                            stream.next_out = ARRAYBEGIN(Element->Data,char) + OutSize;
-                            do {
-                                Count = stream.next_out - ARRAYBEGIN(Element->Data,char);
-                                if (!ArrayResize(&Element->Data, Count + 1024, 0))
-                                {
-                                    Res = BZ_MEM_ERROR;
-                                    break;
-                                }
-                                stream.avail_out = ARRAYCOUNT(Element->Data,uint8_t) - Count;
-                                stream.next_out = ARRAYBEGIN(Element->Data,char) + Count;
-                                Res = BZ2_bzDecompress(&stream);
-                                if (Res!=BZ_STREAM_END && Res!=BZ_OK)
-                                    break;
-                            } while (Res!=BZ_STREAM_END && stream.avail_in && !stream.avail_out);
-                            ARRAYBEGIN(Element->SizeList,int32_t)[NumFrame] = stream.total_out_lo32;
-                            OutSize += stream.total_out_lo32;
-                            BZ2_bzDecompressEnd(&stream);
-                            if (Res != BZ_STREAM_END)
-                                Err = ERR_INVALID_DATA;
-                        }
-                    }
-#endif
-                    InBuf += FrameSize;
-                }
-                ArrayResize(&Element->Data, OutSize, 0); // shrink the buffer
-                ArrayClear(&TmpBuf);
-            }
+                Err = BlockUnCompress(Element,Input,(int)EBML_IntegerValue((ebml_integer*)Header));
             else
 #endif
             {
@@ -1355,7 +1492,7 @@ static err_t SetBlockGroupParent(ebml_master *Element, void* Parent, void* Befor
 
 static err_t ReadBigBinaryData(ebml_binary *Element, stream *Input, const ebml_parser_context *ParserContext, bool_t AllowDummyElt, int Scope, size_t DepthCheckCRC)
 {
-    if (Scope == SCOPE_PARTIAL_DATA)
+    if (Scope == SCOPE_PARTIAL_DATA || Scope == SCOPE_SHALLOW_DATA)
     {
         EBML_ElementSkipData((ebml_element*)Element,Input,ParserContext,NULL,AllowDummyElt);
         return ERR_NONE;
@@ -1549,50 +1686,222 @@ err_t MATROSKA_BlockGetFrame(const matroska_block *Block, size_t FrameNum, matro
     return ERR_NONE;
 }
 
-err_t MATROSKA_BlockAppendFrame(matroska_block *Block, const matroska_frame *Frame, mkv_timestamp_t ClusterTimestamp)
+static err_t BlockStrippedHeader(const matroska_block *Block, const ebml_binary **Header)
 {
-    if (!Block->Base.Base.bValueIsSet && Frame->Timestamp!=INVALID_TIMESTAMP_T)
-        MATROSKA_BlockSetTimestamp(Block,Frame->Timestamp,ClusterTimestamp);
-    ArrayAppend(&Block->Data,Frame->Data,Frame->Size,0);
-    ArrayAppend(&Block->Durations,&Frame->Duration,sizeof(Frame->Duration),0);
-    ArrayAppend(&Block->SizeList,&Frame->Size,sizeof(Frame->Size),0);
-    Block->Base.Base.bValueIsSet = 1;
-    Block->Base.Base.bNeedDataSizeUpdate = 1;
-    Block->Lacing = LACING_AUTO;
+    ebml_element *Elt, *Elt2;
+    int Scope = MATROSKA_CONTENTENCODINGSCOPE_BLOCK;
+    int64_t Algo = MATROSKA_TRACK_ENCODING_COMP_ZLIB;
+
+    *Header = NULL;
+    if (!Block->ReadTrack)
+        return ERR_INVALID_PARAM;
+    Elt = EBML_MasterFindChild(Block->ReadTrack, MATROSKA_getContextContentEncodings());
+    if (Elt)
+        Elt = EBML_MasterFindChild((ebml_master*)Elt, MATROSKA_getContextContentEncoding());
+    if (!Elt || !EBML_MasterChildren(Elt))
+        return ERR_NONE;
+    if (EBML_MasterNext(Elt))
+        return ERR_NOT_SUPPORTED;
+
+    Elt2 = EBML_MasterFindChild((ebml_master*)Elt, MATROSKA_getContextContentEncodingScope());
+    if (Elt2)
+        Scope = (int)EBML_IntegerValue((ebml_integer*)Elt2);
+    Elt = EBML_MasterFindChild((ebml_master*)Elt, MATROSKA_getContextContentCompression());
+    if (!Elt)
+        return ERR_NOT_SUPPORTED;
+    Elt2 = EBML_MasterFindChild((ebml_master*)Elt, MATROSKA_getContextContentCompAlgo());
+    if (Elt2)
+        Algo = EBML_IntegerValue((ebml_integer*)Elt2);
+
+    // same rules as MATROSKA_BlockReadData
+    if (Algo == MATROSKA_TRACK_ENCODING_COMP_HEADERSTRIP)
+        *Header = (const ebml_binary*)EBML_MasterFindChild((ebml_master*)Elt, MATROSKA_getContextContentCompSettings());
+    else if (Scope & MATROSKA_CONTENTENCODINGSCOPE_BLOCK)
+        return ERR_NOT_SUPPORTED; // the frames need to be uncompressed
     return ERR_NONE;
 }
 
-#if defined(CONFIG_ZLIB)
-err_t UnCompressFrameZLib(const uint8_t *Cursor, size_t CursorSize, array *OutBuf, size_t *FrameSize, size_t *ArrayOffset)
+err_t MATROSKA_BlockVisitFrames(matroska_block *Block, stream *Input, matroska_frame_visitor Visitor, void *Cookie, int ForProfile)
 {
-    z_stream stream;
-    int Res;
+    matroska_frame_view Frame;
+    const ebml_binary *Header = NULL;
+    array Scratch;
+    size_t i, Read;
+    bool_t InPlace = 0;
     err_t Err = ERR_NONE;
 
-    memset(&stream,0,sizeof(stream));
-    Res = inflateInit(&stream);
-    if (Res != Z_OK)
-        Err = ERR_INVALID_DATA;
-    else
+    if (!Block->Base.Base.bValueIsSet)
     {
-        size_t Count;
-        stream.next_in = (Bytef*)Cursor;
-        stream.avail_in = CursorSize;
-        stream.next_out = ARRAYBEGIN(*OutBuf,uint8_t) + *ArrayOffset;
-        do {
-            Count = stream.next_out - ARRAYBEGIN(*OutBuf,uint8_t);
-            if (!ArrayResize(OutBuf, Count + 1024, 0))
-            {
-                Res = Z_MEM_ERROR;
-                break;
-            }
-            stream.avail_out = ARRAYCOUNT(*OutBuf,uint8_t) - Count;
-            stream.next_out = ARRAYBEGIN(*OutBuf,uint8_t) + Count;
-            Res = inflate(&stream, Z_NO_FLUSH);
-            if (Res!=Z_STREAM_END && Res!=Z_OK)
-                break;
-        } while (Res!=Z_STREAM_END && stream.avail_in && !stream.avail_out);
-        *FrameSize = stream.total_out;
+        Err = BlockStrippedHeader(Block,&Header);
+        if (Err == ERR_NOT_SUPPORTED)
+            Err = MATROSKA_BlockReadData(Block,Input,ForProfile); // uncompressed in Block->Data
+        if (Err != ERR_NONE)
+            return Err;
+    }
+
+    Frame.Head = Header ? ARRAYBEGIN(Header->Data,uint8_t) : NULL;
+    Frame.HeadSize = Header ? (uint32_t)Header->Base.DataSize : 0;
+    Frame.Data = ARRAYBEGIN(Block->Data,uint8_t);
+    Frame.Timestamp = MATROSKA_BlockTimestamp(Block);
+
+    if (!Block->Base.Base.bValueIsSet)
+    {
+        if (Block->FirstFrameLocation==0 || Stream_Seek(Input,Block->FirstFrameLocation,SEEK_SET)!=Block->FirstFrameLocation)
+            return ERR_READ;
+    }
+    else if (ARRAYCOUNT(Block->SizeList,int32_t) && !Frame.Data)
+        return ERR_READ;
+
+    ArrayInit(&Scratch);
+    for (i=0;Err==ERR_NONE && i<ARRAYCOUNT(Block->SizeList,int32_t);++i)
+    {
+        if (ARRAYBEGIN(Block->SizeList,uint32_t)[i] < Frame.HeadSize)
+        {
+            Err = ERR_INVALID_DATA;
+            break;
+        }
+        Frame.Size = ARRAYBEGIN(Block->SizeList,uint32_t)[i] - Frame.HeadSize;
+        if (i < ARRAYCOUNT(Block->Durations,mkv_timestamp_t))
+            Frame.Duration = ARRAYBEGIN(Block->Durations,mkv_timestamp_t)[i];
+        else
+            Frame.Duration = INVALID_TIMESTAMP_T;
+
+        if (!Block->Base.Base.bValueIsSet)
+        {
+            // use the mapped or buffered input in place when possible
+            Err = Stream_Peek(Input,&Frame.Data,Frame.Size);
+            InPlace = Err == ERR_NONE;
+            if (Err == ERR_NOT_SUPPORTED)
+            {
+                if (!ArrayResize(&Scratch,Frame.Size,0))
+                    Err = ERR_OUT_OF_MEMORY;
+                else
+                {
+                    Frame.Data = ARRAYBEGIN(Scratch,uint8_t);
+                    Err = Stream_Read(Input,ARRAYBEGIN(Scratch,uint8_t),Frame.Size,&Read);
+                    if (Err == ERR_NONE && Read != Frame.Size)
+                        Err = ERR_READ;
+                }
+            }
+            if (Err != ERR_NONE)
+                break;
+        }
+
+        Err = Visitor(Cookie,i,&Frame);
+
+        if (!Block->Base.Base.bValueIsSet)
+        {
+            // the view stays valid until the input moves
+            if (Err == ERR_NONE && InPlace && Stream_Seek(Input,Frame.Size,SEEK_CUR)==INVALID_FILEPOS_T)
+                Err = ERR_READ;
+        }
+        else
+            Frame.Data += Frame.Size;
+
+        if (Frame.Timestamp != INVALID_TIMESTAMP_T)
+            Frame.Timestamp = Frame.Duration != INVALID_TIMESTAMP_T ? Frame.Timestamp + Frame.Duration : INVALID_TIMESTAMP_T;
+    }
+    ArrayClear(&Scratch);
+    return Err;
+}
+
+err_t MATROSKA_BlockReadFrame(matroska_block *Block, stream *Input, size_t FrameNum, uint8_t *Dest, size_t DestSize, size_t *Size, int ForProfile)
+{
+    const ebml_binary *Header = NULL;
+    filepos_t SeekPos;
+    size_t i, HeadSize, Read;
+    err_t Err;
+
+    if (FrameNum >= ARRAYCOUNT(Block->SizeList,uint32_t))
+        return ERR_INVALID_PARAM;
+
+    if (!Block->Base.Base.bValueIsSet)
+    {
+        Err = BlockStrippedHeader(Block,&Header);
+        if (Err == ERR_NOT_SUPPORTED)
+            Err = MATROSKA_BlockReadData(Block,Input,ForProfile);
+        if (Err != ERR_NONE)
+            return Err;
+    }
+
+    *Size = ARRAYBEGIN(Block->SizeList,uint32_t)[FrameNum];
+    if (DestSize < *Size)
+        return ERR_BUFFER_FULL;
+
+    if (Block->Base.Base.bValueIsSet)
+    {
+        const uint8_t *Data = ARRAYBEGIN(Block->Data,uint8_t);
+        if (!Data)
+            return ERR_READ;
+        for (i=0;i<FrameNum;++i)
+            Data += ARRAYBEGIN(Block->SizeList,uint32_t)[i];
+        memcpy(Dest,Data,*Size);
+        return ERR_NONE;
+    }
+
+    HeadSize = Header ? (size_t)Header->Base.DataSize : 0;
+    if (*Size < HeadSize || Block->FirstFrameLocation==0)
+        return ERR_INVALID_DATA;
+    SeekPos = Block->FirstFrameLocation;
+    for (i=0;i<FrameNum;++i)
+        SeekPos += ARRAYBEGIN(Block->SizeList,uint32_t)[i] - HeadSize;
+    if (Stream_Seek(Input,SeekPos,SEEK_SET) != SeekPos)
+        return ERR_READ;
+
+    if (HeadSize)
+        memcpy(Dest,ARRAYBEGIN(Header->Data,uint8_t),HeadSize);
+    Err = Stream_Read(Input,Dest+HeadSize,*Size-HeadSize,&Read);
+    if (Err == ERR_NONE && Read != *Size-HeadSize)
+        Err = ERR_READ;
+    return Err;
+}
+
+err_t MATROSKA_BlockAppendFrame(matroska_block *Block, const matroska_frame *Frame, mkv_timestamp_t ClusterTimestamp)
+{
+    if (!Block->Base.Base.bValueIsSet && Frame->Timestamp!=INVALID_TIMESTAMP_T)
+        MATROSKA_BlockSetTimestamp(Block,Frame->Timestamp,ClusterTimestamp);
+    ArrayAppend(&Block->Data,Frame->Data,Frame->Size,0);
+#if defined(CONFIG_EBML_WRITING)
+    BlockClearCompressed(Block);
+#endif
+    ArrayAppend(&Block->Durations,&Frame->Duration,sizeof(Frame->Duration),0);
+    ArrayAppend(&Block->SizeList,&Frame->Size,sizeof(Frame->Size),0);
+    Block->Base.Base.bValueIsSet = 1;
+    Block->Base.Base.bNeedDataSizeUpdate = 1;
+    Block->Lacing = LACING_AUTO;
+    return ERR_NONE;
+}
+
+#if defined(CONFIG_ZLIB)
+err_t UnCompressFrameZLib(const uint8_t *Cursor, size_t CursorSize, array *OutBuf, size_t *FrameSize, size_t *ArrayOffset)
+{
+    z_stream stream;
+    int Res;
+    err_t Err = ERR_NONE;
+
+    memset(&stream,0,sizeof(stream));
+    Res = inflateInit(&stream);
+    if (Res != Z_OK)
+        Err = ERR_INVALID_DATA;
+    else
+    {
+        size_t Count = *ArrayOffset;
+        size_t Room = max(CursorSize << 2, 1024);
+        stream.next_in = (Bytef*)Cursor;
+        stream.avail_in = CursorSize;
+        do {
+            if (!ArrayResize(OutBuf, Count + Room, 0))
+            {
+                Res = Z_MEM_ERROR;
+                break;
+            }
+            stream.avail_out = (uInt)Room;
+            stream.next_out = ARRAYBEGIN(*OutBuf,uint8_t) + Count;
+            Res = inflate(&stream, Z_NO_FLUSH);
+            Count = stream.next_out - ARRAYBEGIN(*OutBuf,uint8_t);
+            Room = max(stream.total_out, 1024); // double the room each time
+        } while (Res==Z_OK && !stream.avail_out);
+        *FrameSize = stream.total_out;
         *ArrayOffset = *ArrayOffset + stream.total_out;
         inflateEnd(&stream);
         if (Res != Z_STREAM_END)
@@ -1643,6 +1952,197 @@ err_t CompressFrameZLib(const uint8_t *Cursor, size_t CursorSize, uint8_t **OutB
 
     return Err;
 }
+
+// compress all the frames of the Block in Block->Compressed, only touches the Block so it can run in any thread
+static err_t BlockDeflate(matroska_block *Block, int Level, int Strategy)
+{
+    z_stream stream;
+    const uint8_t *Cursor = ARRAYBEGIN(Block->Data,uint8_t);
+    size_t Frame, Pos = 0;
+    err_t Err = ERR_NONE;
+
+    memset(&stream,0,sizeof(stream));
+    if (deflateInit2(&stream, Level, Z_DEFLATED, MAX_WBITS, 8, Strategy)!=Z_OK)
+        return ERR_INVALID_DATA;
+    if (!ArrayResize(&Block->SizeListCompressed,ARRAYCOUNT(Block->SizeList,int32_t)*sizeof(int32_t),0))
+        Err = ERR_OUT_OF_MEMORY;
+    for (Frame=0;Err==ERR_NONE && Frame<ARRAYCOUNT(Block->SizeList,int32_t);++Frame)
+    {
+        uLong Size = ARRAYBEGIN(Block->SizeList,int32_t)[Frame];
+        // a single deflate() call with room for the worst case
+        if (!ArrayResize(&Block->Compressed,Pos + deflateBound(&stream,Size),0))
+        {
+            Err = ERR_OUT_OF_MEMORY;
+            break;
+        }
+        stream.next_in = (Bytef*)Cursor;
+        stream.avail_in = (uInt)Size;
+        stream.next_out = ARRAYBEGIN(Block->Compressed,uint8_t) + Pos;
+        stream.avail_out = (uInt)(ARRAYCOUNT(Block->Compressed,uint8_t) - Pos);
+        if (deflate(&stream, Z_FINISH)!=Z_STREAM_END)
+            Err = ERR_INVALID_DATA;
+        else
+        {
+            ARRAYBEGIN(Block->SizeListCompressed,int32_t)[Frame] = (int32_t)stream.total_out;
+            Pos += stream.total_out;
+            Cursor += Size;
+            deflateReset(&stream);
+        }
+    }
+    deflateEnd(&stream);
+
+    if (Err == ERR_NONE)
+        ArrayResize(&Block->Compressed,Pos,0);
+    else
+        BlockClearCompressed(Block);
+    return Err;
+}
+
+static bool_t BlockHasCompressed(const matroska_block *Block)
+{
+    return ARRAYCOUNT(Block->SizeListCompressed,int32_t) && ARRAYCOUNT(Block->SizeListCompressed,int32_t) == ARRAYCOUNT(Block->SizeList,int32_t);
+}
+
+static err_t BlockCompressForWrite(matroska_block *Block)
+{
+    const matroska_trackentry *Track = (const matroska_trackentry*)Block->WriteTrack;
+    if (BlockHasCompressed(Block) || !ARRAYCOUNT(Block->SizeList,int32_t))
+        return ERR_NONE;
+    assert(Node_IsPartOf(Track,MATROSKA_TRACKENTRY_CLASS));
+    return BlockDeflate(Block, Track->ZlibLevel, Track->ZlibStrategy);
+}
+
+// same checks as UpdateBlockSize() without adding missing elements to the track
+static bool_t TrackDeflatesBlocks(ebml_master *Track)
+{
+    ebml_element *Elt, *Elt2;
+    MatroskaContentEncodingScope Scope = MATROSKA_CONTENTENCODINGSCOPE_BLOCK;
+
+    Elt = EBML_MasterFindChild(Track, MATROSKA_getContextContentEncodings());
+    if (!Elt)
+        return 0;
+    Elt = EBML_MasterFindChild((ebml_master*)Elt, MATROSKA_getContextContentEncoding());
+    if (!EBML_MasterChildren(Elt) || EBML_MasterNext(Elt))
+        return 0;
+    Elt2 = EBML_MasterFindChild((ebml_master*)Elt, MATROSKA_getContextContentEncodingScope());
+    if (Elt2)
+        Scope = (int)EBML_IntegerValue((ebml_integer*)Elt2);
+    Elt = EBML_MasterFindChild((ebml_master*)Elt, MATROSKA_getContextContentCompression());
+    if (!Elt || !(Scope & MATROSKA_CONTENTENCODINGSCOPE_BLOCK))
+        return 0;
+    Elt2 = EBML_MasterFindChild((ebml_master*)Elt, MATROSKA_getContextContentCompAlgo());
+    return !Elt2 || EBML_IntegerValue((ebml_integer*)Elt2)==MATROSKA_TRACK_ENCODING_COMP_ZLIB;
+}
+
+typedef struct compress_pool
+{
+    array Blocks; // matroska_block*
+    size_t Next;
+    err_t Err;
+    void *Lock;
+} compress_pool;
+
+static int THREADCALL CompressPoolWorker(compress_pool *Pool)
+{
+    matroska_block *Block;
+    err_t Err;
+    for (;;)
+    {
+        LockEnter(Pool->Lock);
+        if (Pool->Next == ARRAYCOUNT(Pool->Blocks,matroska_block*))
+            Block = NULL;
+        else
+            Block = ARRAYBEGIN(Pool->Blocks,matroska_block*)[Pool->Next++];
+        LockLeave(Pool->Lock);
+        if (!Block)
+            break;
+
+        Err = BlockDeflate(Block, ((matroska_trackentry*)Block->WriteTrack)->ZlibLevel, ((matroska_trackentry*)Block->WriteTrack)->ZlibStrategy);
+        if (Err != ERR_NONE)
+        {
+            LockEnter(Pool->Lock);
+            if (Pool->Err == ERR_NONE)
+                Pool->Err = Err;
+            LockLeave(Pool->Lock);
+        }
+    }
+    return 0;
+}
+
+err_t MATROSKA_ClustersCompressFrames(matroska_cluster * const *Clusters, size_t Count, size_t UNUSED_PARAM(Threads))
+{
+    compress_pool Pool;
+    ebml_element *Elt, *GBlock;
+    matroska_block *Block;
+    size_t i;
+
+    memset(&Pool,0,sizeof(Pool));
+    ArrayInit(&Pool.Blocks);
+    for (i=0;i<Count;++i)
+    {
+        for (Elt = EBML_MasterChildren(Clusters[i]);Elt;Elt=EBML_MasterNext(Elt))
+        {
+            if (EBML_ElementIsType(Elt, MATROSKA_getContextSimpleBlock()))
+                Block = (matroska_block*)Elt;
+            else if (EBML_ElementIsType(Elt, MATROSKA_getContextBlockGroup()))
+            {
+                Block = NULL;
+                for (GBlock = EBML_MasterChildren(Elt);GBlock;GBlock=EBML_MasterNext(GBlock))
+                    if (EBML_ElementIsType(GBlock, MATROSKA_getContextBlock()))
+                    {
+                        Block = (matroska_block*)GBlock;
+                        break;
+                    }
+                if (!Block)
+                    continue;
+            }
+            else
+                continue;
+
+            if (Block->Base.Base.bValueIsSet && Block->WriteTrack && !BlockHasCompressed(Block) && ARRAYCOUNT(Block->SizeList,int32_t) && TrackDeflatesBlocks(Block->WriteTrack))
+                ArrayAppend(&Pool.Blocks,&Block,sizeof(Block),256);
+        }
+    }
+
+#if defined(CONFIG_MULTITHREAD)
+    if (Threads == 0)
+        Threads = ThreadCPUCount();
+    if (Threads > ARRAYCOUNT(Pool.Blocks,matroska_block*))
+        Threads = ARRAYCOUNT(Pool.Blocks,matroska_block*);
+    if (Threads > 1)
+    {
+        array Workers;
+        void **Worker;
+        ArrayInit(&Workers);
+        Pool.Lock = LockCreate();
+        if (Pool.Lock && ArrayResize(&Workers,(Threads-1)*sizeof(void*),0))
+        {
+            // this thread is the last worker
+            for (Worker=ARRAYBEGIN(Workers,void*);Worker!=ARRAYEND(Workers,void*);++Worker)
+                *Worker = ThreadCreate((threadfunc)CompressPoolWorker,&Pool);
+            CompressPoolWorker(&Pool);
+            for (Worker=ARRAYBEGIN(Workers,void*);Worker!=ARRAYEND(Workers,void*);++Worker)
+                ThreadJoin(*Worker,NULL);
+        }
+        ArrayClear(&Workers);
+        if (Pool.Lock)
+            LockDelete(Pool.Lock);
+        Pool.Lock = NULL;
+    }
+#endif
+    // whatever is left, when single threaded or if the threads could not start
+    CompressPoolWorker(&Pool);
+
+    ArrayClear(&Pool.Blocks);
+    return Pool.Err;
+}
+
+void MATROSKA_TrackSetCompressionZlibParams(matroska_trackentry *TrackEntry, int Level, int Strategy)
+{
+    assert(Node_IsPartOf(TrackEntry, MATROSKA_TRACKENTRY_CLASS));
+    TrackEntry->ZlibLevel = Level;
+    TrackEntry->ZlibStrategy = Strategy;
+}
 #endif // CONFIG_EBML_WRITING
 #endif // CONFIG_ZLIB
 
@@ -1659,6 +2159,10 @@ static filepos_t GetBlockFrameSize(const matroska_block *Element, size_t Frame,
         size_t OutSize;
         const int32_t *Size = ARRAYBEGIN(Element->SizeList,int32_t);
         const uint8_t *Data = ARRAYBEGIN(Element->Data,uint8_t);
+#if defined(CONFIG_EBML_WRITING) && defined(CONFIG_ZLIB)
+        if (BlockHasCompressed(Element))
+            return ARRAYBEGIN(Element->SizeListCompressed,int32_t)[Frame];
+#endif
         while (Frame)
         {
             Data += *Size;
@@ -1846,6 +2350,14 @@ static err_t RenderBlockData(matroska_block *Element, stream *Output, bool_t bFo
         Err = ERR_NOT_SUPPORTED;
         goto failed;
     }
+#else
+    if (Header && Header->Context==MATROSKA_getContextContentCompAlgo() && (CompressionScope & MATROSKA_CONTENTENCODINGSCOPE_BLOCK))
+    {
+        // the lace sizes are the compressed ones
+        Err = BlockCompressForWrite(Element);
+        if (Err != ERR_NONE)
+            goto failed;
+    }
 #endif
 
     if (Element->Lacing == LACING_AUTO)
@@ -1906,34 +2418,9 @@ static err_t RenderBlockData(matroska_block *Element, stream *Output, bool_t bFo
         if (Header && Header->Context==MATROSKA_getContextContentCompAlgo())
         {
 #if defined(CONFIG_ZLIB)
-            uint8_t *OutBuf;
-            array TmpBuf;
-            ArrayInit(&TmpBuf);
-            for (i=ARRAYBEGIN(Element->SizeList,int32_t);i!=ARRAYEND(Element->SizeList,int32_t);++i)
-            {
-                if (!ArrayResize(&TmpBuf,*i + 100,0))
-                {
-                    ArrayClear(&TmpBuf);
-                    Err = ERR_OUT_OF_MEMORY;
-                    break;
-                }
-                OutBuf = ARRAYBEGIN(TmpBuf,uint8_t);
-                ToWrite = ARRAYCOUNT(TmpBuf,uint8_t);
-                if (CompressFrameZLib(Cursor, *i, &OutBuf, &ToWrite) != ERR_NONE)
-                {
-                    ArrayClear(&TmpBuf);
-                    Err = ERR_OUT_OF_MEMORY;
-                    break;
-                }
-
-                Err = Stream_Write(Output,OutBuf,ToWrite,&Written);
-                ArrayClear(&TmpBuf);
-                if (Rendered)
-                    *Rendered += Written;
-                Cursor += *i;
-                if (Err!=ERR_NONE)
-                    break;
-            }
+            Err = Stream_Write(Output,ARRAYBEGIN(Element->Compressed,uint8_t),ARRAYCOUNT(Element->Compressed,uint8_t),&Written);
+            if (Rendered)
+                *Rendered += Written;
 #endif
         }
         else
@@ -2008,9 +2495,6 @@ static filepos_t UpdateBlockSize(matroska_block *Element, bool_t bWithDefault, b
         ebml_element *Header = NULL;
 #if defined(CONFIG_EBML_WRITING)
         ebml_element *Elt, *Elt2;
-        if (Element->Lacing == LACING_AUTO)
-            Element->Lacing = GetBestLacingType(Element,ForProfile);
-
         assert(Element->WriteTrack!=NULL);
         Elt = EBML_MasterFindChild(Element->WriteTrack, MATROSKA_getContextContentEncodings());
         if (Elt)
@@ -2041,6 +2525,14 @@ static filepos_t UpdateBlockSize(matroska_block *Element, bool_t bWithDefault, b
                     Header = EBML_MasterFindChild((ebml_master*)Elt, MATROSKA_getContextContentCompSettings());
             }
         }
+
+#if defined(CONFIG_ZLIB)
+        // the lacing and the size both need the compressed frames
+        if (Header && Header->Context==MATROSKA_getContextContentCompAlgo() && (CompressionScope & MATROSKA_CONTENTENCODINGSCOPE_BLOCK) && Element->Base.Base.bValueIsSet)
+            BlockCompressForWrite(Element);
+#endif
+        if (Element->Lacing == LACING_AUTO)
+            Element->Lacing = GetBestLacingType(Element,ForProfile);
 #else
         assert(Element->Lacing!=LACING_AUTO);
 #endif
@@ -2248,6 +2740,133 @@ matroska_cuepoint *MATROSKA_CuesGetTimestampStart(const ebml_element *Cues, mkv_
 	return Prev ? Prev : (matroska_cuepoint*)EBML_MasterChildren(Cues);
 }
 
+static int CmpCueIndex(const void* UNUSED_PARAM(Param), const matroska_cue_index *a, const matroska_cue_index *b)
+{
+    if (a->Timestamp != b->Timestamp)
+        return a->Timestamp < b->Timestamp ? -1 : 1;
+    if (a->TrackNum != b->TrackNum)
+        return a->TrackNum < b->TrackNum ? -1 : 1;
+    if (a->ClusterPosition != b->ClusterPosition)
+        return a->ClusterPosition < b->ClusterPosition ? -1 : 1;
+    return 0;
+}
+
+err_t MATROSKA_CuesBuildIndex(const ebml_master *Cues, array *Index)
+{
+    ebml_element *Cue, *Positions, *Elt;
+    matroska_cue_index Entry;
+
+    assert(EBML_ElementIsType((const ebml_element*)Cues, MATROSKA_getContextCues()));
+    ArrayClear(Index);
+    for (Cue=EBML_MasterChildren(Cues);Cue;Cue=EBML_MasterNext(Cue))
+    {
+        if (!EBML_ElementIsType(Cue, MATROSKA_getContextCuePoint()))
+            continue;
+        Entry.Timestamp = MATROSKA_CueTimestamp((matroska_cuepoint*)Cue);
+        if (Entry.Timestamp == INVALID_TIMESTAMP_T)
+            continue;
+        for (Positions=EBML_MasterFindChild((ebml_master*)Cue,MATROSKA_getContextCueTrackPositions());Positions;
+             Positions=EBML_MasterNextChild((ebml_master*)Cue,Positions))
+        {
+            Elt = EBML_MasterFindChild((ebml_master*)Positions,MATROSKA_getContextCueClusterPosition());
+            if (!Elt)
+                continue;
+            Entry.ClusterPosition = EBML_IntegerValue((ebml_integer*)Elt);
+            Elt = EBML_MasterFindChild((ebml_master*)Positions,MATROSKA_getContextCueRelativePosition());
+            Entry.RelativePosition = Elt ? EBML_IntegerValue((ebml_integer*)Elt) : INVALID_FILEPOS_T;
+            Elt = EBML_MasterFindChild((ebml_master*)Positions,MATROSKA_getContextCueTrack());
+            Entry.TrackNum = Elt ? (int16_t)EBML_IntegerValue((ebml_integer*)Elt) : -1;
+            if (!ArrayAppend(Index,&Entry,sizeof(Entry),4096))
+            {
+                ArrayClear(Index);
+                return ERR_OUT_OF_MEMORY;
+            }
+        }
+    }
+    // usually already in order, which is linear with this sort
+    ArraySort(Index,matroska_cue_index,(arraycmp)CmpCueIndex,NULL,0);
+    return ERR_NONE;
+}
+
+const matroska_cue_index *MATROSKA_CuesIndexGetTimestampStart(const array *Index, mkv_timestamp_t Timestamp)
+{
+    const matroska_cue_index *Entries = ARRAYBEGIN(*Index,matroska_cue_index);
+    const matroska_cue_index *Entry, *Found;
+    size_t Count = ARRAYCOUNT(*Index,matroska_cue_index);
+    size_t Lower = 0, Upper = Count, Mid;
+    bool_t Bisect = 0;
+
+    if (!Count || Timestamp==INVALID_TIMESTAMP_T)
+        return NULL;
+
+    // find the first entry after Timestamp in [Lower,Upper[
+    while (Lower < Upper)
+    {
+        if (Timestamp < Entries[Lower].Timestamp)
+            break;
+        if (Timestamp >= Entries[Upper-1].Timestamp)
+        {
+            Lower = Upper;
+            break;
+        }
+        // interpolate on the timestamps, with a bisection every other step for the worst case
+        if (Bisect)
+            Mid = Lower + (Upper-Lower)/2;
+        else
+            Mid = Lower + (size_t)((double)(Timestamp - Entries[Lower].Timestamp) * (Upper-1-Lower) /
+                                   (double)(Entries[Upper-1].Timestamp - Entries[Lower].Timestamp));
+        Bisect = !Bisect;
+        if (Entries[Mid].Timestamp <= Timestamp)
+            Lower = Mid+1;
+        else
+            Upper = Mid;
+    }
+
+    // the entries with the same timestamp are sorted by track, use the one with the earliest position
+    if (!Lower)
+        while (Lower < Count && Entries[Lower].Timestamp == Entries[0].Timestamp)
+            ++Lower;
+    Found = &Entries[Lower-1];
+    for (Entry=Found; Entry!=Entries && Entry[-1].Timestamp==Found->Timestamp;)
+    {
+        --Entry;
+        if (Entry->ClusterPosition < Found->ClusterPosition ||
+            (Entry->ClusterPosition == Found->ClusterPosition && Entry->RelativePosition < Found->RelativePosition))
+            Found = Entry;
+    }
+    return Found;
+}
+
+const matroska_cue_index *MATROSKA_SeekToTimestamp(stream *Input, const array *Index, filepos_t SegmentDataStart, mkv_timestamp_t Timestamp)
+{
+    uint8_t Head[EBML_MAX_ID + EBML_MAX_SIZE];
+    size_t Read, HeadSize;
+    uint8_t IdLength, SizeLength;
+    bool_t bSizeIsFinite;
+    fourcc_t Id;
+    filepos_t DataSize, ClusterPos, BlockPos;
+    const matroska_cue_index *Entry = MATROSKA_CuesIndexGetTimestampStart(Index, Timestamp);
+    if (!Entry)
+        return NULL;
+    ClusterPos = SegmentDataStart + Entry->ClusterPosition;
+    if (Stream_Seek(Input,ClusterPos,SEEK_SET) != ClusterPos)
+        return NULL;
+    if (Entry->RelativePosition == INVALID_FILEPOS_T)
+        return Entry;
+
+    // the Block is relative to the Cluster data, stay on the Cluster if its head doesn't match
+    Read = 0;
+    Stream_Read(Input,Head,sizeof(Head),&Read);
+    HeadSize = EBML_DecodeHead(Head,Read,&Id,&IdLength,&DataSize,&SizeLength,&bSizeIsFinite);
+    if (HeadSize && Id == MATROSKA_getContextCluster()->Id && (!bSizeIsFinite || Entry->RelativePosition < DataSize))
+        BlockPos = ClusterPos + HeadSize + Entry->RelativePosition;
+    else
+        BlockPos = ClusterPos;
+    if (Stream_Seek(Input,BlockPos,SEEK_SET) != BlockPos)
+        return NULL;
+    return Entry;
+}
+
 static bool_t ValidateSizeSegUID(const ebml_binary *p)
 {
     uint8_t test[16];
@@ -2265,12 +2884,211 @@ static err_t CreateBlock(matroska_block *p)
 	return ERR_NONE;
 }
 
+#if defined(CONFIG_EBML_WRITING)
+static void DeleteBlock(matroska_block *p)
+{
+    BlockClearCompressed(p);
+}
+#endif
+
 static err_t CreateCluster(matroska_cluster *p)
 {
 	p->GlobalTimestamp = INVALID_TIMESTAMP_T;
     return ERR_NONE;
 }
 
+static void DeleteCluster(matroska_cluster *p)
+{
+    ArrayClear(&p->ShallowBlocks);
+}
+
+static err_t ReadShallowBlockHead(const uint8_t *Data, size_t Avail, filepos_t DataSize, matroska_cluster_block *Block)
+{
+    size_t TrackSize;
+    // same track number limit as ReadBlockData()
+    if (Avail < 4 || DataSize < 4)
+        return ERR_INVALID_DATA;
+    if (Data[0] & 0x80)
+    {
+        TrackSize = 1;
+        Block->TrackNumber = Data[0] & 0x7F;
+    }
+    else if ((Data[0] & 0x40) && Avail >= 5 && DataSize >= 5)
+    {
+        TrackSize = 2;
+        Block->TrackNumber = ((Data[0] & 0x3F) << 8) + Data[1];
+    }
+    else
+        return ERR_INVALID_DATA;
+    Block->LocalTimestamp = (int16_t)LOAD16BE(Data + TrackSize);
+    Block->Flags = Data[TrackSize + 2];
+    return ERR_NONE;
+}
+
+static err_t ReadShallowBlock(stream *Input, filepos_t Pos, filepos_t End, matroska_cluster_block *Block)
+{
+    uint8_t Head[EBML_MAX_ID + EBML_MAX_SIZE + 5]; // element head and Block head
+    size_t Read, HeadSize;
+    uint8_t IdLength, SizeLength;
+    bool_t bSizeIsFinite;
+    fourcc_t Id;
+    filepos_t DataSize, GroupEnd;
+
+    Stream_Read(Input,Head,sizeof(Head),&Read);
+    HeadSize = EBML_DecodeHead(Head,Read,&Block->Id,&IdLength,&Block->DataSize,&SizeLength,&bSizeIsFinite);
+    if (!HeadSize || !bSizeIsFinite || (End != INVALID_FILEPOS_T && Pos + (filepos_t)HeadSize + Block->DataSize > End))
+        return ERR_INVALID_DATA;
+    Block->Position = Pos;
+    Block->HeadSize = (uint8_t)HeadSize;
+    if (Block->Id == MATROSKA_getContextSimpleBlock()->Id)
+        return ReadShallowBlockHead(Head + HeadSize, Read - HeadSize, Block->DataSize, Block);
+    if (Block->Id != MATROSKA_getContextBlockGroup()->Id)
+        return ERR_INVALID_DATA;
+
+    // use the head of the first Block in the BlockGroup
+    GroupEnd = Pos + HeadSize + Block->DataSize;
+    for (Pos += HeadSize; Pos < GroupEnd; Pos += HeadSize + DataSize)
+    {
+        if (Stream_Seek(Input,Pos,SEEK_SET) != Pos)
+            return ERR_INVALID_DATA;
+        Stream_Read(Input,Head,sizeof(Head),&Read);
+        HeadSize = EBML_DecodeHead(Head,Read,&Id,&IdLength,&DataSize,&SizeLength,&bSizeIsFinite);
+        if (!HeadSize || !bSizeIsFinite || Pos + (filepos_t)HeadSize + DataSize > GroupEnd)
+            return ERR_INVALID_DATA;
+        if (Id == MATROSKA_getContextBlock()->Id)
+            return ReadShallowBlockHead(Head + HeadSize, Read - HeadSize, DataSize, Block);
+    }
+    return ERR_INVALID_DATA;
+}
+
+static err_t ReadClusterShallow(matroska_cluster *Element, stream *Input, const ebml_parser_context *ParserContext, bool_t AllowDummyElt)
+{
+    ebml_parser_context Context;
+    ebml_element *SubElement;
+    matroska_cluster_block Block;
+    filepos_t Pos = EBML_ElementPositionData((ebml_element*)Element);
+    filepos_t End = EBML_ElementPositionEnd((ebml_element*)Element);
+    filepos_t StreamEnd, BlockEnd;
+    int UpperEltFound = 0;
+
+    NodeTree_Clear((nodetree*)Element);
+    Element->Base.Base.bValueIsSet = 0;
+    // don't record Blocks cut by the end of the file, seeking there would drop the read buffer
+    if (Node_GET(Input,STREAM_LENGTH,&StreamEnd) != ERR_NONE)
+        StreamEnd = INVALID_FILEPOS_T;
+    if (StreamEnd != INVALID_FILEPOS_T && (End == INVALID_FILEPOS_T || StreamEnd < End))
+        BlockEnd = StreamEnd;
+    else
+        BlockEnd = End;
+    if (Stream_Seek(Input,Pos,SEEK_SET)==INVALID_FILEPOS_T)
+        return ERR_END_OF_FILE;
+
+    Context.UpContext = ParserContext;
+    Context.Context = EBML_ElementContext((ebml_element*)Element);
+    Context.EndPosition = End;
+    Context.Profile = ParserContext->Profile;
+    while (End == INVALID_FILEPOS_T || Pos < End)
+    {
+        if (ReadShallowBlock(Input,Pos,BlockEnd,&Block) == ERR_NONE)
+        {
+            if (!ArrayAppend(&Element->ShallowBlocks,&Block,sizeof(Block),4096))
+                return ERR_OUT_OF_MEMORY;
+            Pos = Block.Position + Block.HeadSize + Block.DataSize;
+            if (Stream_Seek(Input,Pos,SEEK_SET) != Pos)
+                break;
+            continue;
+        }
+
+        // the other elements, or Blocks that don't look right, are read as usual
+        Stream_Seek(Input,Pos,SEEK_SET);
+        SubElement = EBML_FindNextElement(Input,&Context,&UpperEltFound,AllowDummyElt);
+        if (!SubElement)
+            break;
+        if (UpperEltFound > 0 || (EBML_ElementIsFiniteSize((ebml_element*)Element) && EBML_ElementPositionEnd(SubElement) > End))
+        {
+            // the next read starts from this element
+            Stream_Seek(Input,EBML_ElementPosition(SubElement),SEEK_SET);
+            NodeDelete((node*)SubElement);
+            break;
+        }
+        if (!AllowDummyElt && EBML_ElementIsDummy(SubElement))
+        {
+            EBML_ElementSkipData(SubElement,Input,&Context,NULL,AllowDummyElt);
+            NodeDelete((node*)SubElement);
+        }
+        else if (EBML_ElementReadData(SubElement,Input,&Context,AllowDummyElt,SCOPE_PARTIAL_DATA,0)==ERR_NONE)
+        {
+            EBML_MasterAppend((ebml_master*)Element,SubElement);
+            EBML_ElementSkipData(SubElement,Input,&Context,NULL,AllowDummyElt);
+        }
+        else
+            NodeDelete((node*)SubElement);
+        Pos = Stream_Seek(Input,0,SEEK_CUR);
+        if (Pos == INVALID_FILEPOS_T)
+            break;
+    }
+    Element->Base.Base.bValueIsSet = 1;
+    return ERR_NONE;
+}
+
+static err_t ReadClusterData(matroska_cluster *Element, stream *Input, const ebml_parser_context *ParserContext, bool_t AllowDummyElt, int Scope, size_t DepthCheckCRC)
+{
+    ArrayClear(&Element->ShallowBlocks);
+    if (Scope == SCOPE_SHALLOW_DATA)
+        return ReadClusterShallow(Element, Input, ParserContext, AllowDummyElt); // no CRC check without the whole data
+    return INHERITED(Element,ebml_element_vmt,MATROSKA_CLUSTER_CLASS)->ReadData(Element, Input, ParserContext, AllowDummyElt, Scope, DepthCheckCRC);
+}
+
+const matroska_cluster_block *MATROSKA_ClusterShallowBlocks(const matroska_cluster *Cluster, size_t *Count)
+{
+    assert(Node_IsPartOf(Cluster,MATROSKA_CLUSTER_CLASS));
+    *Count = ARRAYCOUNT(Cluster->ShallowBlocks,matroska_cluster_block);
+    return ARRAYBEGIN(Cluster->ShallowBlocks,matroska_cluster_block);
+}
+
+err_t MATROSKA_ClusterReadShallowBlock(matroska_cluster *Cluster, stream *Input, const ebml_parser_context *ParserContext, const matroska_cluster_block *Block, int Scope, ebml_element **Element)
+{
+    ebml_parser_context Context;
+    ebml_element *Elt, *Before;
+    int UpperEltFound = 0;
+    err_t Err;
+
+    assert(Node_IsPartOf(Cluster,MATROSKA_CLUSTER_CLASS));
+    *Element = NULL;
+    if (Stream_Seek(Input,Block->Position,SEEK_SET) != Block->Position)
+        return ERR_READ;
+    Context.UpContext = ParserContext;
+    Context.Context = EBML_ElementContext((ebml_element*)Cluster);
+    Context.EndPosition = EBML_ElementPositionEnd((ebml_element*)Cluster);
+    Context.Profile = ParserContext->Profile;
+    Elt = EBML_FindNextElement(Input,&Context,&UpperEltFound,0);
+    if (!Elt)
+        return ERR_INVALID_DATA;
+    if (UpperEltFound || EBML_ElementPosition(Elt) != Block->Position || EBML_ElementClassID(Elt) != Block->Id)
+    {
+        NodeDelete((node*)Elt);
+        return ERR_INVALID_DATA;
+    }
+    Err = EBML_ElementReadData(Elt,Input,&Context,0,Scope,0);
+    if (Err != ERR_NONE)
+    {
+        NodeDelete((node*)Elt);
+        return Err;
+    }
+
+    for (Before=EBML_MasterChildren(Cluster);Before;Before=EBML_MasterNext(Before))
+        if (EBML_ElementPosition(Before) > Block->Position)
+            break;
+    Err = NodeTree_SetParent(Elt,Cluster,Before);
+    if (Err != ERR_NONE)
+    {
+        NodeDelete((node*)Elt);
+        return Err;
+    }
+    *Element = Elt;
+    return ERR_NONE;
+}
+
 static err_t ReadTrackEntry(matroska_trackentry *Element, stream *Input, const ebml_parser_context *ParserContext, bool_t AllowDummyElt, int Scope, size_t DepthCheckCRC)
 {
     err_t Result = INHERITED(Element,ebml_element_vmt,MATROSKA_TRACKENTRY_CLASS)->ReadData(Element, Input, ParserContext, AllowDummyElt, Scope, DepthCheckCRC);
@@ -2366,10 +3184,42 @@ static matroska_trackentry *CopyTrackEntry(const matroska_trackentry *Element, c
 {
     matroska_trackentry *Result = (matroska_trackentry*)INHERITED(Element,ebml_element_vmt,MATROSKA_TRACKENTRY_CLASS)->Copy(Element, Cookie);
     if (Result)
+    {
         Result->CodecPrivateCompressed = Element->CodecPrivateCompressed;
+#if defined(CONFIG_EBML_WRITING) && defined(CONFIG_ZLIB)
+        Result->ZlibLevel = Element->ZlibLevel;
+        Result->ZlibStrategy = Element->ZlibStrategy;
+#endif
+    }
     return Result;
 }
 
+#if defined(CONFIG_EBML_WRITING) && defined(CONFIG_ZLIB)
+static err_t CreateTrackEntry(matroska_trackentry *p)
+{
+    p->ZlibLevel = Z_BEST_COMPRESSION;
+    p->ZlibStrategy = Z_DEFAULT_STRATEGY;
+    return ERR_NONE;
+}
+#endif
+
+static void DeleteTrackEntry(matroska_trackentry *Element)
+{
+#if defined(CONFIG_ZLIB)
+    if (Element->InflateReady)
+        inflateEnd(&Element->Inflate);
+#endif
+#if defined(CONFIG_ZLIB) || defined(CONFIG_LZO1X) || defined(CONFIG_BZLIB)
+    ArrayClear(&Element->Compressed);
+#endif
+    ArrayClear(&Element->BlockIndex);
+}
+
+matroska_frame_params *MATROSKA_TrackFrameParams(matroska_trackentry *TrackEntry)
+{
+    assert(Node_IsPartOf(TrackEntry, MATROSKA_TRACKENTRY_CLASS));
+    return &TrackEntry->FrameParams;
+}
 
 MatroskaTrackEncodingCompAlgo MATROSKA_TrackGetBlockCompression(const matroska_trackentry *TrackEntry, int ForProfile)
 {
@@ -2457,6 +3307,9 @@ bool_t MATROSKA_TrackSetCompressionNone(matroska_trackentry *TrackEntry)
 META_START(Matroska_Class,MATROSKA_BLOCK_CLASS)
 META_CLASS(SIZE,sizeof(matroska_block))
 META_CLASS(CREATE,CreateBlock)
+#if defined(CONFIG_EBML_WRITING)
+META_CLASS(DELETE,DeleteBlock)
+#endif
 META_VMT(TYPE_FUNC,nodetree_vmt,SetParent,SetBlockParent)
 META_VMT(TYPE_FUNC,ebml_element_vmt,ReadData,ReadBlockData)
 META_VMT(TYPE_FUNC,ebml_element_vmt,UpdateDataSize,UpdateBlockSize)
@@ -2474,7 +3327,7 @@ META_PARAM(TYPE,MATROSKA_BLOCK_READ_SEGMENTINFO,TYPE_NODE)
 META_DATA_UPDATE_CMP(TYPE_NODE_REF,MATROSKA_BLOCK_READ_SEGMENTINFO,matroska_block,ReadSegInfo,BlockTrackChanged)
 #if defined(CONFIG_EBML_WRITING)
 META_PARAM(TYPE,MATROSKA_BLOCK_WRITE_TRACK,TYPE_NODE)
-META_DATA_UPDATE_CMP(TYPE_NODE_REF,MATROSKA_BLOCK_WRITE_TRACK,matroska_block,WriteTrack,BlockTrackChanged)
+META_DATA_UPDATE_CMP(TYPE_NODE_REF,MATROSKA_BLOCK_WRITE_TRACK,matroska_block,WriteTrack,BlockWriteTrackChanged)
 META_PARAM(TYPE,MATROSKA_BLOCK_WRITE_SEGMENTINFO,TYPE_NODE)
 META_DATA_UPDATE_CMP(TYPE_NODE_REF,MATROSKA_BLOCK_WRITE_SEGMENTINFO,matroska_block,WriteSegInfo,BlockTrackChanged)
 #endif
@@ -2500,6 +3353,8 @@ META_END_CONTINUE(EBML_MASTER_CLASS)
 META_START_CONTINUE(MATROSKA_CLUSTER_CLASS)
 META_CLASS(SIZE,sizeof(matroska_cluster))
 META_CLASS(CREATE,CreateCluster)
+META_CLASS(DELETE,DeleteCluster)
+META_VMT(TYPE_FUNC,ebml_element_vmt,ReadData,ReadClusterData)
 META_PARAM(TYPE,MATROSKA_CLUSTER_READ_SEGMENTINFO,TYPE_NODE)
 META_DATA(TYPE_NODE_REF,MATROSKA_CLUSTER_READ_SEGMENTINFO,matroska_cluster,ReadSegInfo)
 META_PARAM(TYPE,MATROSKA_CLUSTER_WRITE_SEGMENTINFO,TYPE_NODE)
@@ -2514,6 +3369,10 @@ META_END_CONTINUE(EBML_MASTER_CLASS)
 
 META_START_CONTINUE(MATROSKA_TRACKENTRY_CLASS)
 META_CLASS(SIZE,sizeof(matroska_trackentry))
+#if defined(CONFIG_EBML_WRITING) && defined(CONFIG_ZLIB)
+META_CLASS(CREATE,CreateTrackEntry)
+#endif
+META_CLASS(DELETE,DeleteTrackEntry)
 META_VMT(TYPE_FUNC,ebml_element_vmt,ReadData,ReadTrackEntry)
 META_VMT(TYPE_FUNC,ebml_element_vmt,UpdateDataSize,UpdateDataSizeTrackEntry)
 META_VMT(TYPE_FUNC,ebml_element_vmt,Copy,CopyTrackEntry)
@@ -0,0 +1,175 @@
+/*
+ * $Id$
+ * Copyright (c) 2008-2010, Matroska Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Matroska assocation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY the Matroska association ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL The Matroska Foundation BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+
+#include "matroska2/matroska.h"
+
+// the Segment data: two Clusters with a SimpleBlock after the Cluster Timestamp
+static const uint8_t SegmentData[] = {
+    0x1F,0x43,0xB6,0x75, 0x8B,                  // Cluster at 0, 11 bytes
+      0xE7, 0x81, 0x00,                         // Timestamp 0
+      0xA3, 0x86, 0x81, 0x00,0x00, 0x80, 'a','b', // SimpleBlock track 1, at 8
+    0x1F,0x43,0xB6,0x75, 0x8B,                  // Cluster at 16, 11 bytes
+      0xE7, 0x81, 0x0A,                         // Timestamp 10
+      0xA3, 0x86, 0x82, 0x00,0x00, 0x80, 'c','d', // SimpleBlock track 2, at 24
+};
+
+static const uint8_t CuesData[] = {
+    0x1C,0x53,0xBB,0x6B, 0xB5,
+    0xBB, 0x8E,                                 // CuePoint 0 ms
+      0xB3, 0x81, 0x00,
+      0xB7, 0x89, 0xF7,0x81,0x01, 0xF1,0x81,0x00, 0xF0,0x81,0x03, // track 1, Cluster 0, Block 3 after the Cluster data
+    0xBB, 0x93,                                 // CuePoint 10 ms
+      0xB3, 0x81, 0x0A,
+      0xB7, 0x86, 0xF7,0x81,0x02, 0xF1,0x81,0x10, // track 2, Cluster 16
+      0xB7, 0x86, 0xF7,0x81,0x01, 0xF1,0x81,0x00, // track 1, Cluster 0
+    0xBB, 0x8E,                                 // CuePoint 20 ms
+      0xB3, 0x81, 0x14,
+      0xB7, 0x89, 0xF7,0x81,0x01, 0xF1,0x81,0x10, 0xF0,0x81,0x64, // track 1, Cluster 16, Block past the Cluster end
+};
+
+typedef struct expected_seek
+{
+    mkv_timestamp_t Timestamp;
+    mkv_timestamp_t CueTimestamp;
+    int16_t TrackNum;
+    filepos_t ClusterPosition;
+    filepos_t StreamPosition;
+
+} expected_seek;
+
+static const expected_seek Expected[] = {
+    {        0,        0, 1,  0,  8}, // on the Block
+    {  5000000,        0, 1,  0,  8},
+    { 10000000, 10000000, 1,  0,  0}, // the track with the earliest Cluster, no RelativePosition
+    { 15000000, 10000000, 1,  0,  0},
+    { 25000000, 20000000, 1, 16, 16}, // RelativePosition out of the Cluster
+};
+
+static ebml_element *ReadCues(parsercontext *p, ebml_element *SegmentInfo)
+{
+    ebml_parser_context RContext, SegmentContext;
+    ebml_element *Cues, *Cue;
+    stream *Input;
+    int UpperElement = 0;
+
+    Input = (stream*)NodeCreate(p,MEMSTREAM_CLASS);
+    if (!Input || Node_Set(Input,MEMSTREAM_DATA,CuesData,sizeof(CuesData))!=ERR_NONE)
+        return NULL;
+    RContext.Context = MATROSKA_getContextStream();
+    RContext.EndPosition = INVALID_FILEPOS_T;
+    RContext.UpContext = NULL;
+    RContext.Profile = PROFILE_MATROSKA_ANY;
+    SegmentContext.Context = MATROSKA_getContextSegment();
+    SegmentContext.EndPosition = sizeof(CuesData);
+    SegmentContext.UpContext = &RContext;
+    SegmentContext.Profile = PROFILE_MATROSKA_ANY;
+
+    Cues = EBML_FindNextElement(Input, &SegmentContext, &UpperElement, 0);
+    if (Cues && (!EBML_ElementIsType(Cues, MATROSKA_getContextCues()) ||
+        EBML_ElementReadData(Cues,Input,&SegmentContext,0,SCOPE_ALL_DATA,0)!=ERR_NONE))
+    {
+        NodeDelete((node*)Cues);
+        Cues = NULL;
+    }
+    StreamClose(Input);
+    if (Cues)
+        for (Cue=EBML_MasterChildren(Cues);Cue;Cue=EBML_MasterNext(Cue))
+            MATROSKA_LinkCueSegmentInfo((matroska_cuepoint*)Cue,(ebml_master*)SegmentInfo);
+    return Cues;
+}
+
+static int CheckSeeks(const array *Index, stream *Input)
+{
+    const matroska_cue_index *Entry;
+    filepos_t Position;
+    size_t i;
+    int Result = 0;
+
+    if (ARRAYCOUNT(*Index,matroska_cue_index) != 4)
+    {
+        fprintf(stderr,"%d Cue entries indexed instead of 4\r\n",(int)ARRAYCOUNT(*Index,matroska_cue_index));
+        return 1;
+    }
+    for (i=0;i<sizeof(Expected)/sizeof(Expected[0]);++i)
+    {
+        Stream_Seek(Input,sizeof(SegmentData),SEEK_SET);
+        Entry = MATROSKA_SeekToTimestamp(Input, Index, 0, Expected[i].Timestamp);
+        Position = Stream_Seek(Input,0,SEEK_CUR);
+        if (!Entry || Entry->Timestamp != Expected[i].CueTimestamp || Entry->TrackNum != Expected[i].TrackNum ||
+            Entry->ClusterPosition != Expected[i].ClusterPosition || Position != Expected[i].StreamPosition)
+        {
+            fprintf(stderr,"seeking to %d ms found track %d at %d ms in the Cluster at %d, the stream is at %d\r\n",(int)(Expected[i].Timestamp/1000000),
+                Entry?(int)Entry->TrackNum:-1,Entry?(int)(Entry->Timestamp/1000000):-1,Entry?(int)Entry->ClusterPosition:-1,(int)Position);
+            Result = 1;
+        }
+    }
+    return Result;
+}
+
+int main(void)
+{
+    parsercontext p;
+    stream *Input;
+    ebml_element *Cues, *SegmentInfo;
+    array Index;
+    int Result = 0;
+
+    ParserContext_InitEx(&p,NULL,NULL,NULL,NODECONTEXT_SINGLE_THREAD);
+    MATROSKA_Init(&p);
+    ArrayInit(&Index);
+
+    SegmentInfo = EBML_ElementCreate(&p,MATROSKA_getContextInfo(),0,PROFILE_MATROSKA_ANY,NULL);
+    Cues = SegmentInfo ? ReadCues(&p, SegmentInfo) : NULL;
+    Input = (stream*)NodeCreate(&p,MEMSTREAM_CLASS);
+    if (!Cues || !Input || Node_Set(Input,MEMSTREAM_DATA,SegmentData,sizeof(SegmentData))!=ERR_NONE)
+    {
+        fprintf(stderr,"failed to read the Cues\r\n");
+        Result = 1;
+    }
+    else if (MATROSKA_CuesBuildIndex((ebml_master*)Cues,&Index)!=ERR_NONE)
+    {
+        fprintf(stderr,"failed to index the Cues\r\n");
+        Result = 1;
+    }
+    else
+        Result = CheckSeeks(&Index, Input);
+
+    if (!Result)
+        fprintf(stdout,"Cues seeking OK\r\n");
+
+    ArrayClear(&Index);
+    if (Input)
+        StreamClose(Input);
+    NodeDelete((node*)Cues);
+    NodeDelete((node*)SegmentInfo);
+    MATROSKA_Done(&p);
+    ParserContext_Done(&p);
+    return Result;
+}
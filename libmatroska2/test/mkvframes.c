@@ -0,0 +1,302 @@
+/*
+ * $Id$
+ * Copyright (c) 2008-2010, Matroska Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Matroska assocation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY the Matroska association ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL The Matroska Foundation BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+
+#include "matroska2/matroska.h"
+
+static const uint8_t SegmentData[] = {
+    0x16,0x54,0xAE,0x6B, 0x9C,                  // Tracks, 28 bytes
+      0xAE, 0x95,                               // TrackEntry 1, with "HD" stripped from the frames
+        0xD7, 0x81, 0x01,
+        0x6D,0x80, 0x8F,                        // ContentEncodings
+          0x62,0x40, 0x8C,                      // ContentEncoding
+            0x50,0x34, 0x89,                    // ContentCompression
+              0x42,0x54, 0x81, 0x03,            // header stripping
+              0x42,0x55, 0x82, 'H','D',
+      0xAE, 0x83,                               // TrackEntry 2
+        0xD7, 0x81, 0x02,
+    0x1F,0x43,0xB6,0x75, 0xAB,                  // Cluster at 33, 43 bytes
+      0xE7, 0x81, 0x0A,                         // Timestamp 10
+      0xA3, 0x8B, 0x81, 0x00,0x00, 0x84, 0x01, 'a','b','c','d','e','f', // track 1, 2 frames with fixed lacing
+      0xA3, 0x90, 0x82, 0x00,0x05, 0x86, 0x02, 0x82, 0xC0, 'g','h','i','j','k','l','m','n','o', // track 2, 3 frames with EBML lacing
+      0xA3, 0x87, 0x81, 0x00,0x14, 0x80, 'x','y','z', // track 1, no lacing
+    0xA3, 0x85, 0x81, 0x00,0x00, 0x80, 'q',     // track 1 SimpleBlock at 81 with a frame shorter than "HD"
+};
+
+#define SHORT_BLOCK_POS  81
+#define TEMP_FILE        T("mkvframes.tmp")
+
+typedef struct expected_block
+{
+    int16_t TrackNum;
+    mkv_timestamp_t Timestamp;
+    const char *Frames[3];
+
+} expected_block;
+
+static const expected_block Expected[] = {
+    {1, 10000000, {"HDabc", "HDdef", NULL}},
+    {2, 15000000, {"gh", "ijk", "lmno"}},
+    {1, 30000000, {"HDxyz", NULL, NULL}},
+};
+
+typedef struct visit
+{
+    const expected_block *Block;
+    size_t Count;
+    size_t InPlace;
+    int Result;
+
+} visit;
+
+static err_t CheckFrame(visit *Visit, size_t FrameNum, const matroska_frame_view *Frame)
+{
+    const char *Expect = FrameNum < 3 ? Visit->Block->Frames[FrameNum] : NULL;
+
+    if (FrameNum != Visit->Count++ || !Expect || Frame->HeadSize + Frame->Size != strlen(Expect) ||
+        (Frame->HeadSize && memcmp(Frame->Head, Expect, Frame->HeadSize)!=0) ||
+        memcmp(Frame->Data, Expect + Frame->HeadSize, Frame->Size)!=0)
+    {
+        fprintf(stderr,"track %d frame %d doesn't match\r\n",(int)Visit->Block->TrackNum,(int)FrameNum);
+        Visit->Result = 1;
+    }
+    else if (FrameNum == 0 && Frame->Timestamp != Visit->Block->Timestamp)
+    {
+        fprintf(stderr,"track %d frame 0 at %d ms\r\n",(int)Visit->Block->TrackNum,(int)(Frame->Timestamp/1000000));
+        Visit->Result = 1;
+    }
+    if (Frame->Data >= SegmentData && Frame->Data < SegmentData + sizeof(SegmentData))
+        ++Visit->InPlace;
+    return ERR_NONE;
+}
+
+static int CheckBlock(matroska_block *Block, stream *Input, const expected_block *Expect, bool_t InPlace)
+{
+    visit Visit;
+    uint8_t Frame[8];
+    size_t i, Size, Count = MATROSKA_BlockGetFrameCount(Block);
+    err_t Err;
+    int Result = 0;
+
+    if (MATROSKA_BlockTrackNum(Block) != Expect->TrackNum)
+        return 1;
+
+    memset(&Visit,0,sizeof(Visit));
+    Visit.Block = Expect;
+    Err = MATROSKA_BlockVisitFrames(Block, Input, (matroska_frame_visitor)CheckFrame, &Visit, PROFILE_MATROSKA_ANY);
+    if (Err != ERR_NONE || Visit.Result || Visit.Count != Count)
+    {
+        fprintf(stderr,"visiting the %d frames of track %d failed %d\r\n",(int)Count,(int)Expect->TrackNum,(int)Err);
+        Result = 1;
+    }
+    // the frames come from the memory stream or a copy
+    if (Visit.InPlace != (InPlace ? Count : 0))
+    {
+        fprintf(stderr,"%d frames of track %d given in place\r\n",(int)Visit.InPlace,(int)Expect->TrackNum);
+        Result = 1;
+    }
+
+    // read backward to seek each frame
+    for (i=Count;i-->0;)
+    {
+        Size = 0;
+        Err = MATROSKA_BlockReadFrame(Block, Input, i, Frame, strlen(Expect->Frames[i])-1, &Size, PROFILE_MATROSKA_ANY);
+        if (Err != ERR_BUFFER_FULL || Size != strlen(Expect->Frames[i]))
+        {
+            fprintf(stderr,"track %d frame %d in a small buffer gave %d with size %d\r\n",(int)Expect->TrackNum,(int)i,(int)Err,(int)Size);
+            Result = 1;
+        }
+        Err = MATROSKA_BlockReadFrame(Block, Input, i, Frame, sizeof(Frame), &Size, PROFILE_MATROSKA_ANY);
+        if (Err != ERR_NONE || Size != strlen(Expect->Frames[i]) || memcmp(Frame, Expect->Frames[i], Size)!=0)
+        {
+            fprintf(stderr,"reading track %d frame %d failed %d\r\n",(int)Expect->TrackNum,(int)i,(int)Err);
+            Result = 1;
+        }
+    }
+    return Result;
+}
+
+static int CheckCluster(matroska_cluster *Cluster, stream *Input, bool_t InPlace)
+{
+    ebml_element *Block;
+    size_t i = 0;
+    int Result = 0;
+
+    for (Block = EBML_MasterChildren(Cluster);Block;Block=EBML_MasterNext(Block))
+    {
+        if (!EBML_ElementIsType(Block, MATROSKA_getContextSimpleBlock()))
+            continue;
+        if (i == sizeof(Expected)/sizeof(Expected[0]))
+            return 1;
+        Result |= CheckBlock((matroska_block*)Block, Input, &Expected[i++], InPlace);
+    }
+    if (i != sizeof(Expected)/sizeof(Expected[0]))
+    {
+        fprintf(stderr,"%d SimpleBlocks found in the Cluster\r\n",(int)i);
+        Result = 1;
+    }
+    return Result;
+}
+
+// a Block linked before it's read has sizes without the stripped header
+static int CheckShortFrame(stream *Input, const ebml_parser_context *SegmentContext, ebml_master *Tracks)
+{
+    ebml_parser_context ClusterContext;
+    ebml_element *Block;
+    uint8_t Frame[8];
+    size_t Size;
+    int UpperElement = 0;
+    int Result = 0;
+
+    ClusterContext.Context = MATROSKA_getContextCluster();
+    ClusterContext.EndPosition = sizeof(SegmentData);
+    ClusterContext.UpContext = SegmentContext;
+    ClusterContext.Profile = PROFILE_MATROSKA_ANY;
+
+    Stream_Seek(Input,SHORT_BLOCK_POS,SEEK_SET);
+    Block = EBML_FindNextElement(Input, &ClusterContext, &UpperElement, 0);
+    if (!Block || !EBML_ElementIsType(Block, MATROSKA_getContextSimpleBlock()) ||
+        MATROSKA_LinkBlockReadTrack((matroska_block*)Block, (ebml_master*)EBML_MasterChildren(Tracks), 0, PROFILE_MATROSKA_ANY)!=ERR_NONE ||
+        EBML_ElementReadData(Block,Input,&ClusterContext,0,SCOPE_PARTIAL_DATA,0)!=ERR_NONE)
+    {
+        fprintf(stderr,"failed to read the short SimpleBlock\r\n");
+        Result = 1;
+    }
+    else
+    {
+        if (MATROSKA_BlockVisitFrames((matroska_block*)Block, Input, (matroska_frame_visitor)CheckFrame, NULL, PROFILE_MATROSKA_ANY) != ERR_INVALID_DATA)
+        {
+            fprintf(stderr,"visiting a frame shorter than the stripped header didn't fail\r\n");
+            Result = 1;
+        }
+        if (MATROSKA_BlockReadFrame((matroska_block*)Block, Input, 0, Frame, sizeof(Frame), &Size, PROFILE_MATROSKA_ANY) != ERR_INVALID_DATA)
+        {
+            fprintf(stderr,"reading a frame shorter than the stripped header didn't fail\r\n");
+            Result = 1;
+        }
+    }
+    NodeDelete((node*)Block);
+    return Result;
+}
+
+// a plain file stream can't Peek, the frames are copied
+static int CheckFileStream(parsercontext *p, matroska_cluster *Cluster)
+{
+    stream *File;
+    int Result = 0;
+
+    File = StreamOpen(p,TEMP_FILE,SFLAG_WRONLY|SFLAG_CREATE);
+    if (!File || Stream_Write(File,SegmentData,sizeof(SegmentData),NULL)!=ERR_NONE)
+        Result = 1;
+    if (File)
+        StreamClose(File);
+    File = Result ? NULL : StreamOpen(p,TEMP_FILE,SFLAG_RDONLY);
+    if (!File)
+    {
+        fprintf(stderr,"failed to use the temporary file\r\n");
+        Result = 1;
+    }
+    else
+    {
+        Result |= CheckCluster(Cluster, File, 0);
+        StreamClose(File);
+    }
+    FileErase((nodecontext*)p,TEMP_FILE,1,0);
+    return Result;
+}
+
+int main(void)
+{
+    parsercontext p;
+    stream *Input;
+    ebml_parser_context RContext, SegmentContext;
+    ebml_element *Tracks = NULL, *Cluster = NULL, *SegmentInfo;
+    int UpperElement = 0;
+    int Result = 0;
+
+    ParserContext_InitEx(&p,NULL,NULL,NULL,NODECONTEXT_SINGLE_THREAD);
+    MATROSKA_Init(&p);
+
+    SegmentInfo = EBML_ElementCreate(&p,MATROSKA_getContextInfo(),0,PROFILE_MATROSKA_ANY,NULL);
+    Input = (stream*)NodeCreate(&p,MEMSTREAM_CLASS);
+    if (!SegmentInfo || !Input || Node_Set(Input,MEMSTREAM_DATA,SegmentData,sizeof(SegmentData))!=ERR_NONE)
+    {
+        fprintf(stderr,"failed to create the memory stream\r\n");
+        Result = 1;
+    }
+    else
+    {
+        RContext.Context = MATROSKA_getContextStream();
+        RContext.EndPosition = INVALID_FILEPOS_T;
+        RContext.UpContext = NULL;
+        RContext.Profile = PROFILE_MATROSKA_ANY;
+        SegmentContext.Context = MATROSKA_getContextSegment();
+        SegmentContext.EndPosition = sizeof(SegmentData);
+        SegmentContext.UpContext = &RContext;
+        SegmentContext.Profile = PROFILE_MATROSKA_ANY;
+
+        Tracks = EBML_FindNextElement(Input, &SegmentContext, &UpperElement, 0);
+        if (!Tracks || !EBML_ElementIsType(Tracks, MATROSKA_getContextTracks()) ||
+            EBML_ElementReadData(Tracks,Input,&SegmentContext,0,SCOPE_ALL_DATA,0)!=ERR_NONE)
+        {
+            fprintf(stderr,"failed to read the Tracks\r\n");
+            Result = 1;
+        }
+        else
+        {
+            Cluster = EBML_FindNextElement(Input, &SegmentContext, &UpperElement, 0);
+            if (!Cluster || !EBML_ElementIsType(Cluster, MATROSKA_getContextCluster()) ||
+                EBML_ElementReadData(Cluster,Input,&SegmentContext,0,SCOPE_PARTIAL_DATA,0)!=ERR_NONE)
+            {
+                fprintf(stderr,"failed to read the Cluster\r\n");
+                Result = 1;
+            }
+            else
+            {
+                MATROSKA_LinkClusterBlocks((matroska_cluster*)Cluster, (ebml_master*)SegmentInfo, (ebml_master*)Tracks, 0, PROFILE_MATROSKA_ANY);
+                Result |= CheckCluster((matroska_cluster*)Cluster, Input, 1);
+                Result |= CheckFileStream(&p, (matroska_cluster*)Cluster);
+                Result |= CheckShortFrame(Input, &SegmentContext, (ebml_master*)Tracks);
+            }
+        }
+    }
+    if (!Result)
+        fprintf(stdout,"Block frames access OK\r\n");
+
+    NodeDelete((node*)Cluster);
+    NodeDelete((node*)Tracks);
+    NodeDelete((node*)SegmentInfo);
+    if (Input)
+        StreamClose(Input);
+    MATROSKA_Done(&p);
+    ParserContext_Done(&p);
+    return Result;
+}
@@ -0,0 +1,190 @@
+/*
+ * $Id$
+ * Copyright (c) 2008-2010, Matroska Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Matroska assocation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY the Matroska association ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL The Matroska Foundation BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+
+#include "matroska2/matroska.h"
+
+// a Cluster with a SimpleBlock, a BlockGroup and a laced SimpleBlock
+static const uint8_t ClusterData[] = {
+    0x1F,0x43,0xB6,0x75, 0xA7,                           // Cluster, 39 bytes
+    0xE7, 0x82, 0x03,0xE8,                               // Timestamp 1000, at 5
+    0xA3, 0x87, 0x81, 0x00,0x00, 0x80, 'a','b','c',     // SimpleBlock track 1 keyframe, at 9
+    0xA0, 0x8D,                                          // BlockGroup, at 18
+      0xA1, 0x88, 0x82, 0x00,0x0A, 0x00, 'd','e','f','g', // Block track 2
+      0xFB, 0x81, 0xF6,                                  // ReferenceBlock -10
+    0xA3, 0x89, 0x81, 0x00,0x14, 0x84, 0x01, 'h','i','j','k', // SimpleBlock track 1 keyframe, 2 frames with fixed lacing, at 33
+};
+
+typedef struct expected_block
+{
+    filepos_t Position;
+    filepos_t DataSize;
+    uint16_t TrackNumber;
+    int16_t LocalTimestamp;
+    uint8_t Flags;
+
+} expected_block;
+
+static const expected_block Expected[] = {
+    { 9,  7, 1,  0, 0x80},
+    {18, 13, 2, 10, 0x00},
+    {33,  9, 1, 20, 0x84},
+};
+
+static int CheckShallowBlocks(const matroska_cluster *Cluster)
+{
+    const matroska_cluster_block *Blocks;
+    size_t i, Count;
+    int Result = 0;
+
+    Blocks = MATROSKA_ClusterShallowBlocks(Cluster, &Count);
+    if (Count != sizeof(Expected)/sizeof(Expected[0]))
+    {
+        fprintf(stderr,"%d Blocks recorded instead of %d\r\n",(int)Count,(int)(sizeof(Expected)/sizeof(Expected[0])));
+        return 1;
+    }
+    for (i=0;i<Count;++i)
+    {
+        if (Blocks[i].Position != Expected[i].Position || Blocks[i].DataSize != Expected[i].DataSize ||
+            Blocks[i].TrackNumber != Expected[i].TrackNumber || Blocks[i].LocalTimestamp != Expected[i].LocalTimestamp ||
+            Blocks[i].Flags != Expected[i].Flags || Blocks[i].HeadSize != 2)
+        {
+            fprintf(stderr,"Block %d recorded at %d size %d track %d timestamp %d flags %02X\r\n",(int)i,(int)Blocks[i].Position,(int)Blocks[i].DataSize,
+                (int)Blocks[i].TrackNumber,(int)Blocks[i].LocalTimestamp,(int)Blocks[i].Flags);
+            Result = 1;
+        }
+    }
+    // only the Timestamp is read as an element
+    if (!EBML_MasterChildren(Cluster) || !EBML_ElementIsType(EBML_MasterChildren(Cluster), MATROSKA_getContextTimestamp()) || EBML_MasterNext(EBML_MasterChildren(Cluster)))
+    {
+        fprintf(stderr,"the shallow Cluster should only have a Timestamp child\r\n");
+        Result = 1;
+    }
+    return Result;
+}
+
+static int CheckReadBlocks(matroska_cluster *Cluster, stream *Input, const ebml_parser_context *Context)
+{
+    const matroska_cluster_block *Blocks;
+    ebml_element *Laced, *Group, *Block;
+    size_t Count;
+    int Result = 0;
+
+    Blocks = MATROSKA_ClusterShallowBlocks(Cluster, &Count);
+    if (Count != 3)
+        return 1;
+
+    // the laced SimpleBlock first, then the BlockGroup that comes before it in the file
+    if (MATROSKA_ClusterReadShallowBlock(Cluster, Input, Context, &Blocks[2], SCOPE_PARTIAL_DATA, &Laced) != ERR_NONE ||
+        !EBML_ElementIsType(Laced, MATROSKA_getContextSimpleBlock()))
+    {
+        fprintf(stderr,"failed to read the laced SimpleBlock\r\n");
+        return 1;
+    }
+    if (EBML_ElementPosition(Laced) != 33 || MATROSKA_BlockTrackNum((matroska_block*)Laced) != 1 || MATROSKA_BlockGetFrameCount((matroska_block*)Laced) != 2)
+    {
+        fprintf(stderr,"the laced SimpleBlock doesn't match its record\r\n");
+        Result = 1;
+    }
+
+    if (MATROSKA_ClusterReadShallowBlock(Cluster, Input, Context, &Blocks[1], SCOPE_PARTIAL_DATA, &Group) != ERR_NONE ||
+        !EBML_ElementIsType(Group, MATROSKA_getContextBlockGroup()))
+    {
+        fprintf(stderr,"failed to read the BlockGroup\r\n");
+        return 1;
+    }
+    Block = EBML_MasterFindChild(Group, MATROSKA_getContextBlock());
+    if (!Block || MATROSKA_BlockTrackNum((matroska_block*)Block) != 2 || !EBML_MasterFindChild(Group, MATROSKA_getContextReferenceBlock()))
+    {
+        fprintf(stderr,"the BlockGroup doesn't match its record\r\n");
+        Result = 1;
+    }
+
+    // the read Blocks are children of the Cluster in file order
+    if (EBML_MasterNext(EBML_MasterChildren(Cluster)) != Group || EBML_MasterNext(Group) != Laced || EBML_MasterNext(Laced))
+    {
+        fprintf(stderr,"the read Blocks are not in file order in the Cluster\r\n");
+        Result = 1;
+    }
+    return Result;
+}
+
+int main(void)
+{
+    parsercontext p;
+    stream *Input;
+    ebml_parser_context RContext, SegmentContext;
+    ebml_element *Cluster;
+    int UpperElement = 0;
+    int Result = 0;
+
+    ParserContext_InitEx(&p,NULL,NULL,NULL,NODECONTEXT_SINGLE_THREAD);
+    MATROSKA_Init(&p);
+
+    Input = (stream*)NodeCreate(&p,MEMSTREAM_CLASS);
+    if (!Input || Node_Set(Input,MEMSTREAM_DATA,ClusterData,sizeof(ClusterData))!=ERR_NONE)
+    {
+        fprintf(stderr,"failed to create the memory stream\r\n");
+        Result = 1;
+    }
+    else
+    {
+        RContext.Context = MATROSKA_getContextStream();
+        RContext.EndPosition = INVALID_FILEPOS_T;
+        RContext.UpContext = NULL;
+        RContext.Profile = PROFILE_MATROSKA_ANY;
+        SegmentContext.Context = MATROSKA_getContextSegment();
+        SegmentContext.EndPosition = sizeof(ClusterData);
+        SegmentContext.UpContext = &RContext;
+        SegmentContext.Profile = PROFILE_MATROSKA_ANY;
+
+        Cluster = EBML_FindNextElement(Input, &SegmentContext, &UpperElement, 0);
+        if (!Cluster || !EBML_ElementIsType(Cluster, MATROSKA_getContextCluster()) ||
+            EBML_ElementReadData(Cluster,Input,&SegmentContext,0,SCOPE_SHALLOW_DATA,0)!=ERR_NONE)
+        {
+            fprintf(stderr,"failed to read the Cluster\r\n");
+            Result = 1;
+        }
+        else
+        {
+            Result |= CheckShallowBlocks((matroska_cluster*)Cluster);
+            if (!Result)
+                Result |= CheckReadBlocks((matroska_cluster*)Cluster, Input, &SegmentContext);
+        }
+        if (Cluster)
+            NodeDelete((node*)Cluster);
+        StreamClose(Input);
+    }
+    if (!Result)
+        fprintf(stdout,"shallow Cluster read OK\r\n");
+
+    MATROSKA_Done(&p);
+    ParserContext_Done(&p);
+    return Result;
+}
@@ -272,13 +272,13 @@ int main(int argc, const char *argv[])
         ShowPos = 1;
 
     // Core-C init phase
-    ParserContext_Init(&p,NULL,NULL,NULL);
+    ParserContext_InitEx(&p,NULL,NULL,NULL,NODECONTEXT_SINGLE_THREAD);
     // EBML & Matroska Init
     MATROSKA_Init(&p);
 
     // open the file to parse
     Node_FromStr(&p,Path,TSIZEOF(Path),argv[argc-1]);
-    Input = StreamOpen(&p,Path,SFLAG_RDONLY/*|SFLAG_BUFFERED*/);
+    Input = StreamOpen(&p,Path,SFLAG_RDONLY|SFLAG_BUFFERED|SFLAG_MEMORY_MAP);
     if (Input == NULL)
         fprintf(stderr, "error: mkvtree cannot open file \"%s\"\r\n",argv[1]);
     else
@@ -0,0 +1,860 @@
+/*
+ * $Id$
+ * Copyright (c) 2008-2010, Matroska Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Matroska assocation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY the Matroska association ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL The Matroska Foundation BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+
+#include "matroska2/matroska.h"
+#include "matroska2/matroska_classes.h"
+
+// A_VORBIS CodecPrivate of 3 Xiph laced headers encoded by libVorbis at the lowest quality
+// 1 channel at 44100 Hz: floor1, lookup type 1 codebooks, 2 modes of 256 and 2048 samples
+static const uint8_t MonoPrivate[3488] = {
+    0x02,0x1E,0x5A,0x01,0x76,0x6F,0x72,0x62,0x69,0x73,0x00,0x00,0x00,0x00,0x01,0x44,
+    0xAC,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xBB,0x00,0x00,0x00,0x00,0x00,0x00,0xB8,
+    0x01,0x03,0x76,0x6F,0x72,0x62,0x69,0x73,0x34,0x00,0x00,0x00,0x58,0x69,0x70,0x68,
+    0x2E,0x4F,0x72,0x67,0x20,0x6C,0x69,0x62,0x56,0x6F,0x72,0x62,0x69,0x73,0x20,0x49,
+    0x20,0x32,0x30,0x32,0x30,0x30,0x37,0x30,0x34,0x20,0x28,0x52,0x65,0x64,0x75,0x63,
+    0x69,0x6E,0x67,0x20,0x45,0x6E,0x76,0x69,0x72,0x6F,0x6E,0x6D,0x65,0x6E,0x74,0x29,
+    0x01,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x45,0x4E,0x43,0x4F,0x44,0x45,0x52,0x3D,
+    0x6C,0x69,0x62,0x73,0x6E,0x64,0x66,0x69,0x6C,0x65,0x01,0x05,0x76,0x6F,0x72,0x62,
+    0x69,0x73,0x1F,0x42,0x43,0x56,0x01,0x00,0x00,0x01,0x00,0x18,0x63,0x54,0x29,0x46,
+    0x99,0x52,0xD2,0x4A,0x89,0x19,0x73,0x94,0x31,0x46,0x99,0x62,0x92,0x4A,0x89,0xA5,
+    0x84,0x16,0x42,0x48,0x9D,0x73,0x14,0x53,0xA9,0x39,0xD7,0x9C,0x6B,0xAC,0xB9,0xB5,
+    0x20,0x84,0x10,0x1A,0x53,0x50,0x29,0x05,0x99,0x52,0x8E,0x52,0x69,0x19,0x63,0x90,
+    0x29,0x05,0x99,0x52,0x10,0x4B,0x49,0x25,0x74,0x12,0x3A,0x27,0x9D,0x63,0x10,0x5B,
+    0x49,0xC1,0xD6,0x98,0x6B,0x8B,0x41,0xB6,0x1C,0x84,0x0D,0x9A,0x52,0x4C,0x29,0xC4,
+    0x94,0x52,0x8A,0x42,0x08,0x19,0x53,0x8C,0x29,0xC5,0x94,0x52,0x4A,0x42,0x07,0x25,
+    0x74,0x0E,0x3A,0xE6,0x1C,0x53,0x8E,0x4A,0x28,0x41,0xB8,0x9C,0x73,0xAB,0xB5,0x96,
+    0x96,0x63,0x8B,0xA9,0x74,0x92,0x4A,0xE7,0x24,0x64,0x4C,0x42,0x48,0x29,0x85,0x92,
+    0x4A,0x07,0xA5,0x53,0x4E,0x42,0x48,0x35,0x96,0xD6,0x52,0x29,0x1D,0x73,0x52,0x52,
+    0x6A,0x41,0xE8,0x20,0x84,0x10,0x42,0xB6,0x20,0x84,0x0D,0x82,0xD0,0x90,0x55,0x00,
+    0x00,0x01,0x00,0xC0,0x40,0x10,0x1A,0xB2,0x0A,0x00,0x50,0x00,0x00,0x10,0x8A,0xA1,
+    0x18,0x8A,0x02,0x84,0x86,0xAC,0x02,0x00,0x32,0x00,0x00,0x04,0xA0,0x28,0x8E,0xE2,
+    0x28,0x8E,0x23,0x39,0x92,0x63,0x49,0x16,0x10,0x1A,0xB2,0x0A,0x00,0x00,0x02,0x00,
+    0x10,0x00,0x00,0xC0,0x70,0x14,0x49,0x91,0x14,0xC9,0xB1,0x24,0x4B,0xD2,0x2C,0x4B,
+    0xD3,0x44,0x51,0x55,0x7D,0xD5,0x36,0x55,0x55,0xF6,0x75,0x5D,0xD7,0x75,0x5D,0xD7,
+    0x75,0x20,0x34,0x64,0x15,0x00,0x00,0x01,0x00,0x40,0x48,0xA7,0x99,0xA5,0x1A,0x20,
+    0xC2,0x0C,0x64,0x18,0x08,0x0D,0x59,0x05,0x00,0x20,0x00,0x00,0x00,0x46,0x28,0xC2,
+    0x10,0x03,0x42,0x43,0x56,0x01,0x00,0x00,0x01,0x00,0x00,0x62,0x28,0x39,0x88,0x26,
+    0xB4,0xE6,0x7C,0x73,0x8E,0x83,0x66,0x39,0x68,0x2A,0xC5,0xE6,0x74,0x70,0x22,0xD5,
+    0xE6,0x49,0x6E,0x2A,0xE6,0xE6,0x9C,0x73,0xCE,0x39,0x27,0x9B,0x73,0xC6,0x38,0xE7,
+    0x9C,0x73,0x8A,0x72,0x66,0x31,0x68,0x26,0xB4,0xE6,0x9C,0x73,0x12,0x83,0x66,0x29,
+    0x68,0x26,0xB4,0xE6,0x9C,0x73,0x9E,0xC4,0xE6,0x41,0x6B,0xAA,0xB4,0xE6,0x9C,0x73,
+    0xC6,0x39,0xA7,0x83,0x71,0x46,0x18,0xE7,0x9C,0x73,0x9A,0xB4,0xE6,0x41,0x6A,0x36,
+    0xD6,0xE6,0x9C,0x73,0x16,0xB4,0xA6,0x39,0x6A,0x2E,0xC5,0xE6,0x9C,0x73,0x22,0xE5,
+    0xE6,0x49,0x6D,0x2E,0xD5,0xE6,0x9C,0x73,0xCE,0x39,0xE7,0x9C,0x73,0xCE,0x39,0xE7,
+    0x9C,0x73,0xAA,0x17,0xA7,0x73,0x70,0x4E,0x38,0xE7,0x9C,0x73,0xA2,0xF6,0xE6,0x5A,
+    0x6E,0x42,0x17,0xE7,0x9C,0x73,0x3E,0x19,0xA7,0x7B,0x73,0x42,0x38,0xE7,0x9C,0x73,
+    0xCE,0x39,0xE7,0x9C,0x73,0xCE,0x39,0xE7,0x9C,0x73,0x82,0xD0,0x90,0x55,0x00,0x00,
+    0x10,0x00,0x00,0x41,0x18,0x36,0x86,0x71,0xA7,0x20,0x48,0x9F,0xA3,0x81,0x18,0x45,
+    0x88,0x69,0xC8,0xA4,0x07,0xDD,0xA3,0xC3,0x24,0x68,0x0C,0x72,0x0A,0xA9,0x47,0xA3,
+    0xA3,0x91,0x52,0xEA,0x20,0x94,0x54,0xC6,0x49,0x29,0x9D,0x20,0x34,0x64,0x15,0x00,
+    0x00,0x08,0x00,0x00,0x21,0x84,0x14,0x52,0x48,0x21,0x85,0x14,0x52,0x48,0x21,0x85,
+    0x14,0x52,0x88,0x21,0x86,0x18,0x62,0xC8,0x29,0xA7,0x9C,0x82,0x0A,0x2A,0xA9,0xA4,
+    0xA2,0x8A,0x32,0xCA,0x2C,0xB3,0xCC,0x32,0xCB,0x2C,0xB3,0xCC,0x32,0xEB,0xB0,0xB3,
+    0xCE,0x3A,0xEC,0x30,0xC4,0x10,0x43,0x0C,0xAD,0xB4,0x12,0x4B,0x4D,0xB5,0xD5,0x58,
+    0x63,0xAD,0xB9,0xE7,0x9C,0x6B,0x0E,0xD2,0x5A,0x69,0xAD,0xB5,0xD6,0x4A,0x29,0xA5,
+    0x94,0x52,0x4A,0x29,0x08,0x0D,0x59,0x05,0x00,0x80,0x00,0x00,0x10,0x08,0x19,0x64,
+    0x90,0x41,0x46,0x21,0x85,0x14,0x52,0x88,0x21,0xA6,0x9C,0x72,0xCA,0x29,0xA8,0xA0,
+    0x02,0x42,0x43,0x56,0x01,0x00,0x80,0x00,0x00,0x02,0x00,0x00,0x00,0x3C,0xC9,0x73,
+    0x44,0x47,0x74,0x44,0x47,0x74,0x44,0x47,0x74,0x44,0x47,0x74,0x44,0xC7,0x73,0x3C,
+    0x47,0x94,0x44,0x49,0x94,0x44,0x49,0xB4,0x4C,0xCB,0xD4,0x4C,0x4F,0x15,0x55,0xD5,
+    0x95,0x5D,0x5B,0xD6,0x65,0xDD,0xF6,0x6D,0x61,0x17,0x76,0xDD,0xF7,0x75,0xDF,0xF7,
+    0x75,0xE3,0xD7,0x85,0x61,0x59,0x96,0x65,0x59,0x96,0x65,0x59,0x96,0x65,0x59,0x96,
+    0x65,0x59,0x96,0x65,0x59,0x82,0xD0,0x90,0x55,0x00,0x00,0x08,0x00,0x00,0x80,0x10,
+    0x42,0x08,0x21,0x85,0x14,0x52,0x48,0x21,0xA5,0x18,0x63,0xCC,0x31,0xE7,0xA0,0x93,
+    0x50,0x42,0x20,0x34,0x64,0x15,0x00,0x00,0x08,0x00,0x20,0x00,0x00,0x00,0xC0,0x51,
+    0x1C,0xC5,0x71,0x24,0x47,0x72,0x24,0xC9,0x92,0x2C,0x49,0x93,0x34,0x4B,0xB3,0x3C,
+    0xCD,0xD3,0x3C,0x4D,0xF4,0x44,0x51,0x14,0x4D,0xD3,0x54,0x45,0x57,0x74,0x45,0xDD,
+    0xB4,0x45,0xD9,0x94,0x4D,0xD7,0x74,0x4D,0xD9,0x74,0x55,0x59,0xB5,0x5D,0x59,0xB6,
+    0x6D,0xD9,0xD6,0x6D,0x5F,0x96,0x6D,0xDF,0xF7,0x7D,0xDF,0xF7,0x7D,0xDF,0xF7,0x7D,
+    0xDF,0xF7,0x7D,0xDF,0xF7,0x75,0x1D,0x08,0x0D,0x59,0x05,0x00,0x48,0x00,0x00,0xE8,
+    0x48,0x8E,0xA4,0x48,0x8A,0xA4,0x48,0x8E,0xE3,0x38,0x92,0x24,0x01,0xA1,0x21,0xAB,
+    0x00,0x00,0x19,0x00,0x00,0x01,0x00,0x28,0x8A,0xA3,0x38,0x8E,0xE3,0x48,0x92,0x24,
+    0x49,0x96,0xA4,0x49,0x9E,0xE5,0x59,0xA2,0x66,0x6A,0xA6,0x67,0x7A,0xAA,0xA8,0x02,
+    0xA1,0x21,0xAB,0x00,0x00,0x40,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x28,0x9A,
+    0xE2,0x29,0xA6,0xE2,0x29,0xA2,0xE2,0x39,0xA2,0x23,0x4A,0xA2,0x65,0x5A,0xA2,0xA6,
+    0x6A,0xAE,0x28,0x9B,0xB2,0xEB,0xBA,0xAE,0xEB,0xBA,0xAE,0xEB,0xBA,0xAE,0xEB,0xBA,
+    0xAE,0xEB,0xBA,0xAE,0xEB,0xBA,0xAE,0xEB,0xBA,0xAE,0xEB,0xBA,0xAE,0xEB,0xBA,0xAE,
+    0xEB,0xBA,0xAE,0xEB,0xBA,0xAE,0xEB,0xBA,0x2E,0x10,0x1A,0xB2,0x0A,0x00,0x90,0x00,
+    0x00,0xD0,0x91,0x1C,0xC9,0x91,0x1C,0x49,0x91,0x14,0x49,0x91,0x1C,0xC9,0x01,0x42,
+    0x43,0x56,0x01,0x00,0x32,0x00,0x00,0x02,0x00,0x70,0x0C,0xC7,0x90,0x14,0xC9,0xB1,
+    0x2C,0x4B,0xD3,0x3C,0xCD,0xD3,0x3C,0x4D,0xF4,0x44,0x4F,0xF4,0x4C,0x4F,0x15,0x5D,
+    0xD1,0x05,0x42,0x43,0x56,0x01,0x00,0x80,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x24,0xC3,0x52,0x2C,0x47,0x73,0x34,0x49,0x94,0x54,0x4B,0xB5,0x54,0x4D,0xB5,
+    0x54,0x4B,0x15,0x55,0x4F,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x35,0x4D,0xD3,0x34,0x4D,0x20,0x34,0x64,0x25,0x00,
+    0x00,0x04,0x00,0xC0,0x62,0x8D,0xC1,0xE5,0x20,0x21,0x25,0x25,0xE5,0xDE,0x10,0xC2,
+    0x10,0x93,0x9E,0x31,0x26,0x21,0xB5,0x5E,0x21,0x04,0x91,0x92,0xDE,0x31,0x06,0x15,
+    0x83,0x9E,0x32,0xA2,0x0C,0x72,0xDE,0x42,0xE3,0x10,0x83,0x1E,0x08,0x0D,0x59,0x11,
+    0x00,0x44,0x01,0x00,0x00,0xC6,0x20,0xC7,0x10,0x73,0xC8,0x39,0x47,0xA9,0x93,0x12,
+    0x39,0xE7,0xA8,0x74,0x94,0x1A,0xE7,0x1C,0xA5,0x8E,0x52,0x67,0x29,0xC5,0x98,0x62,
+    0xCD,0x28,0x95,0xD8,0x52,0xAC,0x8D,0x73,0x8E,0x52,0x47,0xAD,0xA3,0x94,0x62,0x2C,
+    0x2D,0x76,0x94,0x52,0x8D,0xA9,0xC6,0x02,0x00,0x00,0x02,0x1C,0x00,0x00,0x02,0x2C,
+    0x84,0x42,0x43,0x56,0x04,0x00,0x51,0x00,0x00,0x84,0x31,0x48,0x29,0xA4,0x14,0x62,
+    0x8C,0x39,0xA7,0x9C,0x43,0x8C,0x29,0xE7,0x98,0x73,0x86,0x31,0xE6,0x1C,0x73,0x8E,
+    0x39,0xE7,0xA0,0x74,0x52,0x2A,0xE7,0x9C,0x74,0x4E,0x4A,0xC4,0x18,0x73,0x8E,0x39,
+    0xA7,0x9C,0x73,0x52,0x3A,0x27,0x95,0x73,0x4E,0x4A,0x27,0xA1,0x00,0x00,0x80,0x00,
+    0x07,0x00,0x80,0x00,0x0B,0xA1,0xD0,0x90,0x15,0x01,0x40,0x9C,0x00,0x80,0x41,0x92,
+    0x3C,0x4F,0xF2,0x34,0x51,0x94,0x34,0x4F,0x14,0x45,0x53,0x74,0x5D,0x51,0x34,0x5D,
+    0xD7,0xF2,0x3C,0xD5,0xF4,0x4C,0x53,0x55,0x3D,0xD1,0x54,0x55,0x53,0x55,0x6D,0xD9,
+    0x54,0x55,0x59,0x96,0x3C,0xCF,0x34,0x3D,0xD3,0x54,0x55,0xCF,0x34,0x55,0xD5,0x54,
+    0x55,0x59,0x36,0x55,0x55,0x96,0x45,0x55,0xD5,0x6D,0xD3,0x75,0x75,0xDB,0x74,0x55,
+    0xDD,0x96,0x6D,0xDB,0xF7,0x5D,0x5B,0x16,0x76,0x51,0x55,0x6D,0xDD,0x54,0x5D,0xDB,
+    0x37,0x55,0xD7,0xF6,0x5D,0xD9,0xF6,0x7D,0x59,0xD6,0x75,0x63,0xF2,0x3C,0x55,0xF5,
+    0x4C,0xD3,0x75,0x3D,0xD3,0x74,0x65,0xD5,0x75,0x6D,0x5B,0x75,0x5D,0x5D,0xF7,0x4C,
+    0x53,0x96,0x4D,0xD7,0x95,0x65,0xD3,0x75,0x6D,0xDB,0x95,0x65,0x5D,0x77,0x65,0xD9,
+    0xF7,0x35,0xD3,0x74,0x5D,0xD3,0x55,0x65,0xD9,0x74,0x5D,0xD9,0x76,0x65,0x57,0xB7,
+    0x5D,0x59,0xF6,0x7D,0xD3,0x75,0x85,0xDF,0x95,0x65,0x5F,0x57,0x65,0x59,0x18,0x76,
+    0x5D,0xF7,0x85,0x5B,0xD7,0x95,0xE5,0x74,0x5D,0xDD,0x57,0x65,0x57,0x37,0x56,0x59,
+    0xF6,0x7D,0x5B,0xD7,0x85,0xE1,0xD6,0x75,0x61,0x99,0x3C,0x4F,0x55,0x3D,0xD3,0x74,
+    0x5D,0xCF,0x34,0x5D,0x57,0x75,0x5D,0x5F,0x57,0x5D,0xD7,0xD6,0x35,0xD3,0x94,0x65,
+    0xD3,0x75,0x6D,0xD9,0x54,0x5D,0x59,0x76,0x65,0xD9,0xF7,0x5D,0x57,0xD6,0x75,0xCF,
+    0x34,0x65,0xD9,0x74,0x5D,0xDB,0x36,0x5D,0x57,0x96,0x5D,0x59,0xF6,0x7D,0x57,0x96,
+    0x75,0xDD,0x74,0x5D,0x5F,0x57,0x65,0x59,0xF8,0x55,0x57,0xF6,0x75,0x59,0xD7,0x95,
+    0xE1,0xD6,0x6D,0xE1,0x37,0x5D,0xD7,0xF7,0x55,0x59,0xF6,0x85,0x57,0x96,0x75,0xE1,
+    0xD6,0x75,0x61,0xB9,0x75,0x5D,0x18,0x3E,0x55,0xF5,0x7D,0x53,0x76,0x85,0xE1,0x74,
+    0x65,0xDF,0xD7,0x85,0xDF,0x59,0x6E,0x5D,0x38,0x96,0xD1,0x75,0x7D,0x61,0x95,0x6D,
+    0xE1,0x58,0x65,0x59,0x39,0x7E,0xE1,0x58,0x96,0xDD,0xF7,0x95,0x65,0x74,0x5D,0x5F,
+    0x58,0x6D,0xD9,0x18,0x56,0x59,0x16,0x86,0x5F,0xF8,0x9D,0xE5,0xF6,0x7D,0xE3,0x78,
+    0x75,0x5D,0x19,0x6E,0xDD,0xE7,0xCC,0xBA,0xEF,0x0C,0xC7,0xEF,0xA4,0xFB,0xCA,0xD3,
+    0xD5,0x6D,0x63,0x99,0x7D,0xDD,0x59,0x66,0x5F,0x77,0x8E,0xE1,0x18,0x3A,0xBF,0xF0,
+    0xE3,0xA9,0xAA,0xAF,0x9B,0xAE,0x2B,0x0C,0xA7,0x2C,0x0B,0xBF,0xED,0xEB,0xC6,0xB3,
+    0xFB,0xBE,0xB2,0x8C,0xAE,0xEB,0xFB,0xAA,0x2C,0x0B,0xBF,0x2A,0xDB,0xC2,0xB1,0xEB,
+    0xBE,0xF3,0xFC,0xBE,0xB0,0x2C,0xA3,0xEC,0xFA,0xC2,0x6A,0xCB,0xC2,0xB0,0xDA,0xB6,
+    0x31,0xDC,0xBE,0x6E,0x2C,0xBF,0x70,0x1C,0xCB,0x6B,0xEB,0xCA,0x31,0xEB,0xBE,0x51,
+    0xB6,0x75,0x7C,0x5F,0x78,0x0A,0xC3,0xF3,0x74,0x75,0x5D,0x79,0x66,0x5D,0xC7,0xF6,
+    0x75,0x74,0xE3,0x47,0x38,0x7E,0xCA,0x00,0x00,0x80,0x01,0x07,0x00,0x80,0x00,0x13,
+    0xCA,0x40,0xA1,0x21,0x2B,0x02,0x80,0x38,0x01,0x00,0x8F,0x24,0x89,0xA2,0x64,0x59,
+    0xA2,0x28,0x59,0x96,0x28,0x8A,0xA6,0xE8,0xBA,0xA2,0x68,0xBA,0xAE,0xA4,0x69,0xA6,
+    0xA9,0x69,0x9E,0x69,0x5A,0x9A,0x67,0x9A,0xA6,0x69,0xAA,0xB2,0x29,0x9A,0xAE,0x2C,
+    0x69,0x9A,0x69,0x5A,0x9E,0x66,0x9A,0x9A,0xA7,0x99,0xA6,0x68,0x9A,0xAE,0x6B,0x9A,
+    0xA6,0xAC,0x8A,0xA6,0x29,0xCB,0xA6,0x6A,0xCA,0xB2,0x69,0x9A,0xB2,0xEC,0xBA,0xB2,
+    0x6D,0xBB,0xAE,0x6C,0xDB,0xA2,0x69,0xCA,0xB2,0x69,0x9A,0xB2,0x6C,0x9A,0xA6,0x2C,
+    0xBB,0xB2,0xAB,0xDB,0xAE,0xEC,0xEA,0xBA,0xA4,0x59,0xA6,0xA9,0x79,0x9E,0x69,0x6A,
+    0x9E,0x67,0x9A,0xA6,0x6A,0xCA,0xB2,0x69,0x9A,0xAE,0xAB,0x79,0x9E,0x6A,0x7A,0x9E,
+    0x68,0xAA,0x9E,0x28,0xAA,0xAA,0x6A,0xAA,0xAA,0xAD,0xAA,0xAA,0x2C,0x5B,0x9E,0x67,
+    0x9A,0x9A,0xE8,0xA9,0xA6,0x27,0x8A,0xAA,0x6A,0xAA,0xA6,0xAD,0x9A,0xAA,0x2A,0xCB,
+    0xA6,0xAA,0xDA,0xB2,0x69,0xAA,0xB6,0x6C,0xAA,0xAA,0x6D,0xBB,0xAA,0xEC,0xFA,0xB2,
+    0x6D,0xEB,0xBA,0x69,0xAA,0xB2,0x6D,0xAA,0xA6,0x2D,0x9B,0xAA,0x6A,0xDB,0xAE,0xEC,
+    0xEA,0xB2,0x2C,0xDB,0xBA,0x2F,0x69,0x9A,0x69,0x6A,0x9E,0x67,0x9A,0x9A,0xE7,0x99,
+    0xA6,0x69,0x9A,0xB2,0x6C,0x9A,0xAA,0x2B,0x5B,0x9E,0xA7,0x9A,0x9E,0x28,0xAA,0xAA,
+    0xE6,0x89,0xA6,0x6A,0xAA,0xAA,0x2C,0x9B,0xA6,0xAA,0xCA,0x96,0xE7,0x99,0xAA,0x27,
+    0x8A,0xAA,0xEA,0x89,0x9E,0x6B,0x9A,0xAA,0x2A,0xCB,0xA6,0x6A,0xDA,0xAA,0x69,0x9A,
+    0xB6,0x6C,0xAA,0xAA,0x2D,0x9B,0xA6,0x2A,0xCB,0xAE,0x6D,0xFB,0xBE,0xEB,0xCA,0xB2,
+    0x6E,0xAA,0xAA,0x6C,0x9B,0xAA,0x6A,0xEB,0xA6,0x6A,0xCA,0xB2,0x6C,0xCB,0xBE,0xEF,
+    0xCA,0xAA,0xEE,0x8A,0xA6,0x29,0xCB,0xA6,0xAA,0xDA,0xB2,0x69,0xAA,0xB2,0x2D,0xDB,
+    0xB2,0xEF,0xCB,0xB2,0xAC,0xFB,0xA2,0x69,0xCA,0xB2,0x69,0xAA,0xB2,0x6D,0xAA,0xAA,
+    0x2E,0xCB,0xB2,0x6D,0x1B,0xB3,0x6C,0xFB,0xBA,0x68,0x9A,0xB2,0x6D,0xAA,0xA6,0x2D,
+    0x9B,0xAA,0x2A,0xDB,0xB2,0x2D,0xFB,0xBA,0x2C,0xDB,0xBA,0xEF,0xCA,0xAE,0x6F,0xAB,
+    0xAA,0xAC,0xEB,0xB2,0x2D,0xFB,0xBA,0xEE,0xFA,0xAE,0x70,0xEB,0xBA,0x30,0xBC,0xB2,
+    0x6C,0xFB,0xAA,0xAC,0xFA,0xBA,0x2B,0xDB,0xBA,0x6F,0xEB,0x32,0xDB,0xF6,0x7D,0x44,
+    0xD3,0x94,0x65,0x53,0x35,0x6D,0xDB,0x54,0x55,0x59,0x76,0x65,0xD9,0xF6,0x65,0xDB,
+    0xF6,0x7D,0xD1,0x34,0x6D,0x5B,0x55,0x55,0x5B,0x36,0x4D,0xD5,0xB6,0x65,0x59,0xF6,
+    0x7D,0x59,0xB6,0x6D,0x61,0x34,0x4D,0xD9,0x36,0x55,0x55,0xD6,0x4D,0xD5,0xB4,0x6D,
+    0x59,0x96,0x6D,0x61,0xB6,0x65,0xE1,0x76,0x65,0xD9,0xB7,0x65,0x5B,0xF6,0x75,0xD7,
+    0x95,0x75,0x5F,0xD7,0x7D,0xE3,0xD7,0x65,0xDD,0xE6,0xBA,0xB2,0xED,0xCB,0xB2,0xAD,
+    0xFB,0xAA,0xAB,0xFA,0xB6,0xEE,0xFB,0xC2,0x70,0xEB,0xAE,0xF0,0x0A,0x00,0x00,0x18,
+    0x70,0x00,0x00,0x08,0x30,0xA1,0x0C,0x14,0x1A,0xB2,0x12,0x00,0x88,0x02,0x00,0x00,
+    0x8C,0x61,0x8C,0x31,0x08,0x8D,0x52,0xCE,0x39,0x07,0xA1,0x51,0xCA,0x39,0xE7,0x20,
+    0x64,0xCE,0x41,0x08,0x21,0x95,0xCC,0x39,0x08,0x21,0x94,0x92,0x39,0x07,0xA1,0x94,
+    0x94,0x32,0xE7,0x20,0x94,0x92,0x52,0x08,0xA1,0x94,0x94,0x5A,0x0B,0x21,0x94,0x94,
+    0x52,0x6B,0x05,0x00,0x00,0x14,0x38,0x00,0x00,0x04,0xD8,0xA0,0x29,0xB1,0x38,0x40,
+    0xA1,0x21,0x2B,0x01,0x80,0x54,0x00,0x00,0x83,0xE3,0x58,0x96,0xE7,0x99,0xA2,0x6A,
+    0xDA,0xB2,0x63,0x49,0x9E,0x27,0x8A,0xAA,0xA9,0xAA,0xB6,0xED,0x48,0x96,0xE7,0x89,
+    0xA2,0x69,0xAA,0xAA,0x6D,0x5B,0x9E,0x27,0x8A,0xA6,0xA9,0xAA,0xAE,0xEB,0xEB,0x9A,
+    0xE7,0x89,0xA2,0x69,0xAA,0xAA,0xEB,0xEA,0xBA,0x68,0x9A,0xA6,0xA9,0xAA,0xAE,0xEB,
+    0xBA,0xBA,0x2E,0x9A,0xA2,0xA9,0xAA,0xAA,0xEB,0xBA,0xB2,0xAE,0x9B,0xA6,0xAA,0xAA,
+    0xAE,0x2B,0xBB,0xB2,0xEC,0xEB,0xA6,0xAA,0xAA,0xAA,0xEB,0xCA,0xAE,0x2C,0xFB,0xC2,
+    0xAA,0xBA,0xAE,0x2B,0xCB,0xB2,0x6D,0xEB,0xC2,0xB0,0xAA,0xAE,0xEB,0xCA,0xB2,0x6C,
+    0xDB,0xB6,0x6F,0xDC,0xBA,0xAE,0xEB,0xBE,0xEF,0xFB,0xC2,0x91,0xAD,0xEB,0xBA,0x2E,
+    0xFC,0xC2,0x31,0x0C,0x47,0x01,0x00,0xE0,0x09,0x0E,0x00,0x40,0x05,0x36,0xAC,0x8E,
+    0x70,0x52,0x34,0x16,0x58,0x68,0xC8,0x4A,0x00,0x20,0x03,0x00,0x80,0x30,0x06,0x21,
+    0x83,0x10,0x42,0x06,0x21,0x84,0x90,0x52,0x4A,0x21,0xA5,0x94,0x12,0x00,0x00,0x30,
+    0xE0,0x00,0x00,0x10,0x60,0x42,0x19,0x28,0x34,0x64,0x45,0x00,0x10,0x27,0x00,0x00,
+    0x18,0x43,0x29,0xA4,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,
+    0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x48,
+    0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,
+    0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,
+    0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0xA9,0xA4,0x94,
+    0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,
+    0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,
+    0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,
+    0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,
+    0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,
+    0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,
+    0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,
+    0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,
+    0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,
+    0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,
+    0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,
+    0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,
+    0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,
+    0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,0x95,
+    0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,
+    0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,
+    0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,
+    0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,
+    0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x29,0xA5,0x94,
+    0x52,0x4A,0x29,0xA5,0x94,0x52,0x0A,0x00,0x90,0x8A,0x70,0x00,0x90,0x7A,0x30,0xA1,
+    0x0C,0x14,0x1A,0xB2,0x12,0x00,0x48,0x05,0x00,0x00,0x8C,0x51,0x4A,0x29,0xC6,0x9C,
+    0x83,0x10,0x31,0xE6,0x18,0x63,0xD0,0x49,0x28,0x29,0x62,0xCC,0x39,0xC6,0x1C,0x94,
+    0x92,0x52,0xE5,0x1C,0x84,0x10,0x52,0x69,0x2D,0xB7,0xCA,0x39,0x08,0x21,0xA4,0xD4,
+    0x52,0x6D,0x99,0x73,0x52,0x5A,0x8B,0x31,0xE6,0x18,0x33,0xE7,0xA4,0xA4,0x14,0x5B,
+    0xCD,0x39,0x87,0x52,0x52,0x8B,0xB1,0xE6,0x9A,0x6B,0xEE,0xA4,0xB4,0x56,0x6B,0xAE,
+    0x35,0xE7,0x5A,0x5A,0xAB,0x35,0xD7,0x9C,0x73,0xCD,0xB9,0xB4,0x16,0x6B,0xAE,0x39,
+    0xD7,0x9C,0x73,0xCB,0x31,0xD7,0x9C,0x73,0xCE,0x39,0xE7,0x18,0x73,0xCE,0x39,0xE7,
+    0x9C,0x73,0xCE,0x05,0x00,0xE0,0x34,0x38,0x00,0x80,0x1E,0xD8,0xB0,0x3A,0xC2,0x49,
+    0xD1,0x58,0x60,0xA1,0x21,0x2B,0x01,0x80,0x54,0x00,0x00,0x02,0x19,0xA5,0x18,0x73,
+    0xCE,0x39,0xE8,0x10,0x52,0x8C,0x39,0xE7,0x1C,0x84,0x10,0x22,0x85,0x18,0x73,0xCE,
+    0x39,0x08,0x21,0x54,0x8C,0x39,0xE7,0x1C,0x74,0x10,0x42,0xA8,0x18,0x73,0xCC,0x39,
+    0x08,0x21,0x84,0x90,0x39,0xE7,0x1C,0x84,0x10,0x42,0x08,0x21,0x73,0x0E,0x3A,0xE8,
+    0x20,0x84,0x10,0x42,0x07,0x1D,0x84,0x10,0x42,0x08,0xA1,0x94,0xCE,0x41,0x08,0x21,
+    0x84,0x10,0x4A,0x28,0x21,0x84,0x10,0x42,0x08,0x21,0x84,0x10,0x3A,0x08,0x21,0x84,
+    0x10,0x42,0x08,0x21,0x84,0x10,0x42,0x08,0x21,0x84,0x52,0x4A,0x08,0x21,0x84,0x10,
+    0x42,0x09,0xA1,0x94,0x50,0x00,0x00,0x60,0x81,0x03,0x00,0x40,0x80,0x0D,0xAB,0x23,
+    0x9C,0x14,0x8D,0x05,0x16,0x1A,0xB2,0x12,0x00,0x00,0x02,0x00,0x80,0x1C,0x96,0xA0,
+    0x52,0xCE,0x84,0x41,0x8E,0x41,0x8F,0x0D,0x41,0xCA,0x51,0x33,0x0D,0x42,0x4C,0x39,
+    0xD1,0x99,0x62,0x4E,0x6A,0x33,0x15,0x53,0x90,0x39,0x10,0x9D,0x74,0x12,0x19,0x6A,
+    0x41,0xD9,0x5E,0x32,0x0B,0x00,0x00,0x80,0x20,0x00,0x20,0xC0,0x04,0x10,0x18,0x20,
+    0x28,0xF8,0x42,0x08,0x88,0x31,0x00,0x00,0x41,0x88,0xCC,0x10,0x09,0x85,0x55,0xB0,
+    0xC0,0xA0,0x0C,0x1A,0x1C,0xE6,0x01,0xC0,0x03,0x44,0x84,0x44,0x00,0x90,0x98,0xA0,
+    0x48,0xBB,0xB8,0x80,0x2E,0x03,0x5C,0xD0,0xC5,0x5D,0x07,0x42,0x08,0x42,0x10,0x82,
+    0x58,0x1C,0x40,0x01,0x09,0x38,0x38,0xE1,0x86,0x27,0xDE,0xF0,0x84,0x1B,0x9C,0xA0,
+    0x53,0x54,0xEA,0x20,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0xE0,0x01,0x00,0xE0,0xA0,
+    0x00,0x22,0x22,0x9A,0xAB,0xB0,0xB8,0xC0,0xC8,0xD0,0xD8,0xE0,0xE8,0xF0,0x08,0x00,
+    0x00,0x00,0x00,0x00,0x16,0x00,0xF8,0x00,0x00,0x38,0x3E,0x80,0x88,0x88,0xE6,0x2A,
+    0x2C,0x2E,0x30,0x32,0x34,0x36,0x38,0x3A,0x3C,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x80,0x80,
+};
+
+// 6 channels at 48000 Hz: 2 mappings with 4 coupling steps, 2 modes of 256 and 2048 samples
+static const uint8_t SurroundPrivate[6539] = {
+    0x02,0x1E,0x5A,0x01,0x76,0x6F,0x72,0x62,0x69,0x73,0x00,0x00,0x00,0x00,0x06,0x80,
+    0xBB,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xD4,0x01,0x00,0x00,0x00,0x00,0x00,0xB8,
+    0x01,0x03,0x76,0x6F,0x72,0x62,0x69,0x73,0x34,0x00,0x00,0x00,0x58,0x69,0x70,0x68,
+    0x2E,0x4F,0x72,0x67,0x20,0x6C,0x69,0x62,0x56,0x6F,0x72,0x62,0x69,0x73,0x20,0x49,
+    0x20,0x32,0x30,0x32,0x30,0x30,0x37,0x30,0x34,0x20,0x28,0x52,0x65,0x64,0x75,0x63,
+    0x69,0x6E,0x67,0x20,0x45,0x6E,0x76,0x69,0x72,0x6F,0x6E,0x6D,0x65,0x6E,0x74,0x29,
+    0x01,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x45,0x4E,0x43,0x4F,0x44,0x45,0x52,0x3D,
+    0x6C,0x69,0x62,0x73,0x6E,0x64,0x66,0x69,0x6C,0x65,0x01,0x05,0x76,0x6F,0x72,0x62,
+    0x69,0x73,0x25,0x42,0x43,0x56,0x01,0x00,0x00,0x01,0x00,0x18,0x63,0x54,0x29,0x46,
+    0x99,0x52,0xD2,0x4A,0x89,0x19,0x73,0x94,0x31,0x46,0x99,0x62,0x92,0x4A,0x89,0xA5,
+    0x84,0x16,0x42,0x48,0x9D,0x73,0x14,0x53,0xA9,0x39,0xD7,0x9C,0x6B,0xAC,0xB9,0xB5,
+    0x20,0x84,0x10,0x1A,0x53,0x50,0x29,0x05,0x99,0x52,0x8E,0x52,0x69,0x19,0x63,0x90,
+    0x29,0x05,0x99,0x52,0x10,0x4B,0x49,0x25,0x74,0x12,0x3A,0x27,0x9D,0x63,0x10,0x5B,
+    0x49,0xC1,0xD6,0x98,0x6B,0x8B,0x41,0xB6,0x1C,0x84,0x0D,0x9A,0x52,0x4C,0x29,0xC4,
+    0x94,0x52,0x8A,0x42,0x08,0x19,0x53,0x8C,0x29,0xC5,0x94,0x52,0x4A,0x42,0x07,0x25,
+    0x74,0x0E,0x3A,0xE6,0x1C,0x53,0x8E,0x4A,0x28,0x41,0xB8,0x9C,0x73,0xAB,0xB5,0x96,
+    0x96,0x63,0x8B,0xA9,0x74,0x92,0x4A,0xE7,0x24,0x64,0x4C,0x42,0x48,0x29,0x85,0x92,
+    0x4A,0x07,0xA5,0x53,0x4E,0x42,0x48,0x35,0x96,0xD6,0x52,0x29,0x1D,0x73,0x52,0x52,
+    0x6A,0x41,0xE8,0x20,0x84,0x10,0x42,0xB6,0x20,0x84,0x0D,0x82,0xD0,0x90,0x55,0x00,
+    0x00,0x01,0x00,0xC0,0x40,0x10,0x1A,0xB2,0x0A,0x00,0x50,0x00,0x00,0x10,0x8A,0xA1,
+    0x18,0x8A,0x02,0x84,0x86,0xAC,0x02,0x00,0x32,0x00,0x00,0x04,0xA0,0x28,0x8E,0xE2,
+    0x28,0x8E,0x23,0x39,0x92,0x63,0x49,0x16,0x10,0x1A,0xB2,0x0A,0x00,0x00,0x02,0x00,
+    0x10,0x00,0x00,0xC0,0x70,0x14,0x49,0x91,0x14,0xC9,0xB1,0x24,0x4B,0xD2,0x2C,0x4B,
+    0xD3,0x44,0x51,0x55,0x7D,0xD5,0x36,0x55,0x55,0xF6,0x75,0x5D,0xD7,0x75,0x5D,0xD7,
+    0x75,0x20,0x34,0x64,0x15,0x00,0x00,0x01,0x00,0x40,0x48,0xA7,0x99,0xA5,0x1A,0x20,
+    0xC2,0x0C,0x64,0x18,0x08,0x0D,0x59,0x05,0x00,0x20,0x00,0x00,0x00,0x46,0x28,0xC2,
+    0x10,0x03,0x42,0x43,0x56,0x01,0x00,0x00,0x01,0x00,0x00,0x62,0x28,0x39,0x88,0x26,
+    0xB4,0xE6,0x7C,0x73,0x8E,0x83,0x66,0x39,0x68,0x2A,0xC5,0xE6,0x74,0x70,0x22,0xD5,
+    0xE6,0x49,0x6E,0x2A,0xE6,0xE6,0x9C,0x73,0xCE,0x39,0x27,0x9B,0x73,0xC6,0x38,0xE7,
+    0x9C,0x73,0x8A,0x72,0x66,0x31,0x68,0x26,0xB4,0xE6,0x9C,0x73,0x12,0x83,0x66,0x29,
+    0x68,0x26,0xB4,0xE6,0x9C,0x73,0x9E,0xC4,0xE6,0x41,0x6B,0xAA,0xB4,0xE6,0x9C,0x73,
+    0xC6,0x39,0xA7,0x83,0x71,0x46,0x18,0xE7,0x9C,0x73,0x9A,0xB4,0xE6,0x41,0x6A,0x36,
+    0xD6,0xE6,0x9C,0x73,0x16,0xB4,0xA6,0x39,0x6A,0x2E,0xC5,0xE6,0x9C,0x73,0x22,0xE5,
+    0xE6,0x49,0x6D,0x2E,0xD5,0xE6,0x9C,0x73,0xCE,0x39,0xE7,0x9C,0x73,0xCE,0x39,0xE7,
+    0x9C,0x73,0xAA,0x17,0xA7,0x73,0x70,0x4E,0x38,0xE7,0x9C,0x73,0xA2,0xF6,0xE6,0x5A,
+    0x6E,0x42,0x17,0xE7,0x9C,0x73,0x3E,0x19,0xA7,0x7B,0x73,0x42,0x38,0xE7,0x9C,0x73,
+    0xCE,0x39,0xE7,0x9C,0x73,0xCE,0x39,0xE7,0x9C,0x73,0x82,0xD0,0x90,0x55,0x00,0x00,
+    0x10,0x00,0x00,0x41,0x18,0x36,0x86,0x71,0xA7,0x20,0x48,0x9F,0xA3,0x81,0x18,0x45,
+    0x88,0x69,0xC8,0xA4,0x07,0xDD,0xA3,0xC3,0x24,0x68,0x0C,0x72,0x0A,0xA9,0x47,0xA3,
+    0xA3,0x91,0x52,0xEA,0x20,0x94,0x54,0xC6,0x49,0x29,0x9D,0x20,0x34,0x64,0x15,0x00,
+    0x00,0x08,0x00,0x00,0x21,0x84,0x14,0x52,0x48,0x21,0x85,0x14,0x52,0x48,0x21,0x85,
+    0x14,0x52,0x88,0x21,0x86,0x18,0x62,0xC8,0x29,0xA7,0x9C,0x82,0x0A,0x2A,0xA9,0xA4,
+    0xA2,0x8A,0x32,0xCA,0x2C,0xB3,0xCC,0x32,0xCB,0x2C,0xB3,0xCC,0x32,0xEB,0xB0,0xB3,
+    0xCE,0x3A,0xEC,0x30,0xC4,0x10,0x43,0x0C,0xAD,0xB4,0x12,0x4B,0x4D,0xB5,0xD5,0x58,
+    0x63,0xAD,0xB9,0xE7,0x9C,0x6B,0x0E,0xD2,0x5A,0x69,0xAD,0xB5,0xD6,0x4A,0x29,0xA5,
+    0x94,0x52,0x4A,0x29,0x08,0x0D,0x59,0x05,0x00,0x80,0x00,0x00,0x10,0x08,0x19,0x64,
+    0x90,0x41,0x46,0x21,0x85,0x14,0x52,0x88,0x21,0xA6,0x9C,0x72,0xCA,0x29,0xA8,0xA0,
+    0x02,0x42,0x43,0x56,0x01,0x00,0x80,0x00,0x00,0x02,0x00,0x00,0x00,0x3C,0xC9,0x73,
+    0x44,0x47,0x74,0x44,0x47,0x74,0x44,0x47,0x74,0x44,0x47,0x74,0x44,0xC7,0x73,0x3C,
+    0x47,0x94,0x44,0x49,0x94,0x44,0x49,0xB4,0x4C,0xCB,0xD4,0x4C,0x4F,0x15,0x55,0xD5,
+    0x95,0x5D,0x5B,0xD6,0x65,0xDD,0xF6,0x6D,0x61,0x17,0x76,0xDD,0xF7,0x75,0xDF,0xF7,
+    0x75,0xE3,0xD7,0x85,0x61,0x59,0x96,0x65,0x59,0x96,0x65,0x59,0x96,0x65,0x59,0x96,
+    0x65,0x59,0x96,0x65,0x59,0x82,0xD0,0x90,0x55,0x00,0x00,0x08,0x00,0x00,0x80,0x10,
+    0x42,0x08,0x21,0x85,0x14,0x52,0x48,0x21,0xA5,0x18,0x63,0xCC,0x31,0xE7,0xA0,0x93,
+    0x50,0x42,0x20,0x34,0x64,0x15,0x00,0x00,0x08,0x00,0x20,0x00,0x00,0x00,0xC0,0x51,
+    0x1C,0xC5,0x71,0x24,0x47,0x72,0x24,0xC9,0x92,0x2C,0x49,0x93,0x34,0x4B,0xB3,0x3C,
+    0xCD,0xD3,0x3C,0x4D,0xF4,0x44,0x51,0x14,0x4D,0xD3,0x54,0x45,0x57,0x74,0x45,0xDD,
+    0xB4,0x45,0xD9,0x94,0x4D,0xD7,0x74,0x4D,0xD9,0x74,0x55,0x59,0xB5,0x5D,0x59,0xB6,
+    0x6D,0xD9,0xD6,0x6D,0x5F,0x96,0x6D,0xDF,0xF7,0x7D,0xDF,0xF7,0x7D,0xDF,0xF7,0x7D,
+    0xDF,0xF7,0x7D,0xDF,0xF7,0x75,0x1D,0x08,0x0D,0x59,0x05,0x00,0x48,0x00,0x00,0xE8,
+    0x48,0x8E,0xA4,0x48,0x8A,0xA4,0x48,0x8E,0xE3,0x38,0x92,0x24,0x01,0xA1,0x21,0xAB,
+    0x00,0x00,0x19,0x00,0x00,0x01,0x00,0x28,0x8A,0xA3,0x38,0x8E,0xE3,0x48,0x92,0x24,
+    0x49,0x96,0xA4,0x49,0x9E,0xE5,0x59,0xA2,0x66,0x6A,0xA6,0x67,0x7A,0xAA,0xA8,0x02,
+    0xA1,0x21,0xAB,0x00,0x00,0x40,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x28,0x9A,
+    0xE2,0x29,0xA6,0xE2,0x29,0xA2,0xE2,0x39,0xA2,0x23,0x4A,0xA2,0x65,0x5A,0xA2,0xA6,
+    0x6A,0xAE,0x28,0x9B,0xB2,0xEB,0xBA,0xAE,0xEB,0xBA,0xAE,0xEB,0xBA,0xAE,0xEB,0xBA,
+    0xAE,0xEB,0xBA,0xAE,0xEB,0xBA,0xAE,0xEB,0xBA,0xAE,0xEB,0xBA,0xAE,0xEB,0xBA,0xAE,
+    0xEB,0xBA,0xAE,0xEB,0xBA,0xAE,0xEB,0xBA,0x2E,0x10,0x1A,0xB2,0x0A,0x00,0x90,0x00,
+    0x00,0xD0,0x91,0x1C,0xC9,0x91,0x1C,0x49,0x91,0x14,0x49,0x91,0x1C,0xC9,0x01,0x42,
+    0x43,0x56,0x01,0x00,0x32,0x00,0x00,0x02,0x00,0x70,0x0C,0xC7,0x90,0x14,0xC9,0xB1,
+    0x2C,0x4B,0xD3,0x3C,0xCD,0xD3,0x3C,0x4D,0xF4,0x44,0x4F,0xF4,0x4C,0x4F,0x15,0x5D,
+    0xD1,0x05,0x42,0x43,0x56,0x01,0x00,0x80,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x24,0xC3,0x52,0x2C,0x47,0x73,0x34,0x49,0x94,0x54,0x4B,0xB5,0x54,0x4D,0xB5,
+    0x54,0x4B,0x15,0x55,0x4F,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x35,0x4D,0xD3,0x34,0x4D,0x20,0x34,0x64,0x25,0x00,
+    0x10,0x03,0x00,0x80,0x10,0xE6,0x24,0xF6,0x44,0x20,0x06,0xB1,0x57,0xC6,0x28,0xA9,
+    0x39,0x43,0x88,0x49,0xAC,0xA1,0x83,0x10,0x52,0x6C,0xA9,0x85,0xCC,0x51,0x6D,0xA5,
+    0x42,0x4C,0x02,0xA1,0x21,0xAB,0x02,0x80,0x79,0x00,0x00,0x83,0x61,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x08,0x70,
+    0x00,0x00,0x08,0xB0,0x10,0x0A,0x0D,0x59,0x15,0x00,0xCC,0x03,0x00,0x18,0x24,0x89,
+    0xA6,0xF1,0x3C,0xA2,0xC8,0x75,0x79,0x1E,0x51,0xE4,0xBA,0x3C,0x8F,0x65,0x51,0x55,
+    0xAE,0xCB,0x75,0xE9,0x3A,0x55,0xE5,0xBA,0x74,0x9D,0xEB,0x92,0x24,0x92,0xC4,0xB2,
+    0x68,0x1A,0x55,0x65,0x59,0x34,0x8D,0xA9,0xB2,0x2C,0x9A,0x46,0x55,0xB9,0x2E,0x55,
+    0xA5,0xEB,0x4C,0x93,0xEB,0xD2,0x75,0xAE,0xCB,0xB2,0xB8,0x2E,0xD7,0xE5,0xBA,0x74,
+    0x9D,0xAA,0x72,0x5D,0xBA,0xCE,0x75,0x01,0x00,0x00,0xC0,0xF3,0xB8,0x2E,0xD7,0xE5,
+    0xBA,0x74,0x9D,0xEB,0x52,0x5D,0xBA,0x4F,0x55,0x59,0x16,0xD5,0xE5,0xBA,0x5C,0x97,
+    0xAF,0x73,0x5D,0xB2,0x4B,0xB7,0xB9,0x2E,0x00,0x00,0x00,0x04,0x00,0x00,0x0E,0x38,
+    0x00,0x00,0x0E,0x58,0x08,0x85,0x86,0xAC,0x0A,0x00,0xE6,0x01,0x00,0x0C,0x8A,0x42,
+    0x14,0x89,0x22,0xD3,0x24,0x8A,0x4C,0x93,0x69,0x12,0x45,0xA6,0x49,0xD3,0x68,0x1A,
+    0xCB,0xE2,0x79,0x34,0x8D,0xE7,0xF1,0x44,0x9E,0xC7,0xF3,0x68,0x1A,0x51,0xE4,0x79,
+    0x4C,0x93,0x28,0x32,0x4D,0xA6,0x49,0x14,0x99,0x26,0x51,0xA4,0xAA,0x54,0x95,0xEB,
+    0x52,0x55,0xAE,0x4B,0x96,0xB9,0x2E,0xD9,0xE5,0x79,0x5C,0x97,0xEB,0x92,0x65,0xAE,
+    0x4B,0x96,0xC9,0x32,0x59,0x26,0xCB,0x34,0x0D,0x00,0x00,0x80,0x28,0x52,0x55,0xAE,
+    0x4B,0x96,0xB9,0x2E,0x59,0x26,0xCB,0x5C,0x97,0xEB,0xF2,0x3C,0xAE,0xCB,0x75,0xC9,
+    0x32,0x59,0x26,0xDB,0x6C,0x99,0x2C,0x93,0x65,0x9A,0x06,0x00,0x00,0x20,0x00,0x00,
+    0x20,0xC0,0x01,0x00,0x20,0xC0,0x42,0x28,0x34,0x64,0x55,0x00,0x30,0x0F,0x00,0x60,
+    0xB0,0x2C,0xCD,0xF3,0x34,0xCF,0xD3,0x44,0xD1,0x74,0x55,0xD1,0xF3,0x34,0x51,0x54,
+    0x5D,0x57,0x14,0x45,0x4B,0xD3,0x4C,0x55,0x35,0x55,0xD5,0x54,0x55,0x59,0xB6,0x5D,
+    0xD7,0x55,0x55,0xD5,0xB6,0x6D,0xD7,0x75,0x2D,0x49,0x12,0x2D,0x49,0xB4,0x2C,0x51,
+    0xD3,0x5C,0xD3,0x54,0x2D,0xCB,0xD4,0x34,0xD9,0x34,0x5D,0x4D,0xD3,0x3C,0xCF,0x35,
+    0x4D,0xD7,0x34,0x55,0xD3,0xD4,0x65,0x59,0x16,0x45,0x57,0x55,0x7D,0x59,0xD6,0x55,
+    0xD5,0xD3,0x34,0xD7,0x75,0x5D,0x55,0x75,0x55,0xD5,0xB6,0x6D,0xDB,0x75,0x5D,0xD7,
+    0xF5,0x75,0xDD,0x76,0x5D,0xA6,0xC9,0x75,0xB9,0x2E,0x55,0x65,0xDB,0x54,0x95,0xEB,
+    0xD2,0x75,0xAA,0xEA,0x79,0x9E,0xAC,0xAA,0xB2,0x69,0xCA,0xAA,0xAA,0xCB,0xB2,0xAD,
+    0xAA,0xAE,0x69,0xFA,0xB6,0x6D,0x9B,0xA6,0xA8,0x69,0xB2,0xAA,0xCA,0xAA,0xEA,0xAA,
+    0xAA,0x6F,0xDB,0xB6,0xEB,0xCA,0xAE,0xAB,0xDB,0xB6,0x2E,0xBB,0x54,0x95,0xEB,0x72,
+    0x5D,0xAE,0x4B,0xD7,0xB9,0x2E,0xD9,0x65,0xEB,0x5C,0x57,0x00,0x00,0x50,0x81,0x03,
+    0x00,0x50,0x81,0x85,0x50,0x68,0xC8,0xAA,0x00,0xA0,0x86,0x01,0x80,0x30,0xC6,0x39,
+    0x69,0x2D,0xA5,0x90,0x52,0x8B,0xA9,0xB5,0x94,0x52,0x6B,0xAD,0x95,0xD8,0x62,0x4C,
+    0xAD,0xC5,0x98,0x5A,0x8B,0x31,0xB5,0x18,0x63,0x8A,0x31,0xC6,0x12,0x63,0x8B,0xA9,
+    0xB5,0x5A,0x53,0x6C,0xAD,0xA5,0xD6,0x62,0x4C,0x31,0xB6,0x96,0x62,0x8C,0x31,0xB5,
+    0x16,0x63,0x8A,0xB1,0xB5,0xD4,0x5A,0x8C,0x29,0xC6,0xD6,0x52,0x8C,0x31,0xA6,0xD6,
+    0x6A,0x4D,0x31,0xB6,0x96,0x5A,0x8B,0x31,0xC5,0xD8,0x5A,0x2A,0xA5,0x94,0x56,0x4A,
+    0x4A,0xA9,0x73,0x94,0x62,0x29,0xA5,0xB4,0x52,0x4A,0x89,0x29,0xA5,0x14,0x4B,0x49,
+    0x29,0xA6,0xD4,0x5A,0x4C,0x29,0xA5,0x98,0x52,0x6B,0x31,0xA5,0xD6,0x62,0x29,0x29,
+    0xC5,0x94,0x52,0x8A,0xA9,0xA4,0x14,0x53,0x4A,0x29,0xA6,0x94,0x52,0x2C,0x25,0xA5,
+    0x98,0x52,0x4A,0xAD,0xA4,0x94,0x62,0x4A,0x29,0xC5,0x94,0x52,0x8A,0xA5,0xA4,0x14,
+    0x53,0x4A,0x29,0xA6,0x94,0x52,0x4C,0x29,0xA5,0x54,0x4A,0x29,0xAD,0x94,0x10,0x5A,
+    0x6B,0x29,0xC5,0xD6,0x42,0x88,0xAD,0x95,0xD2,0x5A,0x6B,0x2D,0xC6,0x58,0x6B,0x6C,
+    0x2D,0xA5,0x18,0x63,0x6B,0xB1,0xB5,0x94,0x62,0x8B,0x29,0xC5,0x18,0x6B,0x8D,0xAD,
+    0x95,0x12,0x63,0x4C,0x29,0xB6,0x56,0x4A,0x8C,0x31,0xA5,0x18,0x63,0xAD,0xB1,0xB5,
+    0x52,0x62,0x8C,0x29,0xC5,0x16,0x4B,0x89,0x31,0xA6,0x14,0x63,0xAC,0x35,0xB6,0x56,
+    0x4A,0x8C,0x31,0xA5,0x18,0x5B,0x29,0xB5,0xB5,0xCE,0x69,0x6B,0x21,0xD4,0x94,0x42,
+    0xA8,0xAD,0x75,0x4E,0x53,0xCA,0x98,0xC6,0x58,0x4A,0x6E,0xAD,0x94,0x1C,0x63,0x29,
+    0xB9,0xB5,0x10,0x72,0x8C,0xA5,0xE4,0x18,0x4B,0xC9,0xAD,0x95,0x92,0x63,0x2C,0xA5,
+    0xB6,0x16,0x42,0x8D,0x31,0x84,0x1A,0x63,0x08,0xB9,0xB5,0x10,0x72,0x8C,0x21,0xD4,
+    0xD6,0x42,0xA8,0x31,0x86,0x50,0x63,0x0C,0x21,0xB7,0x16,0x42,0x8D,0x31,0x84,0xDA,
+    0x5A,0x08,0x35,0xC6,0x10,0x62,0x6B,0x9D,0xC3,0x18,0x3B,0xA7,0x31,0x86,0x10,0x63,
+    0xCC,0x98,0xC6,0xD8,0x39,0xAD,0xB5,0x94,0x5A,0x6B,0x4A,0xB5,0xD6,0x10,0x6A,0xAD,
+    0xA5,0xD4,0x5A,0x43,0xA8,0xB5,0x96,0x90,0x6B,0x4D,0xA9,0xD6,0x1A,0x42,0xAD,0xB5,
+    0x94,0x5A,0x6B,0x08,0xB5,0xD6,0x10,0x72,0xAD,0x29,0xD5,0x5A,0x3B,0xA7,0xB5,0x86,
+    0x50,0x6B,0xED,0x9C,0xD6,0x1A,0x42,0xAE,0x35,0xA5,0x5A,0x6B,0xE7,0xB4,0xD6,0x10,
+    0x6A,0xAD,0x9D,0xB3,0xD6,0x62,0xEC,0x39,0xA7,0xD4,0x73,0x6F,0x2D,0xF8,0x9E,0x52,
+    0xD0,0xB9,0xA5,0xDE,0x7B,0x8B,0x3D,0xE7,0x18,0x7B,0xEF,0xAD,0xF5,0x9E,0x63,0xEC,
+    0xBD,0xB7,0xD6,0x7B,0x8F,0x31,0xF8,0x5E,0x6B,0x10,0xBE,0xB5,0xE0,0x7B,0x8C,0x41,
+    0xF8,0x16,0x7B,0x0F,0xB2,0x05,0xDF,0x6B,0x0C,0xBE,0xB7,0x16,0x7C,0x6F,0x2D,0xF8,
+    0xE0,0x5A,0x10,0x42,0xC6,0xDE,0x7B,0xAC,0x41,0xF8,0xD6,0x7A,0xEF,0x31,0x06,0x21,
+    0x5C,0x8B,0xB5,0x96,0xD2,0x6B,0x6D,0xAD,0xE7,0x5C,0x6B,0xAF,0xB5,0xB5,0x5C,0x6B,
+    0x8C,0x41,0xE7,0x1A,0x7B,0xCF,0x39,0xF7,0x9C,0x6B,0xED,0x39,0xD7,0x1A,0x74,0xAE,
+    0xB5,0xE7,0x5C,0x6B,0xEF,0x39,0xE7,0xA0,0x73,0x8C,0x3D,0xE7,0x5A,0x83,0xCE,0x31,
+    0x06,0x9D,0x6B,0xED,0x39,0xE7,0xDC,0x6B,0x8D,0xB1,0xE7,0x5C,0x6B,0xAF,0x35,0xC6,
+    0xA0,0x73,0xAD,0xBD,0xE7,0x9C,0x83,0xAD,0x31,0xF6,0x9C,0x6B,0x0D,0xB6,0xC6,0x18,
+    0x53,0x2A,0xA5,0xD7,0x1A,0x63,0xAE,0x35,0xC6,0x5E,0x6B,0x6B,0xBD,0xD6,0xD6,0x72,
+    0xCE,0xB5,0xF6,0x5A,0x6B,0xED,0xB9,0xD6,0xDA,0x6B,0xAD,0xB5,0xE7,0x5C,0x63,0xCF,
+    0xB9,0xD6,0x5E,0x6B,0xAD,0x41,0xE7,0x5A,0x7B,0xAD,0xB5,0xF6,0x9C,0x63,0xED,0x39,
+    0xD7,0xDA,0x6B,0xAD,0xB5,0xE7,0x1C,0x63,0xAF,0x35,0xC6,0x9E,0x73,0x8C,0x3D,0xE7,
+    0x5A,0x7B,0xAD,0xB5,0x06,0x9D,0x63,0xEC,0xB9,0xC6,0x18,0x74,0x8E,0xB1,0xD6,0x1A,
+    0x42,0xAD,0x35,0x08,0x9B,0x73,0x31,0xB6,0xD6,0xA2,0x6C,0xAD,0xC5,0xE8,0x9C,0x93,
+    0xD1,0x3D,0x17,0xA7,0x73,0x2E,0x4A,0xE7,0x9C,0x94,0xCE,0xB9,0x38,0x9D,0x73,0x51,
+    0x3A,0xF7,0x66,0x74,0xCE,0xC5,0xE8,0x9C,0x93,0xD2,0x39,0x17,0xA5,0x73,0x2E,0x4A,
+    0xE7,0x9C,0x94,0xCD,0x35,0x29,0x9D,0x73,0x53,0xBA,0xD6,0x64,0x6C,0xCE,0x45,0xE9,
+    0xDC,0x9B,0xB3,0xB5,0x16,0xA5,0x73,0x4E,0xC6,0xD6,0x5A,0x8C,0x6D,0x2D,0x84,0x58,
+    0x6B,0x31,0x36,0xC6,0xA2,0x6C,0xAD,0xC5,0xD8,0x5A,0x8B,0xD1,0x39,0x27,0xA5,0x6B,
+    0x4D,0xC6,0xE6,0x9C,0x8C,0xAE,0xB5,0x18,0x9D,0x73,0x32,0x36,0xE7,0xA4,0x74,0xAD,
+    0xC9,0xD8,0x9C,0x93,0xD1,0xB5,0x26,0x63,0x73,0x4E,0x46,0xE7,0x1C,0x8D,0xAE,0x35,
+    0x19,0x9B,0x73,0x51,0x36,0xD7,0xA6,0x6C,0xCE,0x45,0xD9,0x9C,0x93,0xD2,0xB5,0x26,
+    0x67,0x73,0x2E,0xC6,0xD6,0x9A,0x94,0xCD,0x39,0x19,0xD7,0x5A,0x8C,0x3D,0xE7,0x94,
+    0x7A,0xCE,0xAD,0xF5,0xDE,0x53,0xEA,0x39,0xA7,0xD4,0x7B,0x8F,0x31,0xF8,0x1E,0x63,
+    0x10,0xC2,0xB5,0xDE,0x7B,0x8C,0xC1,0x07,0xD9,0x72,0xEF,0xAD,0xF5,0x9C,0x63,0x0C,
+    0xBE,0xB7,0xD6,0x7B,0x6E,0xAD,0xF7,0xDE,0x5A,0x10,0x3E,0xB6,0xDE,0x7B,0x8C,0xC1,
+    0xF7,0xD6,0x82,0xEF,0xAD,0x05,0xE1,0x5B,0xEB,0xC1,0xB7,0x16,0x74,0x8E,0x31,0xF8,
+    0xDE,0x5A,0xEF,0xBD,0xB5,0xDE,0x7B,0x6B,0x31,0xC6,0x10,0x72,0xAD,0x31,0xF6,0x5C,
+    0x6B,0xED,0xB5,0xC6,0x98,0x6B,0x8D,0x31,0xE8,0x5C,0x6B,0xCF,0x39,0xE7,0x9E,0x73,
+    0xAD,0x3D,0xE7,0x9C,0x83,0xCE,0xB5,0xF6,0x9C,0x6B,0xED,0x39,0xE7,0x1C,0x6C,0xAE,
+    0xB5,0xE7,0x5C,0x6B,0xD0,0x39,0xD6,0xA0,0x73,0xAD,0x3D,0xE7,0x9C,0x83,0xAD,0x31,
+    0xF6,0x9C,0x6B,0x0D,0xB6,0xC6,0x18,0x74,0xAE,0xB5,0xE7,0x9E,0x73,0xB0,0x35,0xC6,
+    0x9E,0x73,0xAD,0xC5,0xD6,0x18,0x63,0x4A,0x29,0xE5,0x5A,0x5B,0xCB,0xB5,0xC6,0xD8,
+    0x6B,0x6D,0xAD,0xC7,0xDA,0x5A,0xCF,0x39,0xC6,0x5E,0x6B,0xAD,0x3D,0xE7,0x18,0x7B,
+    0xAD,0x31,0xF6,0x9A,0x63,0xCC,0x39,0xC7,0xD8,0x6B,0xAD,0xB1,0xD7,0x1A,0x63,0xAF,
+    0x35,0xC6,0x9E,0x73,0x8C,0x3D,0xE7,0x18,0x7B,0xAD,0xB5,0xF6,0x9C,0x5B,0xEB,0xB5,
+    0xC6,0xD8,0x73,0x6E,0xAD,0xE7,0x1C,0x63,0xAF,0xB5,0xD6,0xA0,0x6B,0x6B,0xBD,0xD6,
+    0x18,0x7B,0xCE,0xAD,0xD5,0x5A,0x3B,0xA7,0xB5,0x06,0x63,0x73,0x0E,0xC6,0xD6,0x1A,
+    0x8C,0xAD,0xB5,0x18,0x9B,0x73,0x31,0xB6,0xE7,0xA4,0x74,0xCE,0x45,0xE9,0x9E,0x9B,
+    0xD2,0x39,0x17,0x63,0x73,0x2E,0x4A,0xF7,0xDE,0x94,0xCE,0x39,0x09,0x9B,0x73,0x33,
+    0x36,0xE7,0x62,0x6C,0xCE,0x45,0xD9,0x9C,0x93,0xB3,0xB5,0x16,0x63,0x73,0x2E,0xCA,
+    0xD6,0x5A,0x94,0xCD,0x39,0x19,0xDD,0x7B,0x93,0xB6,0xE6,0xA4,0x6C,0xCE,0x49,0xD9,
+    0x5A,0x93,0x91,0xAD,0x85,0x10,0x6B,0x2D,0xCA,0xD6,0x5A,0x94,0xAD,0xB5,0x18,0x5B,
+    0x6B,0x31,0x36,0xE7,0xA4,0x74,0xAD,0xC9,0xE8,0x9C,0x93,0xD2,0xB5,0x26,0x67,0x73,
+    0x2E,0xCA,0xE6,0xDC,0x8C,0xAE,0xB5,0x18,0x9B,0x73,0x31,0xB6,0xD6,0xA4,0x6C,0xCE,
+    0xC5,0xD8,0x9C,0x93,0xD1,0xB5,0x26,0x65,0x73,0x4E,0x46,0xD7,0x9A,0x8C,0xAD,0xB9,
+    0x28,0x9B,0x73,0x32,0xBA,0xD6,0xA2,0x6C,0xAE,0xC9,0xD9,0x5A,0x93,0xB2,0x39,0x27,
+    0xE5,0x5A,0x8B,0xB1,0xF7,0x9E,0x52,0xEF,0xBD,0xB5,0xE0,0x7B,0x4A,0x41,0xE7,0x94,
+    0x7A,0xEF,0x31,0x06,0xDD,0x63,0xEC,0xBD,0xB7,0x16,0x7C,0x8F,0x31,0x08,0xDF,0x5A,
+    0x10,0x3E,0xC6,0xE0,0x7B,0x8C,0x41,0x08,0xD7,0x82,0xEF,0x31,0x06,0x21,0x5C,0xEB,
+    0xBD,0xB7,0x16,0x74,0x8E,0x31,0xF8,0x9E,0x52,0xF0,0xBD,0xB5,0xDE,0x7B,0x4A,0x3D,
+    0xF8,0xD6,0x82,0xEF,0x31,0x06,0xE1,0x5B,0x0B,0xC2,0xB7,0x16,0x7C,0x4F,0x29,0xD6,
+    0x1A,0x42,0xAF,0x35,0xC6,0x5E,0x73,0xAD,0xBD,0xD6,0xD6,0x7A,0xAD,0x31,0x06,0x9D,
+    0x6B,0xED,0x39,0xE7,0x1C,0x74,0xAE,0xB5,0xE7,0x5C,0x6B,0xD0,0xB9,0xD6,0x9E,0x73,
+    0xAD,0x3D,0xE7,0xDC,0x83,0xCD,0xB5,0xF6,0x9C,0x6B,0x0D,0x3A,0xD7,0xDA,0x73,0xAE,
+    0xB5,0xE7,0x9C,0x73,0xB0,0x35,0xC6,0x9E,0x73,0xAD,0xBD,0xD6,0x18,0x83,0xCE,0xB5,
+    0xF6,0x9E,0x73,0x0E,0xB6,0xC6,0xD8,0x73,0xAE,0x35,0xD8,0x1A,0x63,0x4C,0xA9,0x94,
+    0x5E,0x6B,0x6B,0x39,0xC6,0xD8,0x7A,0xAD,0x29,0xF5,0x5A,0x53,0xEA,0x35,0xC7,0xDA,
+    0x6B,0x8D,0xB1,0xE7,0x1C,0x63,0xAF,0x35,0xC6,0x9E,0x73,0x8C,0x3D,0xE7,0x18,0x83,
+    0xAD,0xB5,0x06,0x9D,0x63,0xEC,0x35,0xC7,0xD8,0x73,0x8E,0xB1,0xE7,0x1C,0x63,0xAF,
+    0x35,0xC6,0xA0,0x73,0x6B,0xBD,0xD6,0xD6,0x7A,0xCE,0xAD,0xF5,0x9C,0x63,0xEC,0xB5,
+    0xC6,0x18,0x74,0x6E,0x2D,0xD8,0xDA,0x5A,0xCF,0xB9,0xB5,0x58,0x6B,0xE7,0xB0,0xD6,
+    0x62,0x64,0xCE,0xC1,0xD8,0x5A,0x8B,0xB2,0xB5,0x26,0x63,0x73,0x4E,0x46,0xE7,0x1E,
+    0x8D,0xCE,0x39,0x29,0xDB,0x7B,0x52,0x36,0xE7,0xA2,0x6C,0xCE,0xC9,0xD9,0xDE,0x93,
+    0xD1,0x39,0x17,0x65,0x73,0x4E,0x46,0xE7,0x5C,0x8C,0xCE,0xB9,0x19,0xDD,0x7B,0x53,
+    0x36,0xD7,0xA2,0x6C,0xEE,0xC9,0xD9,0x9C,0x93,0xD1,0x39,0x27,0xA3,0x7B,0x6F,0x4A,
+    0xD7,0x5A,0x8C,0xCD,0x39,0x29,0x9B,0x73,0x31,0xB2,0xB5,0xCE,0x61,0xAD,0xC9,0xD8,
+    0x18,0x9B,0xB1,0xB5,0x26,0x63,0x63,0x2C,0xCA,0xE6,0xDC,0x94,0xAE,0x35,0x29,0x9B,
+    0x73,0x32,0xBA,0xD6,0xE6,0x74,0xCE,0xC9,0xD8,0x9C,0x93,0xD1,0xB5,0x26,0x63,0x73,
+    0x6E,0xCA,0xD6,0xDA,0x94,0xCD,0x39,0x19,0x9D,0x73,0x31,0xBA,0xD6,0x62,0x6C,0xCE,
+    0x49,0xD9,0x5A,0x93,0xB2,0x39,0x27,0xA5,0x73,0x4E,0x46,0xD7,0xDA,0x94,0xCE,0x39,
+    0x29,0x5B,0x6B,0x53,0x36,0xE7,0xE6,0x5C,0x6B,0x31,0x06,0xDF,0x53,0xEA,0x3D,0xB7,
+    0x16,0x7C,0x4F,0x29,0xE8,0x9C,0x52,0x10,0x42,0xC6,0xE0,0x7B,0x8C,0x41,0x08,0xD7,
+    0x82,0xEF,0x31,0x06,0xE1,0x5B,0xEC,0xC1,0xC7,0x18,0x7C,0x8E,0x31,0xF8,0xDE,0x5A,
+    0xF0,0xBD,0xC5,0xE0,0x83,0x6B,0x41,0x08,0xD7,0x82,0xCF,0x31,0x06,0xDF,0x5B,0x0B,
+    0xBE,0xB7,0x16,0x7C,0x4F,0xA9,0xF7,0xDE,0x5A,0xD0,0x39,0xC6,0xE0,0x73,0x4A,0xBD,
+    0xF7,0xD6,0x82,0xEF,0x29,0xC5,0x5A,0x43,0xE8,0xB5,0xC6,0xD8,0x6B,0xAE,0xB5,0xD7,
+    0xDA,0x5A,0xAF,0x35,0xC6,0xA0,0x73,0xCD,0x3D,0xE7,0x9C,0x83,0xCE,0xB5,0xF6,0x9C,
+    0x73,0xED,0x39,0xD7,0xDA,0x73,0xAE,0xB5,0xE7,0x9E,0x73,0xD0,0xB5,0xD6,0x9E,0x73,
+    0xAD,0x41,0xE7,0x18,0x7B,0xCE,0xB5,0xF6,0xDE,0x73,0x0E,0xB6,0xC6,0xD8,0x73,0xAE,
+    0xB5,0xD8,0x1C,0x63,0xCF,0xB9,0xD6,0xDE,0x73,0xCE,0xBD,0xD6,0x18,0x7B,0xCE,0xB5,
+    0x06,0x9B,0x63,0x8C,0x29,0x95,0x92,0x6B,0x6D,0x2D,0xD7,0x1A,0x63,0xAF,0xB5,0xB5,
+    0x1E,0x6B,0x6B,0xBD,0xE6,0x1A,0x7B,0xAD,0xB5,0xF6,0x9C,0x63,0xEC,0xB5,0xC6,0xD8,
+    0x73,0x8E,0x31,0xE7,0x1C,0x63,0xAF,0xB5,0xD6,0xA0,0x73,0x8C,0xBD,0xD6,0x18,0x7B,
+    0xCE,0x31,0xF6,0x9C,0x63,0xEC,0xB5,0xC6,0x18,0x74,0x6E,0xAD,0xD7,0xDA,0x5A,0xAF,
+    0xB9,0xB5,0x9E,0x73,0x8C,0xBD,0xD6,0x18,0x83,0xCE,0xAD,0xF5,0x5A,0x5B,0xEB,0x39,
+    0xB7,0x56,0x6B,0xED,0x9C,0xD6,0x1A,0x84,0xCD,0xB9,0x18,0x5B,0x6B,0x11,0xB6,0xD6,
+    0x62,0x6C,0xCE,0xC5,0xE9,0x9E,0x93,0xD1,0x39,0x27,0xA3,0x73,0x4F,0x46,0xE7,0x5C,
+    0x8C,0xCD,0xB9,0x18,0xDD,0x7B,0x51,0x3A,0xE7,0x62,0x74,0xCE,0xC9,0xE9,0x9C,0x8B,
+    0xD1,0x39,0x17,0xA3,0x7B,0x4F,0x4A,0xD7,0x9C,0x94,0xCE,0x39,0x39,0x5B,0x73,0x31,
+    0x3A,0xE7,0xA4,0x74,0xEF,0x49,0xE9,0x5C,0x8B,0xD2,0x39,0x37,0xA7,0x73,0x2D,0x46,
+    0xB6,0xD6,0x39,0xAC,0xB5,0x18,0x5B,0x6B,0x31,0xB6,0xD6,0xE2,0x6C,0xAD,0xC5,0xD8,
+    0x9C,0x93,0xD1,0xB5,0x16,0xA5,0x73,0x2E,0x4A,0xD7,0x5A,0x94,0xCE,0xB9,0x18,0x9B,
+    0x6B,0x51,0xBA,0xD6,0xA8,0x74,0xCE,0xC9,0xD8,0x5A,0x93,0xB1,0x39,0x27,0xA3,0x73,
+    0x6E,0x4A,0xD7,0xDA,0x8C,0xCD,0xB9,0x28,0x5B,0x6B,0x32,0x36,0xE7,0xA2,0x74,0xCE,
+    0x45,0xE9,0x5A,0x93,0xD2,0x39,0x27,0x65,0x6B,0x4D,0xCE,0xE6,0x5C,0x94,0x01,0x00,
+    0x00,0x03,0x0E,0x00,0x00,0x01,0x26,0x94,0x81,0x42,0x43,0x56,0x05,0x00,0x35,0x0C,
+    0x00,0x0E,0xCB,0xB2,0x6D,0xCB,0xF3,0x6C,0x5B,0xD3,0x34,0xDB,0x26,0xCB,0xBA,0x4F,
+    0x96,0x75,0x5D,0xF3,0x3C,0x5D,0x17,0x4D,0xD3,0xF7,0x45,0xCF,0xB3,0x75,0xB2,0x2C,
+    0x0C,0x65,0xD9,0xF7,0x3D,0xCF,0xD3,0x75,0x57,0x55,0x7D,0x5F,0xF4,0x3C,0xDB,0x26,
+    0xCB,0xC2,0x50,0x96,0x75,0x9D,0x6D,0xFB,0x3E,0x8C,0xA5,0xEB,0xFA,0x3A,0xDF,0xE7,
+    0xB4,0x6D,0xDF,0x67,0xDB,0xC2,0x10,0x65,0xE9,0xBA,0xBA,0xCE,0x18,0xA6,0xA9,0x6D,
+    0xFB,0xBE,0xA4,0x69,0xAE,0x2C,0x9A,0xA2,0x6D,0xAB,0xA6,0x69,0xDB,0x30,0x86,0xCE,
+    0x74,0x1C,0xA3,0x69,0xDA,0xB6,0xEB,0xBA,0xC2,0xEF,0x9A,0xA6,0x6D,0x73,0x9E,0x63,
+    0x28,0x4D,0xC3,0xB0,0x9A,0xA6,0x6D,0xEB,0xB2,0x6C,0x1C,0xB3,0xAA,0xDA,0x36,0xA7,
+    0x71,0x74,0xA6,0x63,0x28,0x35,0x96,0x90,0x4A,0xCF,0x2F,0x44,0x9A,0xE2,0x1C,0x9D,
+    0xC2,0x11,0x70,0x7E,0x21,0x4E,0x18,0xC7,0x65,0x59,0xB2,0xEC,0x49,0x92,0xAA,0x8A,
+    0x96,0x25,0xCB,0x44,0xD1,0x75,0x99,0xA6,0x6D,0x8B,0x9A,0x26,0xCB,0xAE,0x28,0xCA,
+    0xB2,0x69,0x59,0xB2,0xCC,0x34,0x6D,0x9B,0x69,0xCA,0xB2,0xA8,0x69,0xB2,0x2C,0x9B,
+    0xA6,0x2C,0xAB,0x96,0x25,0xCB,0x4C,0x53,0xD7,0x99,0xA6,0x2C,0x73,0x55,0x5D,0xE7,
+    0x2C,0xC3,0x4F,0x14,0x65,0x99,0x2C,0x3B,0x4B,0x55,0x95,0x65,0xAA,0xAA,0xEB,0x9C,
+    0x65,0x18,0x9A,0xA6,0x2C,0xB3,0x75,0x52,0xD7,0x95,0x65,0xA6,0xE9,0xBA,0x54,0x55,
+    0xD7,0xA9,0xAA,0xAE,0xD3,0x75,0xE7,0xE9,0xFB,0x50,0x55,0x5D,0x67,0xDB,0xC2,0x50,
+    0x55,0x75,0x9D,0xAE,0x3B,0x53,0xDF,0x97,0xA6,0xAE,0xAB,0xEB,0x74,0xDD,0x78,0xAA,
+    0xAA,0xAF,0xD3,0x75,0x69,0xEA,0xFB,0xA4,0xBE,0x0F,0x60,0xDB,0xD2,0x54,0x38,0xE2,
+    0x0B,0x4F,0xBE,0x0F,0xA0,0xEB,0xCE,0x53,0x39,0x4A,0x8D,0x21,0xA6,0xA9,0xAA,0x4C,
+    0xD3,0x34,0xA9,0xAA,0xEB,0x52,0x55,0x51,0x24,0xCB,0xAE,0x4B,0x55,0x5D,0x97,0x2C,
+    0xBB,0x2E,0xD3,0x74,0x5D,0xAE,0x2B,0xCB,0x5C,0xD7,0x75,0xA9,0xAA,0xEB,0x92,0x65,
+    0xD7,0x65,0x9A,0xAE,0x4B,0x96,0x65,0x99,0xEB,0xBA,0x2E,0x5B,0x96,0x65,0xCA,0xB4,
+    0xEB,0x5C,0xD5,0x75,0xF9,0xBA,0xB2,0x94,0x65,0x55,0x25,0xCB,0xB2,0x8C,0xB4,0xFB,
+    0x5C,0xD7,0x75,0xF9,0xBE,0x32,0x95,0x65,0xD7,0xD5,0x34,0xCD,0xF7,0x55,0x51,0xF4,
+    0x7D,0x57,0x14,0x7D,0x9F,0x2C,0xFB,0x3E,0xDB,0x16,0x7E,0x55,0x14,0x7D,0xDF,0x76,
+    0x55,0x61,0x98,0x3D,0x51,0xD7,0xC9,0xB2,0xB2,0x94,0x65,0x5F,0x77,0x4D,0x53,0x18,
+    0x76,0xD7,0x55,0x8E,0x5B,0x14,0x85,0x9F,0x6D,0x1B,0xD9,0xB2,0xEF,0xB3,0x75,0x63,
+    0x28,0x55,0xA6,0xAE,0xEB,0xFB,0x7C,0x1F,0xB6,0xED,0xFB,0x6C,0xDB,0x38,0x92,0x9E,
+    0x64,0xD9,0x17,0x1A,0x47,0x74,0x5B,0xF8,0x3D,0x4D,0xB3,0x6D,0xD5,0x34,0x75,0x5D,
+    0x36,0x4D,0x5D,0x27,0x3D,0xCB,0x52,0x2A,0x1C,0xAB,0x69,0xEA,0xBE,0xED,0xBA,0xC6,
+    0x71,0xAB,0xAA,0x6E,0x93,0x9E,0x63,0x49,0x3A,0x8E,0x57,0x55,0x7D,0xDF,0xB7,0x6D,
+    0xE3,0xB9,0x55,0xD5,0xD7,0x39,0xCF,0xB2,0xE4,0x1C,0x47,0xA9,0xB1,0x04,0xCE,0x33,
+    0x1C,0x71,0x9E,0x28,0x4B,0x9C,0x23,0x20,0x1D,0x47,0x69,0x2A,0x45,0x79,0x56,0x51,
+    0xB4,0x6D,0xD9,0x34,0x6D,0x5B,0x56,0x55,0x5D,0x27,0xCB,0xB2,0xCC,0xB6,0x7D,0x5F,
+    0x56,0x55,0x5D,0xF7,0x5D,0x57,0xD7,0x6D,0xD3,0xB4,0x6D,0xB6,0xED,0xFB,0x6C,0x5B,
+    0xD7,0x65,0xD3,0xD4,0x75,0x61,0xB6,0x75,0x5F,0x37,0x4D,0x5D,0x67,0xDB,0xC2,0xCF,
+    0xB6,0x75,0x9D,0xAE,0x0B,0x43,0xD2,0x71,0x94,0x65,0x5D,0xE7,0xFB,0xD2,0xD3,0xB6,
+    0x75,0x9B,0x6E,0xFB,0x42,0xCE,0xB3,0x94,0x65,0x5D,0xA7,0x1C,0xD1,0x75,0x5D,0xA7,
+    0xAA,0xB6,0xCD,0x75,0x7D,0x9F,0xEB,0xFA,0x3E,0xDD,0x97,0xA6,0xBE,0x30,0xE5,0xBA,
+    0xC2,0xCF,0xB6,0x8D,0xA5,0xAA,0xFA,0x3E,0x5D,0x77,0xA6,0xBE,0x2F,0xE5,0xBA,0xC2,
+    0x4F,0xD7,0x95,0xA5,0xEB,0xFA,0x42,0x5F,0x87,0xEF,0x43,0x18,0x4A,0x81,0xAD,0x3B,
+    0x09,0x43,0x84,0x21,0xC2,0x0F,0xA0,0xEB,0x30,0x8E,0x18,0x43,0x54,0xD5,0xB6,0xB9,
+    0xAE,0xAE,0x73,0x5D,0x5D,0x27,0xCB,0xB6,0xCD,0xB6,0x85,0xA1,0xEB,0xFA,0x3E,0xDB,
+    0xF6,0x7D,0xAA,0xAA,0xEB,0x64,0xD9,0x17,0xCA,0xB2,0xEF,0x73,0x5D,0x5D,0x67,0xDB,
+    0xC2,0x4F,0x55,0x75,0x9D,0x6D,0x0B,0x43,0x59,0xF6,0x7D,0xBA,0x2E,0x1C,0xA5,0xE7,
+    0x99,0xBA,0xAE,0xAE,0xF3,0x7D,0x67,0x6A,0xDB,0xBA,0xCE,0xB6,0x85,0x21,0xC6,0xD2,
+    0x95,0x75,0x9D,0x31,0x4C,0xD9,0xBA,0xAE,0x7B,0x9E,0xE7,0xFB,0xAE,0x69,0xFA,0xBE,
+    0x2C,0x8A,0xBE,0xCF,0xB6,0x8D,0xA1,0x6D,0xFB,0xC2,0x6B,0x9A,0xC6,0x70,0xBB,0xAA,
+    0x71,0xDC,0xA2,0xE8,0xFB,0x64,0xD9,0x38,0xCA,0xB2,0xF0,0xBB,0xA2,0xE8,0x0B,0xC3,
+    0x2C,0x0B,0xC3,0x2D,0x8A,0xBA,0xCE,0xB6,0x9D,0xA5,0x2C,0xFB,0x3E,0x5D,0x57,0x8E,
+    0x38,0x4B,0x57,0x16,0x86,0xBE,0xEF,0x64,0xDB,0xBE,0xD0,0xB6,0x95,0x23,0xCE,0x53,
+    0x96,0x7D,0x9F,0x31,0x44,0xD7,0x7D,0x5F,0xD4,0x34,0xDB,0x76,0x4D,0x53,0xD7,0x65,
+    0xD3,0xD4,0x75,0x52,0x63,0xE9,0x4C,0xCB,0xF1,0x9A,0xA6,0xAF,0xEB,0xB2,0x6C,0x1C,
+    0xB7,0xAA,0xEA,0x3A,0x94,0x23,0xE9,0x38,0x66,0x55,0xD5,0x75,0xDF,0xB6,0x85,0x65,
+    0x57,0x55,0x5D,0x27,0x4D,0xCF,0x91,0x74,0x1C,0x49,0xD3,0x12,0x28,0xCF,0x31,0x44,
+    0x9A,0x4A,0x9D,0x23,0x69,0x59,0x02,0x67,0x1A,0x86,0x40,0x6A,0x3C,0x4D,0xD3,0xB6,
+    0xA9,0xAA,0xAE,0x53,0x55,0x5D,0x67,0xDB,0xBA,0x4E,0xD7,0x7D,0x9F,0xEA,0xFA,0x3E,
+    0x59,0xF6,0x7D,0xAA,0xAA,0xEB,0x6C,0x5B,0x18,0xDA,0xB6,0xAE,0x53,0x55,0x5F,0x67,
+    0xDB,0xBA,0x4E,0x55,0x75,0x9D,0xAE,0x0B,0x43,0xDB,0xD6,0x75,0xBE,0x6F,0x1C,0x71,
+    0x96,0xB6,0xEC,0xEB,0x84,0x61,0x4A,0xD7,0x75,0x9D,0xAF,0x0B,0x3F,0xA7,0x73,0x94,
+    0x6D,0x5D,0xA7,0x1C,0xA5,0xBA,0xAE,0xEB,0x54,0xD5,0xB6,0xB9,0xAE,0xEF,0x73,0x5D,
+    0xDF,0xE7,0xEB,0xCE,0x54,0xF8,0xE1,0xBA,0xBE,0xCF,0xB6,0x8D,0xA3,0xAA,0xFA,0x3E,
+    0x5D,0x97,0x9E,0xBE,0x0F,0xD7,0xF5,0x85,0xBA,0xAD,0x2C,0x55,0xD7,0xF7,0xE9,0xBA,
+    0x94,0xEF,0xC3,0x17,0x02,0x74,0x5D,0x4A,0x18,0x22,0x0C,0x11,0x7E,0x00,0x5D,0xE7,
+    0x54,0x9E,0x08,0x43,0x5C,0x57,0xD7,0xB9,0xAE,0xAE,0x73,0x5D,0xDF,0x27,0xCB,0xBA,
+    0x4E,0xD7,0x85,0xA1,0x2C,0x0B,0x3F,0xDB,0x16,0x86,0xAA,0xEA,0xFB,0x6C,0x5B,0x18,
+    0xCA,0xB2,0xEF,0x73,0x5D,0xDF,0xA7,0xEB,0xBE,0x50,0x55,0x75,0x9F,0x6D,0x0B,0x43,
+    0xD9,0xF6,0x7D,0xBA,0x6E,0x1C,0xA5,0xE7,0x59,0xCA,0xB2,0x2F,0xF4,0x7D,0xD8,0xB6,
+    0xEF,0xD3,0x75,0xE3,0x88,0xB3,0x94,0x65,0xDF,0x27,0x0C,0xB1,0x6D,0xDF,0xA7,0xAA,
+    0xBE,0x4F,0x96,0x8D,0xA1,0x2C,0x0B,0x43,0xDF,0x17,0x86,0xBE,0x2F,0x1C,0x5D,0x57,
+    0x18,0xEA,0xBA,0x71,0x74,0x5D,0xDF,0xE7,0xFB,0xCA,0x52,0xD7,0x7D,0xA1,0xEB,0x0A,
+    0x43,0x61,0x38,0x8E,0xAE,0x2B,0x0C,0x7D,0x5F,0x59,0xEA,0xBE,0x30,0xF4,0x7D,0x63,
+    0x88,0x34,0x95,0x65,0xDF,0x27,0x0C,0x9D,0xBA,0xEE,0x0B,0x7D,0x5F,0x39,0x92,0x9E,
+    0xA9,0x6D,0x0B,0x3F,0x27,0x74,0xDF,0x17,0x8A,0xA2,0x6D,0x93,0x65,0xDF,0x67,0xDB,
+    0xBA,0x8E,0xB3,0x2C,0x51,0x96,0xAE,0xAB,0xEB,0x74,0x5F,0x39,0xDA,0xB6,0xAE,0x93,
+    0x1A,0x47,0xA7,0x70,0x94,0x65,0xDF,0x27,0x0C,0xC3,0xD2,0xB6,0x7D,0x9D,0xF4,0x3C,
+    0x4B,0x94,0x25,0xCA,0x11,0x38,0xCF,0x70,0x44,0x9A,0x62,0x1C,0xA5,0xC6,0x12,0x38,
+    0xD3,0x71,0xC4,0x99,0xA2,0x2C,0x8D,0x63,0xD7,0x39,0xD3,0x30,0x54,0xA6,0x61,0x88,
+    0x70,0xC4,0x59,0x2A,0xCB,0x30,0xC4,0x38,0x2A,0xCF,0x2F,0x24,0x3D,0x4F,0xE5,0x59,
+    0x8E,0xCA,0xF3,0xFB,0x30,0x96,0xCA,0x33,0x0C,0x49,0x9D,0xD2,0x34,0x2C,0x9D,0xCA,
+    0x13,0x27,0xE5,0x18,0x7E,0x80,0x33,0x0C,0x9D,0xE9,0x78,0x42,0xAA,0x3C,0xC3,0x10,
+    0x38,0xD3,0x30,0x54,0x55,0xDB,0x26,0xCB,0xBE,0x50,0x96,0x7D,0x9F,0x30,0x94,0x1A,
+    0xC3,0x94,0x2C,0xFB,0x3E,0x5D,0x37,0x8E,0xAE,0xEB,0xFB,0x84,0x5F,0x4A,0x18,0xE2,
+    0xBA,0xC2,0x50,0x18,0x96,0xA9,0xEC,0xFA,0x3E,0x61,0x88,0x30,0xC4,0x18,0x4A,0x81,
+    0xAE,0x3B,0x39,0x47,0x84,0x23,0xBE,0x10,0xA0,0xEB,0x50,0x96,0x18,0x47,0x6C,0xDB,
+    0x38,0xFA,0x3E,0xA9,0xEF,0x4B,0x53,0x61,0xE8,0x14,0x86,0x27,0x5F,0x87,0xF3,0x44,
+    0xD7,0x9D,0xA7,0x30,0x4C,0x09,0xC7,0xF3,0xD4,0x75,0xE7,0x69,0x1C,0xD1,0x75,0xE5,
+    0x29,0x1C,0x11,0x86,0xE7,0x69,0x0C,0x53,0x90,0xEA,0xBA,0xF3,0x54,0x96,0x08,0xC3,
+    0x94,0x30,0x04,0x29,0x5D,0x57,0x96,0xCE,0x14,0x63,0x98,0xA6,0xAE,0xEB,0xFB,0x6C,
+    0x5B,0x18,0xCA,0xB2,0x70,0xF4,0x7D,0x63,0xE8,0xFB,0xC6,0x51,0x96,0x8D,0xA3,0xEE,
+    0x2B,0x47,0x59,0xF6,0x7D,0xBE,0xEF,0x1C,0x7D,0x5F,0x18,0xBA,0xB2,0x30,0x14,0x7E,
+    0xE3,0xE8,0xBA,0xBE,0x4F,0xF8,0x9D,0xA5,0xEF,0xFB,0x3E,0x5F,0x38,0x9E,0x48,0x4F,
+    0xDB,0x16,0x7E,0xCA,0xD1,0xE9,0xFB,0xC2,0xCF,0xF7,0x85,0x23,0x69,0x9A,0xDA,0xB6,
+    0xEF,0x73,0x9E,0x29,0xDF,0xF7,0x7D,0xA6,0x69,0xDB,0x6C,0x5B,0xF7,0xD9,0xB6,0xAE,
+    0x23,0x1D,0x47,0xD2,0xB1,0x94,0x65,0xDF,0xE7,0xFB,0xC6,0xD1,0xB6,0x75,0x9D,0xD4,
+    0x38,0x4A,0x8D,0xA3,0x2C,0xFB,0x3E,0x61,0x58,0x9E,0xB6,0xAD,0xEB,0x30,0x9E,0xA4,
+    0xE3,0x48,0x5A,0x8E,0xC0,0x99,0x8E,0x21,0xD2,0x14,0x65,0x29,0x35,0x96,0x40,0x7A,
+    0x86,0x21,0xE9,0x09,0x65,0xA9,0x3C,0xBB,0x8F,0x73,0x0C,0x9D,0x69,0x38,0x4A,0x8D,
+    0x23,0xCA,0xD2,0x79,0x86,0x23,0xC6,0xD2,0x79,0x8E,0x21,0x9C,0xA4,0xE1,0xE8,0x4C,
+    0xC3,0x10,0xE3,0xA8,0x2C,0xC3,0x10,0x69,0xEA,0x3C,0xC3,0x10,0x69,0x89,0xB3,0x94,
+    0x9E,0xE1,0x08,0x38,0xC7,0x50,0x7A,0x8E,0x23,0xCE,0xD4,0x79,0x86,0x21,0x70,0x0A,
+    0x43,0x55,0x95,0x6D,0xB2,0xEC,0xFB,0x64,0xD9,0xF7,0x09,0x43,0x84,0x23,0xB2,0xEC,
+    0xFB,0x74,0xDF,0x38,0xCA,0xB2,0x2F,0xF4,0x85,0x27,0xE1,0x78,0x92,0x65,0x61,0xE8,
+    0xFB,0xCE,0x54,0x96,0x7D,0x9F,0x30,0x4C,0x09,0x47,0x84,0xA3,0x14,0xE8,0xBA,0x93,
+    0xB2,0x44,0x18,0x62,0x0C,0xD3,0x13,0xF8,0xBE,0x33,0x95,0x9E,0x52,0x65,0x8A,0xAE,
+    0xC3,0x17,0x2A,0x7D,0x1F,0xC2,0x10,0xE5,0x88,0xEF,0x3B,0x4F,0xE7,0x98,0xD2,0x75,
+    0x69,0x6A,0x1C,0x31,0x96,0xF8,0x3A,0xA9,0xB3,0xC4,0xF7,0xE1,0x1C,0xA5,0xC2,0x31,
+    0x65,0x2C,0x01,0xBE,0xEF,0x3C,0x95,0x27,0xC2,0x10,0x63,0x78,0xA6,0xC0,0xF7,0x39,
+    0x9D,0x2B,0xC6,0xD1,0x1A,0x00,0x00,0x7C,0xE0,0x00,0x00,0x5C,0x60,0x42,0x19,0x28,
+    0x34,0x64,0x15,0x00,0x70,0x00,0x00,0x30,0xC4,0x01,0x00,0x80,0x03,0x0E,0x00,0x00,
+    0x01,0x26,0x26,0xA6,0xB0,0xD0,0x90,0x55,0x01,0xC0,0x3C,0x00,0x00,0xA0,0x94,0x72,
+    0x8E,0x39,0xC7,0xA0,0x93,0x94,0x42,0xE7,0x98,0x73,0x94,0x52,0xE8,0x9C,0x62,0x4C,
+    0x4A,0x29,0xA5,0x94,0x52,0x6A,0x8C,0x2D,0xA5,0x52,0x4A,0xAD,0x31,0xA6,0x54,0x29,
+    0xE5,0x10,0x72,0x8C,0x39,0xC6,0x28,0x84,0x90,0x31,0xC7,0x98,0x95,0x52,0x32,0xC6,
+    0x9C,0xB3,0x94,0x5A,0x29,0xA9,0x94,0x1A,0x63,0x2C,0x25,0x95,0xD4,0x6B,0x8D,0xA5,
+    0x64,0x8E,0x59,0x6B,0x2D,0xA5,0x96,0x52,0xAF,0x39,0xB6,0x96,0x52,0x0A,0xBA,0xD6,
+    0x18,0x4B,0x08,0x31,0xA5,0x98,0x52,0x4B,0xA9,0xD7,0x58,0x53,0x6A,0x29,0xF5,0x5C,
+    0x6B,0x4A,0x99,0x73,0x96,0x52,0x2B,0xA5,0x95,0xD2,0x6B,0x8C,0x29,0xB5,0x52,0x7A,
+    0xAD,0xB1,0x94,0xCE,0x39,0x6B,0xAD,0xA5,0xD4,0x52,0xEA,0x35,0xD7,0xD6,0x5A,0x4A,
+    0x3D,0xE7,0xDA,0x5A,0x29,0x25,0xA6,0x14,0x53,0x6A,0xAD,0xF5,0x5A,0x6B,0x4A,0x2D,
+    0xA5,0x60,0x73,0x4D,0xA9,0x00,0x00,0xA8,0x04,0x07,0x00,0xA8,0x04,0x0B,0xA1,0xD0,
+    0x90,0x55,0x01,0xC0,0x3C,0x00,0x00,0xC1,0x18,0x73,0x8E,0x31,0xC6,0x9C,0x73,0x0E,
+    0x3A,0xC6,0x9C,0x73,0x10,0x42,0xC8,0x98,0x52,0x0A,0x32,0x06,0x19,0x83,0xCE,0x49,
+    0xE7,0xA4,0x73,0xD2,0x39,0xE9,0x9C,0x74,0x8E,0x29,0x05,0x95,0x82,0x4A,0x41,0xC6,
+    0xA4,0x73,0x50,0x29,0xC8,0x98,0x74,0x0E,0x32,0xC6,0x9C,0xA3,0x10,0x52,0x08,0x29,
+    0x84,0x16,0x42,0xEB,0x9C,0x85,0xD0,0x4A,0x68,0x9D,0x73,0x8C,0x49,0x08,0x29,0x84,
+    0x14,0x42,0x4A,0x25,0x85,0x90,0x4A,0x48,0x25,0xA5,0x10,0x4A,0xE7,0x28,0x84,0x14,
+    0x42,0x0A,0x21,0x95,0x92,0x42,0x48,0x21,0xA4,0x52,0x52,0x08,0xA1,0x73,0x16,0x42,
+    0x0B,0x21,0x85,0xD0,0x42,0x68,0x9D,0xB3,0x10,0x5A,0x08,0xAD,0x73,0x90,0x31,0x0A,
+    0x25,0x95,0x90,0x42,0x48,0x29,0xA5,0x10,0x52,0x29,0x29,0xA5,0x14,0x42,0x09,0x21,
+    0x85,0x90,0x4A,0x49,0x25,0xA4,0x52,0x52,0x08,0xA9,0x94,0x54,0x52,0x0A,0xA1,0x00,
+    0x00,0xE0,0x02,0x07,0x00,0xE0,0x02,0x0B,0xA1,0xD0,0x90,0x55,0x01,0xC0,0x3C,0x00,
+    0x00,0xE0,0x9C,0x73,0xCE,0x39,0x07,0x21,0x84,0x10,0x42,0x08,0x21,0x84,0x10,0x42,
+    0x08,0xA1,0x83,0x10,0x42,0x08,0x21,0x84,0x10,0x42,0x08,0x21,0x84,0x10,0x42,0x08,
+    0x21,0x84,0xD0,0x41,0x08,0x21,0x84,0x10,0x42,0x08,0x21,0x84,0x10,0x42,0x08,0x21,
+    0x84,0x10,0x42,0xC8,0x20,0x84,0x10,0x42,0x08,0x21,0x84,0x10,0x42,0x08,0x21,0x84,
+    0x10,0x42,0x08,0x21,0x84,0x10,0x42,0x08,0x21,0x84,0x10,0x42,0x08,0x21,0x84,0x10,
+    0x42,0x08,0x21,0x84,0x10,0x42,0x08,0x21,0x84,0x10,0x42,0x08,0x21,0x84,0x10,0x42,
+    0x08,0x21,0x84,0x10,0x42,0x08,0x1D,0x84,0x10,0x42,0x08,0x21,0x84,0x10,0x42,0x08,
+    0x21,0x84,0x10,0x42,0x08,0x21,0x84,0x10,0x42,0x08,0x21,0x84,0x10,0x42,0x08,0x21,
+    0x84,0x10,0x42,0x08,0x21,0x84,0x10,0x42,0x08,0x21,0x84,0x10,0x42,0x08,0x21,0x84,
+    0x10,0x42,0x08,0x21,0x84,0x10,0x42,0x08,0xA1,0x00,0x40,0x9C,0x09,0x07,0x40,0x9C,
+    0x09,0x0B,0xA1,0xD0,0x90,0x55,0x00,0x40,0x06,0x00,0x00,0x40,0x04,0x42,0x4A,0x31,
+    0xE6,0x1C,0x84,0x52,0x52,0x6A,0xAD,0xD5,0x5A,0x73,0x2E,0x00,0x80,0x25,0xC2,0x01,
+    0x00,0x32,0xC1,0x08,0x5B,0x4D,0xB9,0xF4,0x10,0x3C,0xD1,0xC8,0x32,0x09,0x1D,0x55,
+    0xD8,0x70,0x01,0x16,0x1A,0xB2,0x0A,0x00,0xC8,0x00,0x00,0x40,0x8C,0x41,0x06,0x19,
+    0x84,0x10,0x42,0x08,0x21,0x84,0x10,0x42,0x08,0x21,0x84,0x04,0x00,0x00,0x1E,0x38,
+    0x00,0x00,0x04,0x18,0x61,0xAB,0x29,0x97,0x1E,0x82,0x27,0x1A,0x59,0x26,0xA1,0xA3,
+    0x0A,0x1B,0x2E,0xC0,0x42,0x43,0x56,0x02,0x00,0x04,0x00,0x00,0x00,0x11,0x04,0x08,
+    0x0D,0x59,0x09,0x00,0xA4,0x02,0x00,0x00,0xC4,0x30,0xE6,0x1C,0x84,0x50,0x4A,0x89,
+    0x14,0x72,0x0C,0x3A,0x08,0x25,0xA4,0x12,0x21,0xC6,0x9C,0x83,0x10,0x42,0x29,0xA9,
+    0x83,0x4E,0x42,0x09,0x25,0xA4,0x92,0x4A,0xE7,0x20,0x94,0x50,0x42,0x2A,0xA9,0xA4,
+    0x92,0x52,0x4A,0x29,0xA5,0x94,0x52,0x4A,0x25,0xA5,0xD4,0x52,0x4A,0x29,0xA5,0xD2,
+    0x5A,0x6B,0xAD,0xB5,0xD4,0x5A,0x4B,0x29,0xB5,0xD6,0x5A,0x6B,0x2D,0xB5,0xD4,0x52,
+    0x8A,0xAD,0xB5,0xD8,0x5A,0x6B,0xA9,0xA5,0x14,0x63,0x6C,0xAD,0xB5,0xD6,0x52,0x4A,
+    0x25,0xC6,0xD8,0x62,0x8B,0x29,0x96,0x96,0x52,0x8C,0x2D,0xB6,0xD6,0x5A,0x6A,0x29,
+    0xA5,0x02,0x00,0xC0,0x13,0x1C,0x00,0x80,0x0A,0x6C,0x58,0x1D,0xE1,0xA4,0x68,0x2C,
+    0xB0,0xD0,0x90,0x95,0x00,0x40,0x06,0x00,0x00,0x60,0x8C,0x52,0x08,0x21,0x86,0x10,
+    0x42,0x8A,0x31,0xC5,0x18,0x53,0x8C,0x31,0x26,0x00,0x00,0x60,0xC0,0x01,0x00,0x20,
+    0xC0,0x84,0x32,0x50,0x68,0xC8,0x4A,0x00,0x20,0x01,0x00,0x20,0x08,0x00,0x0C,0x00,
+    0xC4,0x99,0x70,0x00,0xC4,0x99,0xB0,0x10,0x0A,0x0D,0x59,0x09,0x00,0xC4,0x00,0x00,
+    0x10,0x44,0x31,0xA9,0x3D,0x11,0x88,0x51,0x0D,0x16,0x42,0x4C,0x5A,0xCD,0x98,0x52,
+    0x0C,0x62,0x49,0xA1,0x52,0x90,0x72,0x8E,0x25,0x94,0x56,0x8C,0xAF,0x2D,0xF6,0x00,
+    0x00,0x00,0x10,0x02,0x00,0x02,0x4C,0x00,0x81,0x01,0x82,0x82,0x2F,0x84,0x80,0x18,
+    0x03,0x00,0x10,0x84,0xC8,0x0C,0x91,0x50,0x58,0x05,0x0B,0x0C,0xCA,0xA0,0xC1,0x61,
+    0x1E,0x00,0x3C,0x40,0x44,0x48,0x04,0x00,0x89,0x09,0x8A,0xB4,0x8B,0x0B,0xE8,0x32,
+    0xC0,0x05,0x5D,0xDC,0x75,0x20,0x84,0x20,0x04,0x21,0x88,0xC5,0x01,0x14,0x90,0x80,
+    0x83,0x13,0x6E,0x78,0xE2,0x0D,0x4F,0xB8,0xC1,0x09,0x3A,0x45,0xA5,0x0E,0x00,0x00,
+    0x91,0x20,0x00,0x00,0x00,0x00,0x50,0x19,0x00,0xE0,0x00,0x00,0x60,0x50,0x80,0xCC,
+    0xCC,0x5D,0x85,0xC5,0x05,0x46,0x86,0xC6,0x06,0x47,0xC7,0x86,0xC7,0x07,0x88,0x00,
+    0x00,0x00,0x00,0x00,0x2A,0x03,0x40,0x07,0x00,0x80,0x51,0x02,0x32,0x33,0x77,0x15,
+    0x16,0x17,0x18,0x19,0x1A,0x1B,0x1C,0x1D,0x1B,0x1E,0x1F,0x20,0x01,0x00,0x00,0x00,
+    0x00,0x0C,0x00,0x00,0x05,0x00,0x00,0x41,0xC8,0x9C,0xC8,0x08,0xC9,0x07,0x48,0x00,
+    0x00,0x30,0x0E,0x40,0x23,0x82,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x20,0x20,0x00,
+    0x00,0x30,0x0E,0x40,0x23,0x82,0x01,0x00,0x00,0x01,0x10,0x10,0x00,0x20,0x20,0x10,
+    0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x10,0x10,
+};
+
+// a SimpleBlock on track 1 with 2 audio packets in fixed lacing, the first one in mode 0, the second one in mode 1
+static const uint8_t BlockData[] = {
+    0xA3, 0x87, 0x81, 0x00,0x00, 0x84, 0x01, 0x00, 0x7E,
+};
+
+// the values the tremor decoder reads from these headers
+typedef struct expected_vorbis
+{
+    const char *Name;
+    const uint8_t *Private;
+    size_t Size;
+    int Rate;
+    int BlockSizes[2];
+    int Modes;
+    int BlockFlags[2];
+
+} expected_vorbis;
+
+static const expected_vorbis Expected[] = {
+    {"mono",     MonoPrivate,     sizeof(MonoPrivate),     44100, {256, 2048}, 2, {0, 1}},
+    {"surround", SurroundPrivate, sizeof(SurroundPrivate), 48000, {256, 2048}, 2, {0, 1}},
+};
+
+#define NO_CHANGE  ((size_t)-1)
+
+// headers cut to Size or with the byte at Pos changed, the tremor decoder refuses them all
+typedef struct invalid_vorbis
+{
+    const char *Name;
+    const uint8_t *Private;
+    size_t Size;
+    size_t Pos;
+    uint8_t Value;
+
+} invalid_vorbis;
+
+static const invalid_vorbis Invalid[] = {
+    {"lacing cut",                MonoPrivate,     2,                         NO_CHANGE, 0},
+    {"comment header cut",        MonoPrivate,     3+30+50,                   NO_CHANGE, 0},
+    {"setup header cut",          MonoPrivate,     sizeof(MonoPrivate)-100,   NO_CHANGE, 0},
+    {"framing bit cut",           MonoPrivate,     sizeof(MonoPrivate)-1,     NO_CHANGE, 0},
+    {"surround setup header cut", SurroundPrivate, sizeof(SurroundPrivate)/2, NO_CHANGE, 0},
+    {"3 headers in the lacing",   MonoPrivate,     sizeof(MonoPrivate),       0,         3},
+    {"identification type",       MonoPrivate,     sizeof(MonoPrivate),       3,         3},
+    {"block size 32",             MonoPrivate,     sizeof(MonoPrivate),       3+28,      0x85},
+    {"codebook sync",             MonoPrivate,     sizeof(MonoPrivate),       3+30+90+8, 'X'},
+    {"mode mapping 3",            MonoPrivate,     sizeof(MonoPrivate),       sizeof(MonoPrivate)-1, 0x81}, // the mapping of the last mode is 1 in the last bit of the previous byte
+    {"no framing bit",            MonoPrivate,     sizeof(MonoPrivate),       sizeof(MonoPrivate)-1, 0x00},
+};
+
+// a new audio TrackEntry with the CodecPrivate and the SimpleBlock linked to it
+static int ReadBlock(parsercontext *p, stream *Input, const ebml_parser_context *Context, const uint8_t *Private, size_t Size, ebml_master **Track, ebml_element **Block)
+{
+    int UpperElement = 0;
+
+    *Block = NULL;
+    *Track = (ebml_master*)EBML_ElementCreate(p,MATROSKA_getContextTrackEntry(),0,PROFILE_MATROSKA_ANY,NULL);
+    if (!*Track)
+        return 0;
+    EBML_IntegerSetValue((ebml_integer*)EBML_MasterGetChild(*Track,MATROSKA_getContextTrackNumber(),PROFILE_MATROSKA_ANY),1);
+    EBML_IntegerSetValue((ebml_integer*)EBML_MasterGetChild(*Track,MATROSKA_getContextTrackType(),PROFILE_MATROSKA_ANY),MATROSKA_TRACK_TYPE_AUDIO);
+    if (EBML_StringSetValue((ebml_string*)EBML_MasterGetChild(*Track,MATROSKA_getContextCodecID(),PROFILE_MATROSKA_ANY),"A_VORBIS")!=ERR_NONE ||
+        EBML_BinarySetData((ebml_binary*)EBML_MasterGetChild(*Track,MATROSKA_getContextCodecPrivate(),PROFILE_MATROSKA_ANY),Private,Size)!=ERR_NONE)
+        return 0;
+
+    Stream_Seek(Input,0,SEEK_SET);
+    *Block = EBML_FindNextElement(Input, Context, &UpperElement, 0);
+    return *Block && EBML_ElementIsType(*Block, MATROSKA_getContextSimpleBlock()) &&
+        MATROSKA_LinkBlockReadTrack((matroska_block*)*Block, *Track, 0, PROFILE_MATROSKA_ANY)==ERR_NONE &&
+        EBML_ElementReadData(*Block,Input,Context,0,SCOPE_PARTIAL_DATA,0)==ERR_NONE;
+}
+
+static int CheckValid(parsercontext *p, stream *Input, const ebml_parser_context *Context, const expected_vorbis *Expect)
+{
+    ebml_master *Track;
+    ebml_element *Block;
+    const matroska_frame_params *Params;
+    mkv_timestamp_t Duration;
+    err_t Err;
+    int i, Result = 0;
+
+    if (!ReadBlock(p, Input, Context, Expect->Private, Expect->Size, &Track, &Block))
+    {
+        fprintf(stderr,"failed to read the %s SimpleBlock\r\n",Expect->Name);
+        Result = 1;
+    }
+    else
+    {
+        Err = MATROSKA_BlockProcessFrameDurations((matroska_block*)Block, Input, PROFILE_MATROSKA_ANY);
+        Params = MATROSKA_TrackFrameParams((matroska_trackentry*)Track);
+        if (Err != ERR_NONE || Params->Codec != MATROSKA_FRAME_CODEC_VORBIS || Params->VorbisModes != Expect->Modes || Params->VorbisModeBits != 1)
+        {
+            fprintf(stderr,"the %s headers gave %d with codec %d and %d modes\r\n",Expect->Name,(int)Err,(int)Params->Codec,Params->VorbisModes);
+            Result = 1;
+        }
+        else for (i=0;i<Expect->Modes;++i)
+        {
+            Duration = Scale64(1000000000,Expect->BlockSizes[Expect->BlockFlags[i]],Expect->Rate);
+            if (Params->VorbisDurations[i] != Duration || MATROSKA_BlockGetFrameDuration((matroska_block*)Block,i) != Duration)
+            {
+                fprintf(stderr,"the %s mode %d lasts %d ns, the frame %d ns, instead of %d ns\r\n",Expect->Name,i,(int)Params->VorbisDurations[i],
+                    (int)MATROSKA_BlockGetFrameDuration((matroska_block*)Block,i),(int)Duration);
+                Result = 1;
+            }
+        }
+    }
+    NodeDelete((node*)Block);
+    NodeDelete((node*)Track);
+    return Result;
+}
+
+static int CheckInvalid(parsercontext *p, stream *Input, const ebml_parser_context *Context, const invalid_vorbis *Header)
+{
+    static uint8_t Private[sizeof(SurroundPrivate)];
+    ebml_master *Track;
+    ebml_element *Block;
+    const matroska_frame_params *Params;
+    err_t Err;
+    int Result = 0;
+
+    memcpy(Private, Header->Private, Header->Size);
+    if (Header->Pos != NO_CHANGE)
+        Private[Header->Pos] = Header->Value;
+    if (!ReadBlock(p, Input, Context, Private, Header->Size, &Track, &Block))
+    {
+        fprintf(stderr,"failed to read the SimpleBlock with the %s\r\n",Header->Name);
+        Result = 1;
+    }
+    else
+    {
+        Err = MATROSKA_BlockProcessFrameDurations((matroska_block*)Block, Input, PROFILE_MATROSKA_ANY);
+        Params = MATROSKA_TrackFrameParams((matroska_trackentry*)Track);
+        if (Err != ERR_INVALID_DATA || Params->Codec != MATROSKA_FRAME_CODEC_VORBIS_INVALID)
+        {
+            fprintf(stderr,"the headers with the %s gave %d with codec %d\r\n",Header->Name,(int)Err,(int)Params->Codec);
+            Result = 1;
+        }
+    }
+    NodeDelete((node*)Block);
+    NodeDelete((node*)Track);
+    return Result;
+}
+
+int main(void)
+{
+    parsercontext p;
+    stream *Input;
+    ebml_parser_context RContext, SegmentContext, ClusterContext;
+    size_t i;
+    int Result = 0;
+
+    ParserContext_InitEx(&p,NULL,NULL,NULL,NODECONTEXT_SINGLE_THREAD);
+    MATROSKA_Init(&p);
+
+    Input = (stream*)NodeCreate(&p,MEMSTREAM_CLASS);
+    if (!Input || Node_Set(Input,MEMSTREAM_DATA,BlockData,sizeof(BlockData))!=ERR_NONE)
+    {
+        fprintf(stderr,"failed to create the memory stream\r\n");
+        Result = 1;
+    }
+    else
+    {
+        RContext.Context = MATROSKA_getContextStream();
+        RContext.EndPosition = INVALID_FILEPOS_T;
+        RContext.UpContext = NULL;
+        RContext.Profile = PROFILE_MATROSKA_ANY;
+        SegmentContext.Context = MATROSKA_getContextSegment();
+        SegmentContext.EndPosition = sizeof(BlockData);
+        SegmentContext.UpContext = &RContext;
+        SegmentContext.Profile = PROFILE_MATROSKA_ANY;
+        ClusterContext.Context = MATROSKA_getContextCluster();
+        ClusterContext.EndPosition = sizeof(BlockData);
+        ClusterContext.UpContext = &SegmentContext;
+        ClusterContext.Profile = PROFILE_MATROSKA_ANY;
+
+        for (i=0;i<sizeof(Expected)/sizeof(Expected[0]);++i)
+            Result |= CheckValid(&p, Input, &ClusterContext, &Expected[i]);
+        for (i=0;i<sizeof(Invalid)/sizeof(Invalid[0]);++i)
+            Result |= CheckInvalid(&p, Input, &ClusterContext, &Invalid[i]);
+    }
+    if (!Result)
+        fprintf(stdout,"Vorbis headers OK\r\n");
+
+    if (Input)
+        StreamClose(Input);
+    MATROSKA_Done(&p);
+    ParserContext_Done(&p);
+    return Result;
+}
@@ -122,6 +122,35 @@ typedef struct track_info
 
 } track_info;
 
+// the only thing kept in memory for each Cluster in --stream mode
+typedef struct cluster_info
+{
+	filepos_t SrcPosition;
+	filepos_t Position; // in the output file
+	filepos_t DataSize; // in the output file, without the PrevSize
+	uint8_t SizeLength;
+	matroska_cuepoint *Cue;
+	mkv_timestamp_t CueTimestamp;
+
+} cluster_info;
+
+// what's needed to reload and relink a Cluster in --stream mode
+typedef struct cluster_stream
+{
+	array Clusters; // cluster_info
+	stream *Input;
+	ebml_parser_context *Context;
+	ebml_master *RSegmentInfo;
+	const matroska_track_map *RTrackMap;
+	ebml_master *WSegmentInfo;
+	ebml_master *WTrackInfo;
+	array *WTracks;
+	int64_t CueTrack;
+	filepos_t SimpleBlockPos; // first SimpleBlock of the source, INVALID_FILEPOS_T if none
+	array LacedTracks; // int16_t, tracks with Blocks of more than one frame
+
+} cluster_stream;
+
 static const tchar_t *GetProfileName(size_t ProfileNum)
 {
 static const tchar_t *Profile[8] = {T("unknown"), T("matroska v1"), T("matroska v2"), T("matroska v3"), T("webm"), T("matroska+DivX"), T("matroska v4"), T("matroska v5")};
@@ -160,6 +189,7 @@ static size_t ExtraSizeDiff = 0;
 static bool_t Quiet = 0;
 static bool_t Unsafe = 0;
 static bool_t Live = 0;
+static size_t CompressThreads = 0; // one per CPU
 static int TotalPhases = 2;
 static int CurrentPhase = 1;
 
@@ -269,6 +299,8 @@ static bool_t ReadClusterData(ebml_master *Cluster, stream *Input)
             }
         }
     }
+    // zlib tracks are compressed here rather than one Block at a time when writing
+    MATROSKA_ClustersCompressFrames((matroska_cluster**)&Cluster, 1, CompressThreads);
     return Changed;
 }
 
@@ -443,86 +475,129 @@ static matroska_cluster **LinkCueCluster(matroska_cuepoint *Cue, array *Clusters
     return NULL;
 }
 
-static int LinkClusters(array *Clusters, ebml_master *RSegmentInfo, ebml_master *Tracks, int dstProfile, array *WTracks, mkv_timestamp_t Offset)
+static int CheckClusterProfile(matroska_cluster *Cluster, int dstProfile)
 {
-    matroska_cluster **Cluster;
-	ebml_element *Block, *GBlock, *BlockTrack, *Type;
-    ebml_integer *Time;
-    int BlockNum;
+	ebml_element *Block;
 
-	// find out if the Clusters use forbidden features for that dstProfile
+	// find out if the Cluster uses forbidden features for that dstProfile
 	if (dstProfile == PROFILE_MATROSKA_V1 || dstProfile == PROFILE_DIVX)
 	{
-		for (Cluster=ARRAYBEGIN(*Clusters,matroska_cluster*);Cluster!=ARRAYEND(*Clusters,matroska_cluster*);++Cluster)
+		for (Block = EBML_MasterChildren(Cluster);Block;Block=EBML_MasterNext(Block))
 		{
-			for (Block = EBML_MasterChildren(*Cluster);Block;Block=EBML_MasterNext(Block))
+			if (EBML_ElementIsType(Block, MATROSKA_getContextSimpleBlock()))
 			{
-				if (EBML_ElementIsType(Block, MATROSKA_getContextSimpleBlock()))
-                {
-					TextPrintf(StdErr,T("Using SimpleBlock in profile '%s' at %") TPRId64 T(" try \"--doctype %d\"\r\n"),GetProfileName(dstProfile),EBML_ElementPosition(Block),GetProfileId(PROFILE_MATROSKA_V2));
-					return -32;
-				}
+				TextPrintf(StdErr,T("Using SimpleBlock in profile '%s' at %") TPRId64 T(" try \"--doctype %d\"\r\n"),GetProfileName(dstProfile),EBML_ElementPosition(Block),GetProfileId(PROFILE_MATROSKA_V2));
+				return -32;
 			}
 		}
 	}
+	return 0;
+}
+
+static void LinkCluster(matroska_cluster *Cluster, ebml_master *RSegmentInfo, const matroska_track_map *TrackMap, array *WTracks, mkv_timestamp_t Offset)
+{
+	ebml_element *Block, *GBlock, *BlockTrack, *Type;
+    ebml_integer *Time;
+    int BlockNum;
 
 	// link each Block/SimpleBlock with its Track and SegmentInfo
-	for (Cluster=ARRAYBEGIN(*Clusters,matroska_cluster*);Cluster!=ARRAYEND(*Clusters,matroska_cluster*);++Cluster)
-	{
-        if (Offset != INVALID_TIMESTAMP_T)
-        {
-            Time = (ebml_integer*)EBML_MasterGetChild((ebml_master*)*Cluster, MATROSKA_getContextTimestamp(), DstProfile);
-            if (Time)
-                EBML_IntegerSetValue(Time, Offset + EBML_IntegerValue(Time));
-        }
-		MATROSKA_LinkClusterBlocks(*Cluster, RSegmentInfo, Tracks, 0, DstProfile);
-		ReduceSize((ebml_element*)*Cluster);
-	}
+    if (Offset != INVALID_TIMESTAMP_T)
+    {
+        Time = (ebml_integer*)EBML_MasterGetChild((ebml_master*)Cluster, MATROSKA_getContextTimestamp(), DstProfile);
+        if (Time)
+            EBML_IntegerSetValue(Time, Offset + EBML_IntegerValue(Time));
+    }
+	MATROSKA_LinkClusterBlocksWithMap(Cluster, RSegmentInfo, TrackMap, 0, DstProfile);
+	ReduceSize((ebml_element*)Cluster);
 
     // mark all the audio/subtitle tracks as keyframes
-	for (Cluster=ARRAYBEGIN(*Clusters,matroska_cluster*);Cluster!=ARRAYEND(*Clusters,matroska_cluster*);++Cluster)
+	for (Block = EBML_MasterChildren(Cluster);Block;Block=EBML_MasterNext(Block))
 	{
-		for (Block = EBML_MasterChildren(*Cluster);Block;Block=EBML_MasterNext(Block))
+		if (EBML_ElementIsType(Block, MATROSKA_getContextBlockGroup()))
 		{
-			if (EBML_ElementIsType(Block, MATROSKA_getContextBlockGroup()))
-			{
-				GBlock = EBML_MasterFindChild((ebml_master*)Block, MATROSKA_getContextBlock());
-				if (GBlock)
-				{
-					BlockTrack = MATROSKA_BlockReadTrack((matroska_block*)GBlock);
-                    if (!BlockTrack) continue;
-                    Type = EBML_MasterFindChild((ebml_master*)BlockTrack,MATROSKA_getContextTrackType());
-                    if (!Type) continue;
-                    if (EBML_IntegerValue((ebml_integer*)Type)==MATROSKA_TRACK_TYPE_AUDIO || EBML_IntegerValue((ebml_integer*)Type)==MATROSKA_TRACK_TYPE_SUBTITLE)
-                    {
-                        MATROSKA_BlockSetKeyframe((matroska_block*)GBlock,1);
-						MATROSKA_BlockSetDiscardable((matroska_block*)GBlock,0);
-                    }
-                    BlockNum = MATROSKA_BlockTrackNum((matroska_block*)GBlock);
-                    if (MATROSKA_BlockGetFrameCount((matroska_block*)GBlock)>1)
-                        ARRAYBEGIN(*WTracks,track_info)[BlockNum].IsLaced = 1;
-				}
-			}
-			else if (EBML_ElementIsType(Block, MATROSKA_getContextSimpleBlock()))
+			GBlock = EBML_MasterFindChild((ebml_master*)Block, MATROSKA_getContextBlock());
+			if (GBlock)
 			{
-				BlockTrack = MATROSKA_BlockReadTrack((matroska_block *)Block);
+				BlockTrack = MATROSKA_BlockReadTrack((matroska_block*)GBlock);
                 if (!BlockTrack) continue;
                 Type = EBML_MasterFindChild((ebml_master*)BlockTrack,MATROSKA_getContextTrackType());
                 if (!Type) continue;
                 if (EBML_IntegerValue((ebml_integer*)Type)==MATROSKA_TRACK_TYPE_AUDIO || EBML_IntegerValue((ebml_integer*)Type)==MATROSKA_TRACK_TYPE_SUBTITLE)
                 {
-                    MATROSKA_BlockSetKeyframe((matroska_block*)Block,1);
-                    MATROSKA_BlockSetDiscardable((matroska_block*)Block,0);
+                    MATROSKA_BlockSetKeyframe((matroska_block*)GBlock,1);
+					MATROSKA_BlockSetDiscardable((matroska_block*)GBlock,0);
                 }
-                BlockNum = MATROSKA_BlockTrackNum((matroska_block*)Block);
-                if (MATROSKA_BlockGetFrameCount((matroska_block*)Block)>1)
+                BlockNum = MATROSKA_BlockTrackNum((matroska_block*)GBlock);
+                if (MATROSKA_BlockGetFrameCount((matroska_block*)GBlock)>1)
                     ARRAYBEGIN(*WTracks,track_info)[BlockNum].IsLaced = 1;
 			}
 		}
-    }
+		else if (EBML_ElementIsType(Block, MATROSKA_getContextSimpleBlock()))
+		{
+			BlockTrack = MATROSKA_BlockReadTrack((matroska_block *)Block);
+            if (!BlockTrack) continue;
+            Type = EBML_MasterFindChild((ebml_master*)BlockTrack,MATROSKA_getContextTrackType());
+            if (!Type) continue;
+            if (EBML_IntegerValue((ebml_integer*)Type)==MATROSKA_TRACK_TYPE_AUDIO || EBML_IntegerValue((ebml_integer*)Type)==MATROSKA_TRACK_TYPE_SUBTITLE)
+            {
+                MATROSKA_BlockSetKeyframe((matroska_block*)Block,1);
+                MATROSKA_BlockSetDiscardable((matroska_block*)Block,0);
+            }
+            BlockNum = MATROSKA_BlockTrackNum((matroska_block*)Block);
+            if (MATROSKA_BlockGetFrameCount((matroska_block*)Block)>1)
+                ARRAYBEGIN(*WTracks,track_info)[BlockNum].IsLaced = 1;
+		}
+	}
+}
+
+static int LinkClusters(array *Clusters, ebml_master *RSegmentInfo, const matroska_track_map *TrackMap, int dstProfile, array *WTracks, mkv_timestamp_t Offset)
+{
+    matroska_cluster **Cluster;
+    int Result;
+
+	for (Cluster=ARRAYBEGIN(*Clusters,matroska_cluster*);Cluster!=ARRAYEND(*Clusters,matroska_cluster*);++Cluster)
+	{
+		Result = CheckClusterProfile(*Cluster, dstProfile);
+		if (Result!=0)
+			return Result;
+	}
+
+	for (Cluster=ARRAYBEGIN(*Clusters,matroska_cluster*);Cluster!=ARRAYEND(*Clusters,matroska_cluster*);++Cluster)
+		LinkCluster(*Cluster, RSegmentInfo, TrackMap, WTracks, Offset);
 	return 0;
 }
 
+static void LinkClusterWriteTracks(ebml_master *Cluster, ebml_master *WTrackInfo, ebml_master *WSegmentInfo)
+{
+    ebml_element *Elt, *Elt2, *NextElt;
+
+    for (Elt = EBML_MasterChildren(Cluster);Elt;Elt=NextElt)
+    {
+        NextElt = EBML_MasterNext(Elt);
+        if (EBML_ElementIsType(Elt, MATROSKA_getContextBlockGroup()))
+        {
+            for (Elt2 = EBML_MasterChildren((ebml_master*)Elt);Elt2;Elt2=EBML_MasterNext((ebml_master*)Elt2))
+            {
+                if (EBML_ElementIsType(Elt2, MATROSKA_getContextBlock()))
+                {
+                    if (MATROSKA_LinkBlockWithWriteTracks((matroska_block*)Elt2,WTrackInfo,DstProfile)!=ERR_NONE)
+                        NodeDelete((node*)Elt);
+                    else if (MATROSKA_LinkBlockWriteSegmentInfo((matroska_block*)Elt2,WSegmentInfo)!=ERR_NONE)
+                        NodeDelete((node*)Elt);
+                    break;
+                }
+            }
+        }
+        else if (EBML_ElementIsType(Elt, MATROSKA_getContextSimpleBlock()))
+        {
+            if (MATROSKA_LinkBlockWithWriteTracks((matroska_block*)Elt,WTrackInfo,DstProfile)!=ERR_NONE)
+                NodeDelete((node*)Elt);
+            else if (MATROSKA_LinkBlockWriteSegmentInfo((matroska_block*)Elt,WSegmentInfo)!=ERR_NONE)
+                NodeDelete((node*)Elt);
+        }
+    }
+}
+
 static void OptimizeCues(ebml_master *Cues, array *Clusters, ebml_master *RSegmentInfo, filepos_t StartPos, ebml_master *WSegment, filepos_t TotalSize, bool_t ReLink, bool_t SafeClusters, stream *Input)
 {
     matroska_cluster **Cluster;
@@ -746,15 +821,51 @@ static ebml_master *GetMainTrack(ebml_master *Tracks, array *TrackOrder)
 	return Track;
 }
 
-static bool_t GenerateCueEntries(ebml_master *Cues, array *Clusters, ebml_master *Tracks, ebml_master *WSegmentInfo, ebml_element *RSegment, filepos_t TotalSize)
+static matroska_block *FindCueBlock(ebml_master *Cluster, int64_t TrackNum, mkv_timestamp_t *PrevTimestamp)
 {
-	ebml_master *Track;
 	ebml_element *Elt;
 	matroska_block *Block;
-	ebml_element **Cluster;
-	matroska_cuepoint *CuePoint;
-	int64_t TrackNum;
-	mkv_timestamp_t PrevTimestamp = INVALID_TIMESTAMP_T, BlockTimestamp;
+	mkv_timestamp_t BlockTimestamp;
+
+	for (Elt = EBML_MasterChildren(Cluster); Elt; Elt = EBML_MasterNext(Elt))
+	{
+		Block = NULL;
+		if (EBML_ElementIsType(Elt, MATROSKA_getContextSimpleBlock()))
+		{
+			if (MATROSKA_BlockKeyframe((matroska_block*)Elt))
+				Block = (matroska_block*)Elt;
+		}
+		else if (EBML_ElementIsType(Elt, MATROSKA_getContextBlockGroup()))
+		{
+			ebml_element *EltB, *BlockRef = NULL;
+			for (EltB = EBML_MasterChildren(Elt); EltB; EltB = EBML_MasterNext(EltB))
+			{
+				if (EBML_ElementIsType(EltB, MATROSKA_getContextBlock()))
+					Block = (matroska_block*)EltB;
+				else if (EBML_ElementIsType(EltB, MATROSKA_getContextReferenceBlock()))
+					BlockRef = EltB;
+			}
+			if (BlockRef && Block)
+				Block = NULL; // not a keyframe
+		}
+
+		if (Block && MATROSKA_BlockTrackNum(Block) == TrackNum)
+		{
+			BlockTimestamp = MATROSKA_BlockTimestamp(Block);
+			if ((BlockTimestamp - *PrevTimestamp) < 800000000 && *PrevTimestamp != INVALID_TIMESTAMP_T)
+				return NULL; // no more than 1 Cue per Cluster and per 800 ms
+
+			*PrevTimestamp = BlockTimestamp;
+			return Block; // one Cues per Cluster is enough
+		}
+	}
+	return NULL;
+}
+
+static bool_t GetCueTrack(ebml_master *Tracks, int64_t *TrackNum)
+{
+	ebml_master *Track;
+	ebml_element *Elt;
 
 	Track = GetMainTrack(Tracks, NULL);
 	if (!Track)
@@ -766,7 +877,20 @@ static bool_t GenerateCueEntries(ebml_master *Cues, array *Clusters, ebml_master
 	Elt = EBML_MasterFindChild(Track,MATROSKA_getContextTrackNumber());
 	assert(Elt!=NULL);
 	if (Elt)
-		TrackNum = EBML_IntegerValue((ebml_integer*)Elt);
+		*TrackNum = EBML_IntegerValue((ebml_integer*)Elt);
+	return 1;
+}
+
+static bool_t GenerateCueEntries(ebml_master *Cues, array *Clusters, ebml_master *Tracks, ebml_master *WSegmentInfo, ebml_element *RSegment, filepos_t TotalSize)
+{
+	matroska_block *Block;
+	ebml_element **Cluster;
+	matroska_cuepoint *CuePoint;
+	int64_t TrackNum;
+	mkv_timestamp_t PrevTimestamp = INVALID_TIMESTAMP_T;
+
+	if (!GetCueTrack(Tracks, &TrackNum))
+		return 0;
 
 	// find all the keyframes
     ++CurrentPhase;
@@ -774,48 +898,18 @@ static bool_t GenerateCueEntries(ebml_master *Cues, array *Clusters, ebml_master
 	{
         ShowProgress((ebml_element*)(*Cluster), TotalSize);
 		MATROSKA_LinkClusterWriteSegmentInfo((matroska_cluster*)*Cluster,WSegmentInfo);
-		for (Elt = EBML_MasterChildren(*Cluster); Elt; Elt = EBML_MasterNext(Elt))
+		Block = FindCueBlock((ebml_master*)*Cluster, TrackNum, &PrevTimestamp);
+		if (Block)
 		{
-			Block = NULL;
-			if (EBML_ElementIsType(Elt, MATROSKA_getContextSimpleBlock()))
-			{
-				if (MATROSKA_BlockKeyframe((matroska_block*)Elt))
-					Block = (matroska_block*)Elt;
-			}
-			else if (EBML_ElementIsType(Elt, MATROSKA_getContextBlockGroup()))
+			CuePoint = (matroska_cuepoint*)EBML_MasterAddElt(Cues,MATROSKA_getContextCuePoint(),1,DstProfile);
+			if (!CuePoint)
 			{
-				ebml_element *EltB, *BlockRef = NULL;
-				for (EltB = EBML_MasterChildren(Elt); EltB; EltB = EBML_MasterNext(EltB))
-				{
-					if (EBML_ElementIsType(EltB, MATROSKA_getContextBlock()))
-						Block = (matroska_block*)EltB;
-					else if (EBML_ElementIsType(EltB, MATROSKA_getContextReferenceBlock()))
-						BlockRef = EltB;
-				}
-				if (BlockRef && Block)
-					Block = NULL; // not a keyframe
-			}
-
-			if (Block && MATROSKA_BlockTrackNum(Block) == TrackNum)
-			{
-				BlockTimestamp = MATROSKA_BlockTimestamp(Block);
-				if ((BlockTimestamp - PrevTimestamp) < 800000000 && PrevTimestamp != INVALID_TIMESTAMP_T)
-					break; // no more than 1 Cue per Cluster and per 800 ms
-
-				CuePoint = (matroska_cuepoint*)EBML_MasterAddElt(Cues,MATROSKA_getContextCuePoint(),1,DstProfile);
-				if (!CuePoint)
-				{
-					TextPrintf(StdErr,T("Failed to create a new CuePoint ! out of memory ?\r\n"));
-					return 0;
-				}
-				MATROSKA_LinkCueSegmentInfo(CuePoint,WSegmentInfo);
-				MATROSKA_LinkCuePointBlock(CuePoint,Block);
-				MATROSKA_CuePointUpdate(CuePoint,RSegment, DstProfile);
-
-				PrevTimestamp = BlockTimestamp;
-
-				break; // one Cues per Cluster is enough
+				TextPrintf(StdErr,T("Failed to create a new CuePoint ! out of memory ?\r\n"));
+				return 0;
 			}
+			MATROSKA_LinkCueSegmentInfo(CuePoint,WSegmentInfo);
+			MATROSKA_LinkCuePointBlock(CuePoint,Block);
+			MATROSKA_CuePointUpdate(CuePoint,RSegment, DstProfile);
 		}
 	}
     EndProgress();
@@ -830,6 +924,317 @@ static bool_t GenerateCueEntries(ebml_master *Cues, array *Clusters, ebml_master
 	return 1;
 }
 
+static void RemoveClusterPositions(ebml_master *Cluster)
+{
+	ebml_element *Elt;
+	// remove MATROSKA_ContextPosition and MATROSKA_ContextPrevSize until supported
+	Elt = EBML_MasterFindChild(Cluster, MATROSKA_getContextPosition());
+	if (Elt)
+		NodeDelete((node*)Elt);
+	Elt = EBML_MasterFindChild(Cluster, MATROSKA_getContextPrevSize());
+	if (Elt)
+		NodeDelete((node*)Elt);
+}
+
+static matroska_cluster *StreamLoadCluster(cluster_stream *Stream, const cluster_info *Info)
+{
+	ebml_element *Cluster;
+	int UpperElement = 0;
+
+	Stream_Seek(Stream->Input,Info->SrcPosition,SEEK_SET);
+	Cluster = EBML_FindNextElement(Stream->Input, Stream->Context, &UpperElement, 1);
+	if (Cluster && (!EBML_ElementIsType(Cluster, MATROSKA_getContextCluster()) ||
+		EBML_ElementReadData(Cluster,Stream->Input,Stream->Context,1,SCOPE_PARTIAL_DATA,0)!=ERR_NONE))
+	{
+		NodeDelete((node*)Cluster);
+		Cluster = NULL;
+	}
+	if (!Cluster)
+	{
+		TextPrintf(StdErr,T("Failed to reload the Cluster at %") TPRId64 T("\r\n"),Info->SrcPosition);
+		return NULL;
+	}
+	RemoveClusterPositions((ebml_master*)Cluster);
+	return (matroska_cluster*)Cluster;
+}
+
+// redo on a reloaded Cluster what is done on all the Clusters in memory otherwise
+static void StreamPrepareCluster(cluster_stream *Stream, matroska_cluster *Cluster)
+{
+	LinkCluster(Cluster, Stream->RSegmentInfo, Stream->RTrackMap, Stream->WTracks, INVALID_TIMESTAMP_T);
+	if (Stream->WTrackInfo)
+	{
+		LinkClusterWriteTracks((ebml_master*)Cluster, Stream->WTrackInfo, Stream->WSegmentInfo);
+		MATROSKA_LinkClusterWriteSegmentInfo(Cluster, Stream->WSegmentInfo);
+	}
+}
+
+static bool_t StreamIsLacedTrack(const cluster_stream *Stream, int16_t TrackNum)
+{
+	const int16_t *Track;
+
+	for (Track=ARRAYBEGIN(Stream->LacedTracks,int16_t);Track!=ARRAYEND(Stream->LacedTracks,int16_t);++Track)
+		if (*Track == TrackNum)
+			return 1;
+	return 0;
+}
+
+static void StreamIndexBlock(cluster_stream *Stream, ebml_element *Block)
+{
+	int16_t BlockNum;
+
+	if (EBML_ElementIsType(Block, MATROSKA_getContextSimpleBlock()))
+	{
+		if (Stream->SimpleBlockPos == INVALID_FILEPOS_T || EBML_ElementPosition(Block) < Stream->SimpleBlockPos)
+			Stream->SimpleBlockPos = EBML_ElementPosition(Block);
+	}
+	else if (EBML_ElementIsType(Block, MATROSKA_getContextBlockGroup()))
+		Block = EBML_MasterFindChild((ebml_master*)Block, MATROSKA_getContextBlock());
+	else
+		return;
+
+	if (!Block || MATROSKA_BlockGetFrameCount((matroska_block*)Block)<=1)
+		return;
+	BlockNum = MATROSKA_BlockTrackNum((matroska_block*)Block);
+	if (!StreamIsLacedTrack(Stream, BlockNum))
+		ArrayAppend(&Stream->LacedTracks,&BlockNum,sizeof(BlockNum),16);
+}
+
+// record from the shallow read of the index pass what LinkCluster() needs for all the Clusters
+static void StreamIndexCluster(cluster_stream *Stream, matroska_cluster *Cluster, stream *Input, const ebml_parser_context *Context)
+{
+	const matroska_cluster_block *Blocks;
+	ebml_element *Block, *Elt;
+	filepos_t Pos = Stream_Seek(Input,0,SEEK_CUR);
+	size_t i, Count;
+
+	// the Blocks that could not be recorded are read as usual
+	for (Elt=EBML_MasterChildren(Cluster);Elt;Elt=EBML_MasterNext(Elt))
+		StreamIndexBlock(Stream, Elt);
+
+	Blocks = MATROSKA_ClusterShallowBlocks(Cluster, &Count);
+	for (i=0;i<Count;++i)
+	{
+		if (Blocks[i].Id == EBML_ContextClassID(MATROSKA_getContextSimpleBlock()) &&
+			(Stream->SimpleBlockPos == INVALID_FILEPOS_T || Blocks[i].Position < Stream->SimpleBlockPos))
+			Stream->SimpleBlockPos = Blocks[i].Position;
+		// only read the lacing of the Blocks that have some, until their track is known to use it
+		if ((Blocks[i].Flags & 0x06) && !StreamIsLacedTrack(Stream, (int16_t)Blocks[i].TrackNumber) &&
+			MATROSKA_ClusterReadShallowBlock(Cluster, Input, Context, &Blocks[i], SCOPE_PARTIAL_DATA, &Block)==ERR_NONE)
+			StreamIndexBlock(Stream, Block);
+	}
+	Stream_Seek(Input,Pos,SEEK_SET);
+}
+
+// same as LinkClusters() with what was recorded during the index pass
+static int StreamLinkClusters(cluster_stream *Stream, int dstProfile)
+{
+	const int16_t *Track;
+	const matroska_track_info *Info;
+
+	if ((dstProfile == PROFILE_MATROSKA_V1 || dstProfile == PROFILE_DIVX) && Stream->SimpleBlockPos != INVALID_FILEPOS_T)
+	{
+		TextPrintf(StdErr,T("Using SimpleBlock in profile '%s' at %") TPRId64 T(" try \"--doctype %d\"\r\n"),GetProfileName(dstProfile),Stream->SimpleBlockPos,GetProfileId(PROFILE_MATROSKA_V2));
+		return -32;
+	}
+
+	// a Block only marks its track as laced when it's linked to a track with a type
+	for (Track=ARRAYBEGIN(Stream->LacedTracks,int16_t);Track!=ARRAYEND(Stream->LacedTracks,int16_t);++Track)
+	{
+		Info = *Track>=0 ? MATROSKA_TrackMapGet(Stream->RTrackMap, (uint16_t)*Track) : NULL;
+		if (Info && EBML_MasterFindChild(Info->TrackEntry,MATROSKA_getContextTrackType()) && (size_t)*Track<ARRAYCOUNT(*Stream->WTracks,track_info))
+			ARRAYBEGIN(*Stream->WTracks,track_info)[*Track].IsLaced = 1;
+	}
+	return 0;
+}
+
+static err_t StreamCuePointUpdate(matroska_cuepoint *Cue, cluster_stream *Stream, const cluster_info *Info, ebml_element *Segment)
+{
+	ebml_element *Elt;
+	ebml_integer *Value;
+
+	// same as MATROSKA_CuePointUpdate() without a Block to link to
+	EBML_MasterErase((ebml_master*)Cue);
+	EBML_MasterAddMandatory((ebml_master*)Cue,1, DstProfile);
+	Value = (ebml_integer*)EBML_MasterGetChild((ebml_master*)Cue,MATROSKA_getContextCueTime(), DstProfile);
+	if (!Value)
+		return ERR_OUT_OF_MEMORY;
+	EBML_IntegerSetValue(Value, Scale64(Info->CueTimestamp,1,MATROSKA_SegmentInfoTimestampScale(Stream->WSegmentInfo)));
+
+	Elt = EBML_MasterGetChild((ebml_master*)Cue,MATROSKA_getContextCueTrackPositions(), DstProfile);
+	if (!Elt)
+		return ERR_OUT_OF_MEMORY;
+	Value = (ebml_integer*)EBML_MasterGetChild((ebml_master*)Elt,MATROSKA_getContextCueTrack(), DstProfile);
+	if (!Value)
+		return ERR_OUT_OF_MEMORY;
+	EBML_IntegerSetValue(Value, Stream->CueTrack);
+
+	Value = (ebml_integer*)EBML_MasterGetChild((ebml_master*)Elt,MATROSKA_getContextCueClusterPosition(), DstProfile);
+	if (!Value)
+		return ERR_OUT_OF_MEMORY;
+	EBML_IntegerSetValue(Value, Info->Position - EBML_ElementPositionData(Segment));
+	return ERR_NONE;
+}
+
+static void StreamRemoveCue(ebml_master *Cues, cluster_info *Info)
+{
+	EBML_MasterRemove(Cues,(ebml_element*)Info->Cue);
+	NodeDelete((node*)Info->Cue);
+	Info->Cue = NULL;
+}
+
+// generate the Cues and get the output size of each Cluster
+static int StreamGenerateCueEntries(cluster_stream *Stream, ebml_master *Cues, ebml_element *RSegment, bool_t ClustersNeedRead, filepos_t TotalSize, bool_t *CuesCreated)
+{
+	cluster_info *Info;
+	matroska_cluster *Cluster;
+	matroska_block *Block;
+	mkv_timestamp_t PrevTimestamp = INVALID_TIMESTAMP_T;
+	bool_t HasCueTrack = GetCueTrack(Stream->WTrackInfo, &Stream->CueTrack);
+
+	++CurrentPhase;
+	for (Info=ARRAYBEGIN(Stream->Clusters,cluster_info);Info!=ARRAYEND(Stream->Clusters,cluster_info);++Info)
+	{
+		Cluster = StreamLoadCluster(Stream, Info);
+		if (!Cluster)
+			return -25;
+		ShowProgress((ebml_element*)Cluster, TotalSize);
+		StreamPrepareCluster(Stream, Cluster);
+
+		Block = HasCueTrack ? FindCueBlock((ebml_master*)Cluster, Stream->CueTrack, &PrevTimestamp) : NULL;
+		if (Block)
+		{
+			Info->Cue = (matroska_cuepoint*)EBML_MasterAddElt(Cues,MATROSKA_getContextCuePoint(),1,DstProfile);
+			if (!Info->Cue)
+			{
+				TextPrintf(StdErr,T("Failed to create a new CuePoint ! out of memory ?\r\n"));
+				NodeDelete((node*)Cluster);
+				return -25;
+			}
+			Info->CueTimestamp = MATROSKA_BlockTimestamp(Block);
+			MATROSKA_LinkCueSegmentInfo(Info->Cue,Stream->WSegmentInfo);
+			StreamCuePointUpdate(Info->Cue, Stream, Info, RSegment);
+		}
+
+		if (ClustersNeedRead)
+		{
+			// the Cue Block may not be readable
+			if (ReadClusterData((ebml_master*)Cluster, Stream->Input) && Info->Cue && !MATROSKA_GetBlockForTimestamp(Cluster, Info->CueTimestamp, (int16_t)Stream->CueTrack))
+				StreamRemoveCue(Cues, Info);
+		}
+		EBML_ElementUpdateSize(Cluster,0,0, DstProfile);
+		Info->DataSize = EBML_ElementDataSize((ebml_element*)Cluster,0);
+		Info->SizeLength = EBML_ElementSizeLength((ebml_element*)Cluster);
+		NodeDelete((node*)Cluster);
+	}
+	EndProgress();
+
+	*CuesCreated = HasCueTrack && EBML_MasterChildren(Cues)!=NULL;
+	if (HasCueTrack && !*CuesCreated)
+		TextPrintf(StdErr,T("Failed to create the Cue entries, no Block found\r\n"));
+	if (*CuesCreated)
+		EBML_ElementUpdateSize(Cues,0,0, DstProfile);
+	return 0;
+}
+
+static void StreamSettleClusters(cluster_stream *Stream, filepos_t ClusterStart, ebml_master *Cues, ebml_master *Segment, bool_t SafeClusters)
+{
+	cluster_info *Info;
+	ebml_element *Cluster, *PrevSize;
+	filepos_t OriginalSize, ClusterPos, ClusterSize, DataSize;
+	size_t PrevSizes;
+
+	// placeholders to compute the Cluster size with its PrevSize
+	Cluster = EBML_ElementCreate(Cues,MATROSKA_getContextCluster(),0,DstProfile,NULL);
+	PrevSize = EBML_ElementCreate(Cues,MATROSKA_getContextPrevSize(),0,DstProfile,NULL);
+
+	ReduceSize((ebml_element*)Cues);
+	MATROSKA_CuesSort(Cues);
+
+	do
+	{
+		OriginalSize = EBML_ElementDataSize((ebml_element*)Cues,0);
+		ClusterPos = ClusterStart + EBML_ElementFullSize((ebml_element*)Cues,0);
+		ClusterSize = INVALID_FILEPOS_T;
+		PrevSizes = 0;
+		for (Info=ARRAYBEGIN(Stream->Clusters,cluster_info);Info!=ARRAYEND(Stream->Clusters,cluster_info);++Info)
+		{
+			Info->Position = ClusterPos;
+			DataSize = Info->DataSize;
+			if (SafeClusters && ClusterSize != INVALID_FILEPOS_T)
+			{
+				EBML_IntegerSetValue((ebml_integer*)PrevSize, ClusterSize);
+				EBML_ElementUpdateSize(PrevSize,0,0, DstProfile);
+				DataSize += EBML_ElementFullSize(PrevSize,0);
+				PrevSizes += (size_t)EBML_ElementFullSize(PrevSize,0);
+			}
+			EBML_ElementForceDataSize(Cluster, DataSize);
+			EBML_ElementSetSizeLength(Cluster, Info->SizeLength);
+			ClusterSize = EBML_ElementFullSize(Cluster,0);
+			ClusterPos += ClusterSize;
+			if (Info->Cue)
+				StreamCuePointUpdate(Info->Cue, Stream, Info, (ebml_element*)Segment);
+		}
+	}
+	while (EBML_ElementUpdateSize(Cues,0,0, DstProfile) != OriginalSize);
+	ExtraSizeDiff += PrevSizes;
+
+	NodeDelete((node*)Cluster);
+	NodeDelete((node*)PrevSize);
+}
+
+static int StreamWriteClusters(cluster_stream *Stream, stream *Output, ebml_master *Cues, ebml_element *FirstCluster, bool_t Settled, filepos_t *SegmentSize, bool_t *CuesChanged, filepos_t TotalSize)
+{
+	cluster_info *Info;
+	matroska_cluster *Cluster;
+	ebml_element *Elt, *Elt2;
+	filepos_t ClusterSize = INVALID_FILEPOS_T;
+	mkv_timestamp_t PrevTimestamp = INVALID_TIMESTAMP_T;
+
+	for (Info=ARRAYBEGIN(Stream->Clusters,cluster_info);Info!=ARRAYEND(Stream->Clusters,cluster_info);++Info)
+	{
+		Cluster = StreamLoadCluster(Stream, Info);
+		if (!Cluster)
+			return -25;
+		ShowProgress((ebml_element*)Cluster, TotalSize);
+		StreamPrepareCluster(Stream, Cluster);
+
+		if (!Settled)
+			EBML_ElementForcePosition((ebml_element*)Cluster, Stream_Seek(Output,0,SEEK_CUR));
+		else
+		{
+			EBML_ElementForcePosition((ebml_element*)Cluster, Info->Position);
+			if (ClusterSize != INVALID_FILEPOS_T)
+			{
+				Elt = EBML_MasterGetChild((ebml_master*)Cluster, MATROSKA_getContextPrevSize(), DstProfile);
+				if (Elt)
+				{
+					EBML_IntegerSetValue((ebml_integer*)Elt, ClusterSize);
+					Elt2 = EBML_MasterFindChild(Cluster, MATROSKA_getContextTimestamp());
+					if (Elt2)
+						NodeTree_SetParent(Elt,Cluster,NodeTree_Next(Elt2)); // make sure the PrevSize is just after the ClusterTimestamp
+				}
+			}
+		}
+
+		if (WriteCluster((ebml_master*)Cluster,Output,Stream->Input, ClusterSize, &PrevTimestamp))
+			*CuesChanged = 1;
+		if (Info->Cue && !MATROSKA_GetBlockForTimestamp(Cluster, Info->CueTimestamp, (int16_t)Stream->CueTrack))
+		{
+			StreamRemoveCue(Cues, Info);
+			*CuesChanged = 1;
+		}
+
+		if (Info == ARRAYBEGIN(Stream->Clusters,cluster_info))
+			EBML_ElementForcePosition(FirstCluster, EBML_ElementPosition((ebml_element*)Cluster));
+		if (!Unsafe)
+			ClusterSize = EBML_ElementFullSize((ebml_element*)Cluster,0);
+		*SegmentSize += EBML_ElementFullSize((ebml_element*)Cluster,0);
+		NodeDelete((node*)Cluster);
+	}
+	return 0;
+}
+
 static int TimcodeCmp(const void* Param, const mkv_timestamp_t *a, const mkv_timestamp_t *b)
 {
 	if (*a == *b)
@@ -1332,45 +1737,44 @@ static bool_t BlockIsCompressed(const matroska_block *Block)
     return 0;
 }
 
-static void ShrinkCommonHeader(array *TrackHeader, matroska_block *Block, stream *Input)
+static err_t ShrinkFrameHeader(void *Cookie, size_t UNUSED_PARAM(FrameNum), const matroska_frame_view *Frame)
 {
-    size_t Frame,FrameCount,EqualData;
-    matroska_frame FrameData;
-
-    if (TrackHeader->_Begin != TABLE_MARKER && ARRAYCOUNT(*TrackHeader,uint8_t)==0)
-        return;
-    if (MATROSKA_BlockReadData(Block,Input,SrcProfile)!=ERR_NONE)
-        return;
-
-    if (BlockIsCompressed(Block))
-        return;
+    array *TrackHeader = Cookie;
+    size_t EqualData = 0;
 
-    FrameCount = MATROSKA_BlockGetFrameCount(Block);
-    Frame = 0;
-    if (FrameCount && TrackHeader->_Begin == TABLE_MARKER)
+    if (TrackHeader->_Begin == TABLE_MARKER)
     {
         // use the first frame as the reference
-        MATROSKA_BlockGetFrame(Block,Frame,&FrameData,1);
         TrackHeader->_Begin = NULL;
-        ArrayAppend(TrackHeader,FrameData.Data,FrameData.Size,0);
-        Frame = 1;
+        if (!ArrayAppend(TrackHeader,Frame->Head,Frame->HeadSize,0) || !ArrayAppend(TrackHeader,Frame->Data,Frame->Size,0))
+            return ERR_OUT_OF_MEMORY;
+        return ERR_NONE;
     }
-    for (;Frame<FrameCount;++Frame)
+
+    while (EqualData < Frame->HeadSize + Frame->Size && EqualData < ARRAYCOUNT(*TrackHeader,uint8_t))
     {
-        MATROSKA_BlockGetFrame(Block,Frame,&FrameData,1);
-        EqualData = 0;
-        while (EqualData < FrameData.Size && EqualData < ARRAYCOUNT(*TrackHeader,uint8_t))
-        {
-            if (ARRAYBEGIN(*TrackHeader,uint8_t)[EqualData] == FrameData.Data[EqualData])
-                ++EqualData;
-            else
-                break;
-        }
-        if (EqualData != ARRAYCOUNT(*TrackHeader,uint8_t))
-            ArrayShrink(TrackHeader,ARRAYCOUNT(*TrackHeader,uint8_t)-EqualData);
-        if (ARRAYCOUNT(*TrackHeader,uint8_t)==0)
+        uint8_t Byte = EqualData < Frame->HeadSize ? Frame->Head[EqualData] : Frame->Data[EqualData - Frame->HeadSize];
+        if (ARRAYBEGIN(*TrackHeader,uint8_t)[EqualData] == Byte)
+            ++EqualData;
+        else
             break;
     }
+    if (EqualData != ARRAYCOUNT(*TrackHeader,uint8_t))
+        ArrayShrink(TrackHeader,ARRAYCOUNT(*TrackHeader,uint8_t)-EqualData);
+    if (ARRAYCOUNT(*TrackHeader,uint8_t)==0)
+        return ERR_END_OF_FILE; // nothing common left
+    return ERR_NONE;
+}
+
+static void ShrinkCommonHeader(array *TrackHeader, matroska_block *Block, stream *Input)
+{
+    if (TrackHeader->_Begin != TABLE_MARKER && ARRAYCOUNT(*TrackHeader,uint8_t)==0)
+        return;
+    if (BlockIsCompressed(Block))
+        return;
+
+    // the frames are seen in the input buffer, the Block data is not loaded
+    MATROSKA_BlockVisitFrames(Block,Input,ShrinkFrameHeader,TrackHeader,SrcProfile);
     MATROSKA_BlockReleaseData(Block,1);
 }
 
@@ -1408,24 +1812,27 @@ int main(int argc, const char *argv[])
     matroska_seekpoint *WSeekPoint = NULL, *W1stClusterSeek = NULL;
     ebml_string *LibName, *AppName;
     array RClusters, WClusters, *Clusters, WTracks;
+    matroska_track_map RTrackMap;
     ebml_parser_context RContext;
     ebml_parser_context RSegmentContext;
     int UpperElement;
     filepos_t MetaSeekBefore, MetaSeekAfter;
     filepos_t NextPos = 0, SegmentSize = 0, ClusterSize, CuesSize;
-    size_t ExtraVoidSize = 0;
+    size_t ExtraVoidSize = 0, ClusterCount = 0;
     mkv_timestamp_t PrevTimestamp;
     bool_t CuesChanged;
-	bool_t KeepCues = 0, Remux = 0, CuesCreated = 0, Optimize = 0, OptimizeVideo = 1, UnOptimize = 0, ClustersNeedRead = 0, Regression = 0;
+	bool_t KeepCues = 0, Remux = 0, CuesCreated = 0, Optimize = 0, OptimizeVideo = 1, UnOptimize = 0, ClustersNeedRead = 0, Regression = 0, Streaming = 0, Settled = 0;
     int InputPathIndex = 1;
 	int64_t TimestampScale = 0, OldTimestampScale;
     size_t MaxTrackNum = 0;
     array TrackMaxHeader; // array of uint8_t (max common header)
     filepos_t TotalSize;
     array Alternate3DTracks;
+    cluster_stream ClusterStream;
+    ebml_element *FirstCluster = NULL;
 
     // Core-C init phase
-    ParserContext_Init(&p,NULL,NULL,NULL);
+    ParserContext_InitEx(&p,NULL,NULL,NULL,NODECONTEXT_SINGLE_THREAD);
     Node_SetData(&p.Base.Base.Base,NODECONTEXT_PROJECT_VENDOR,TYPE_STRING,"Matroska");
     Node_SetData(&p.Base.Base.Base,NODECONTEXT_PROJECT_VERSION,TYPE_STRING,PROJECT_VERSION);
     Node_SetData(&p.Base.Base.Base,NODECONTEXT_PROJECT_NAME,TYPE_STRING,PROJECT_NAME);
@@ -1436,8 +1843,13 @@ int main(int argc, const char *argv[])
     ArrayInit(&RClusters);
     ArrayInit(&WClusters);
     ArrayInit(&WTracks);
+    ArrayInit(&RTrackMap.Tracks);
 	ArrayInit(&TrackMaxHeader);
     ArrayInit(&Alternate3DTracks);
+    memset(&ClusterStream,0,sizeof(ClusterStream));
+    ArrayInit(&ClusterStream.Clusters);
+    ArrayInit(&ClusterStream.LacedTracks);
+    ClusterStream.SimpleBlockPos = INVALID_FILEPOS_T;
 	Clusters = &RClusters;
 
     StdErr = &_StdErr;
@@ -1505,6 +1917,16 @@ int main(int argc, const char *argv[])
 			TimestampScale = StringToInt(Path,0);
 			InputPathIndex = i+1;
 		}
+		else if (tcsisame_ascii(Path,T("--threads")) && i+1<argc-1)
+		{
+#if defined(TARGET_WIN) && defined(UNICODE)
+		    Node_FromWcs(&p,Path,TSIZEOF(Path),argv[++i]);
+#else
+		    Node_FromStr(&p,Path,TSIZEOF(Path),argv[++i]);
+#endif
+			CompressThreads = StringToInt(Path,0);
+			InputPathIndex = i+1;
+		}
 		else if (tcsisame_ascii(Path,T("--alt-3d")) && i+1<argc-1)
 		{
             size_t TrackId;
@@ -1527,6 +1949,7 @@ int main(int argc, const char *argv[])
 		else if (tcsisame_ascii(Path,T("--optimize"))) { Optimize = 1; OptimizeVideo = 1; InputPathIndex = i+1; }
 		else if (tcsisame_ascii(Path,T("--optimize_nv"))) { Optimize = 1; OptimizeVideo = 0; InputPathIndex = i+1; }
 		else if (tcsisame_ascii(Path,T("--regression"))) { Regression = 1; InputPathIndex = i+1; }
+		else if (tcsisame_ascii(Path,T("--stream"))) { Streaming = 1; InputPathIndex = i+1; }
 		else if (tcsisame_ascii(Path,T("--no-optimize"))) { UnOptimize = 1; InputPathIndex = i+1; }
 		else if (tcsisame_ascii(Path,T("--quiet"))) { Quiet = 1; InputPathIndex = i+1; }
 		else if (tcsisame_ascii(Path,T("--version"))) { ShowVersion = 1; InputPathIndex = i+1; }
@@ -1558,6 +1981,10 @@ int main(int argc, const char *argv[])
 		    TextWrite(StdErr,T("  --no-optimize disable some optimization for the output file\r\n"));
 		    TextWrite(StdErr,T("  --regression  the output file is suitable for regression tests\r\n"));
             TextWrite(StdErr,T("  --alt-3d <t>  the track with ID <v> has alternate 3D fields (left first)\r\n"));
+		    TextWrite(StdErr,T("  --stream      only keep one Cluster in memory at a time (slower)\r\n"));
+#if defined(CONFIG_MULTITHREAD)
+		    TextWrite(StdErr,T("  --threads <n> number of threads compressing the zlib tracks (default: one per CPU)\r\n"));
+#endif
 		    TextWrite(StdErr,T("  --quiet       only output errors\r\n"));
             TextWrite(StdErr,T("  --version     show the version of ") PROJECT_NAME T("\r\n"));
             TextWrite(StdErr,T("  --help        show this screen\r\n"));
@@ -1572,7 +1999,8 @@ int main(int argc, const char *argv[])
 #else
     Node_FromUTF8(&p,Path,TSIZEOF(Path),argv[InputPathIndex]);
 #endif
-    Input = StreamOpen(&p,Path,SFLAG_RDONLY/*|SFLAG_BUFFERED*/);
+    // a mapped file would keep all the Clusters read resident
+    Input = StreamOpen(&p,Path,SFLAG_RDONLY|SFLAG_BUFFERED|(Streaming?0:SFLAG_MEMORY_MAP));
     if (!Input)
     {
         TextPrintf(StdErr,T("Could not open file \"%s\" for reading\r\n"),Path);
@@ -1606,7 +2034,7 @@ int main(int argc, const char *argv[])
 #else
         Node_FromStr(&p,Path,TSIZEOF(Path),argv[argc-1]);
 #endif
-    Output = StreamOpen(&p,Path,SFLAG_WRONLY|SFLAG_CREATE);
+    Output = StreamOpen(&p,Path,SFLAG_WRONLY|SFLAG_CREATE|SFLAG_BUFFERED);
     if (!Output)
     {
         TextPrintf(StdErr,T("Could not open file \"%s\" for writing\r\n"),Path);
@@ -1654,6 +2082,12 @@ int main(int argc, const char *argv[])
     NodeDelete((node*)EbmlHead);
     EbmlHead = NULL;
 
+    if (Streaming && (Remux || Optimize || Live || KeepCues || ARRAYCOUNT(Alternate3DTracks, block_info*)))
+    {
+        TextWrite(StdErr,T("--stream can't be used with --remux, --optimize, --live, --keep-cues or --alt-3d, loading all Clusters in memory\r\n"));
+        Streaming = 0;
+    }
+
     if (Unsafe)
         ++TotalPhases;
     if (!Live)
@@ -1707,19 +2141,28 @@ int main(int argc, const char *argv[])
         }
         else if (EBML_ElementIsType((ebml_element*)RLevel1, MATROSKA_getContextCluster()))
         {
-			// only partially read the Cluster data (not the data inside the blocks)
-            if (EBML_ElementReadData((ebml_element*)RLevel1,Input,&RSegmentContext,!Remux,SCOPE_PARTIAL_DATA,0)==ERR_NONE)
+			// only partially read the Cluster data (not the data inside the blocks), --stream reloads it later
+            if (EBML_ElementReadData((ebml_element*)RLevel1,Input,&RSegmentContext,!Remux,Streaming?SCOPE_SHALLOW_DATA:SCOPE_PARTIAL_DATA,0)==ERR_NONE)
 			{
-                ArrayAppend(&RClusters,&RLevel1,sizeof(RLevel1),256);
-				// remove MATROSKA_ContextPosition and MATROSKA_ContextPrevSize until supported
-				EbmlHead = (ebml_master*)EBML_MasterFindChild(RLevel1, MATROSKA_getContextPosition());
-				if (EbmlHead)
-					NodeDelete((node*)EbmlHead);
-				EbmlHead = (ebml_master*)EBML_MasterFindChild(RLevel1, MATROSKA_getContextPrevSize());
-				if (EbmlHead)
-					NodeDelete((node*)EbmlHead);
-				EbmlHead = NULL;
-                RLevel1 = (ebml_master*)EBML_ElementSkipData((ebml_element*)RLevel1, Input, &RSegmentContext, NULL, 1);
+                if (Streaming)
+                {
+                    // only keep where to reload it from
+                    cluster_info Info;
+                    memset(&Info,0,sizeof(Info));
+                    Info.SrcPosition = Info.Position = EBML_ElementPosition((ebml_element*)RLevel1);
+                    ArrayAppend(&ClusterStream.Clusters,&Info,sizeof(Info),256);
+                    StreamIndexCluster(&ClusterStream, (matroska_cluster*)RLevel1, Input, &RSegmentContext);
+                    EbmlHead = (ebml_master*)EBML_ElementSkipData((ebml_element*)RLevel1, Input, &RSegmentContext, NULL, 1);
+                    NodeDelete((node*)RLevel1);
+                    RLevel1 = EbmlHead;
+                    EbmlHead = NULL;
+                }
+                else
+                {
+                    ArrayAppend(&RClusters,&RLevel1,sizeof(RLevel1),256);
+                    RemoveClusterPositions(RLevel1);
+                    RLevel1 = (ebml_master*)EBML_ElementSkipData((ebml_element*)RLevel1, Input, &RSegmentContext, NULL, 1);
+                }
                 if (RLevel1 != NULL)
                     continue;
 			}
@@ -1788,7 +2231,7 @@ int main(int argc, const char *argv[])
     if (Elt)
         NodeTree_SetParent(Elt,WSegmentInfo,Elt2);
 
-    if (!RTrackInfo && ARRAYCOUNT(RClusters,ebml_element*))
+    if (!RTrackInfo && (ARRAYCOUNT(RClusters,ebml_element*) || ARRAYCOUNT(ClusterStream.Clusters,cluster_info)))
     {
         TextWrite(StdErr,T("The source Segment has no Track Info section\r\n"));
         Result = -7;
@@ -1803,6 +2246,13 @@ int main(int argc, const char *argv[])
 			TextWrite(StdErr,T("No Tracks left to use!\r\n"));
 			goto exit;
 		}
+		// the Blocks of all the Clusters are linked with this index of the cleaned tracks
+		if (MATROSKA_TrackMapBuild(&RTrackMap, RTrackInfo)!=ERR_NONE)
+		{
+			TextWrite(StdErr,T("Failed to index the tracks ! out of memory ?\r\n"));
+			Result = -26;
+			goto exit;
+		}
 		WTrackInfo = (ebml_master*)EBML_ElementCopy(RTrackInfo, NULL);
 		if (WTrackInfo==NULL)
 		{
@@ -2082,41 +2532,25 @@ int main(int argc, const char *argv[])
 		NextPos += 134;
 	}
 
-    Result = LinkClusters(&RClusters,RSegmentInfo,RTrackInfo,DstProfile, &WTracks, Live?12345:INVALID_TIMESTAMP_T);
+    if (Streaming)
+    {
+        ClusterStream.Input = Input;
+        ClusterStream.Context = &RSegmentContext;
+        ClusterStream.RSegmentInfo = RSegmentInfo;
+        ClusterStream.RTrackMap = &RTrackMap;
+        ClusterStream.WTracks = &WTracks;
+        Result = StreamLinkClusters(&ClusterStream, DstProfile);
+    }
+    else
+    {
+        Result = LinkClusters(&RClusters,RSegmentInfo,&RTrackMap,DstProfile, &WTracks, Live?12345:INVALID_TIMESTAMP_T);
+    }
 	if (Result!=0)
 		goto exit;
 
     // use the output track settings for each block
     for (Cluster = ARRAYBEGIN(*Clusters,ebml_master*);Cluster != ARRAYEND(*Clusters,ebml_master*); ++Cluster)
-    {
-        //EBML_MasterUseChecksum((ebml_master*)*Cluster,!Unsafe);
-        for (Elt = EBML_MasterChildren(*Cluster);Elt;Elt=(ebml_element*)RLevel1)
-        {
-            RLevel1 = (ebml_master*)EBML_MasterNext((ebml_master*)Elt);
-            if (EBML_ElementIsType(Elt, MATROSKA_getContextBlockGroup()))
-            {
-                for (Elt2 = EBML_MasterChildren((ebml_master*)Elt);Elt2;Elt2=EBML_MasterNext((ebml_master*)Elt2))
-                {
-                    if (EBML_ElementIsType(Elt2, MATROSKA_getContextBlock()))
-                    {
-                        if (MATROSKA_LinkBlockWithWriteTracks((matroska_block*)Elt2,WTrackInfo,DstProfile)!=ERR_NONE)
-                            NodeDelete((node*)Elt);
-                        else if (MATROSKA_LinkBlockWriteSegmentInfo((matroska_block*)Elt2,WSegmentInfo)!=ERR_NONE)
-                            NodeDelete((node*)Elt);
-                        break;
-                    }
-                }
-            }
-            else if (EBML_ElementIsType(Elt, MATROSKA_getContextSimpleBlock()))
-            {
-                if (MATROSKA_LinkBlockWithWriteTracks((matroska_block*)Elt,WTrackInfo,DstProfile)!=ERR_NONE)
-                    NodeDelete((node*)Elt);
-                else if (MATROSKA_LinkBlockWriteSegmentInfo((matroska_block*)Elt,WSegmentInfo)!=ERR_NONE)
-                    NodeDelete((node*)Elt);
-            }
-        }
-	    //EBML_ElementUpdateSize(*Cluster, 0, 0);
-    }
+        LinkClusterWriteTracks(*Cluster,WTrackInfo,WSegmentInfo);
 
     if (Optimize && !UnOptimize)
     {
@@ -2763,8 +3197,9 @@ int main(int argc, const char *argv[])
 
 	if (!Live)
 	{
+        ClusterCount = Streaming ? ARRAYCOUNT(ClusterStream.Clusters,cluster_info) : ARRAYCOUNT(*Clusters,ebml_element*);
         // cues
-        if (ARRAYCOUNT(*Clusters,ebml_element*) < 2)
+        if (ClusterCount < 2)
         {
             NodeDelete((node*)RCues);
             RCues = NULL;
@@ -2782,13 +3217,22 @@ int main(int argc, const char *argv[])
                 EBML_ElementUpdateSize(RCues,0,0, DstProfile);
 		}
 
-		if (!RCues && WTrackInfo && ARRAYCOUNT(*Clusters,ebml_element*) > 1)
+		if (!RCues && WTrackInfo && ClusterCount > 1)
 		{
 			// generate the cues
 			RCues = (ebml_master*)EBML_ElementCreate(&p,MATROSKA_getContextCues(),0, DstProfile,NULL);
             EBML_MasterUseChecksum(RCues,!Unsafe);
 			if (!Quiet) TextWrite(StdErr,T("Generating Cues from scratch\r\n"));
-			CuesCreated = GenerateCueEntries(RCues,Clusters,WTrackInfo,WSegmentInfo,(ebml_element*)RSegment, TotalSize);
+			if (Streaming)
+			{
+                ClusterStream.WSegmentInfo = WSegmentInfo;
+                ClusterStream.WTrackInfo = WTrackInfo;
+				Result = StreamGenerateCueEntries(&ClusterStream,RCues,(ebml_element*)RSegment,ClustersNeedRead,TotalSize,&CuesCreated);
+				if (Result!=0)
+					goto exit;
+			}
+			else
+				CuesCreated = GenerateCueEntries(RCues,Clusters,WTrackInfo,WSegmentInfo,(ebml_element*)RSegment, TotalSize);
 			if (!CuesCreated)
 			{
 				NodeDelete((node*)RCues);
@@ -2816,13 +3260,18 @@ int main(int argc, const char *argv[])
             ExtraVoidSize += EXTRA_SEEK_SPACE;
 
         // first cluster
-        if (ARRAYCOUNT(RClusters,matroska_cluster*))
+        if (ClusterCount)
         {
+            if (Streaming)
+                // only its position is needed for the SeekHead
+                FirstCluster = EBML_ElementCreate(&p,MATROSKA_getContextCluster(),0, DstProfile,NULL);
+            else
+                FirstCluster = ARRAYBEGIN(*Clusters,ebml_element*)[0];
 			W1stClusterSeek = (matroska_seekpoint*)EBML_MasterAddElt(WMetaSeek,MATROSKA_getContextSeek(),0, DstProfile);
             EBML_MasterUseChecksum((ebml_master*)W1stClusterSeek,!Unsafe);
-			EBML_ElementForcePosition(ARRAYBEGIN(*Clusters,ebml_element*)[0], NextPos + ExtraVoidSize);
-			NextPos += EBML_ElementFullSize(ARRAYBEGIN(*Clusters,ebml_element*)[0],0);
-			MATROSKA_LinkMetaSeekElement(W1stClusterSeek,ARRAYBEGIN(*Clusters,ebml_element*)[0]);
+			EBML_ElementForcePosition(FirstCluster, NextPos + ExtraVoidSize);
+			NextPos += EBML_ElementFullSize(FirstCluster,0);
+			MATROSKA_LinkMetaSeekElement(W1stClusterSeek,FirstCluster);
         }
 
 		// first estimation of the MetaSeek size
@@ -2881,12 +3330,26 @@ int main(int argc, const char *argv[])
 		//  Compute the Cues size
 		if (WTrackInfo && RCues)
 		{
-            OptimizeCues(RCues,Clusters,WSegmentInfo,NextPos, WSegment, TotalSize, !CuesCreated, !Unsafe, ClustersNeedRead?Input:NULL);
+            if (Streaming)
+            {
+                StreamSettleClusters(&ClusterStream,NextPos,RCues,WSegment,!Unsafe);
+                EBML_ElementForcePosition(FirstCluster, ARRAYBEGIN(ClusterStream.Clusters,cluster_info)[0].Position);
+                Settled = 1;
+            }
+            else
+                OptimizeCues(RCues,Clusters,WSegmentInfo,NextPos, WSegment, TotalSize, !CuesCreated, !Unsafe, ClustersNeedRead?Input:NULL);
 			EBML_ElementForcePosition((ebml_element*)RCues, NextPos);
 			NextPos += EBML_ElementFullSize((ebml_element*)RCues,0);
 		}
-        else if (ARRAYCOUNT(*Clusters,ebml_element*)==1)
-            EBML_ElementForcePosition(ARRAYBEGIN(*Clusters,ebml_element*)[0], NextPos);
+        else if (ClusterCount==1)
+        {
+            EBML_ElementForcePosition(FirstCluster, NextPos);
+            if (Streaming)
+            {
+                ARRAYBEGIN(ClusterStream.Clusters,cluster_info)[0].Position = NextPos;
+                Settled = 1;
+            }
+        }
 
 		// update and write the MetaSeek and the elements following
         // write without the fake Tags pointer
@@ -2985,6 +3448,14 @@ int main(int argc, const char *argv[])
     PrevTimestamp = INVALID_TIMESTAMP_T;
     CuesChanged = 0;
     CurrentPhase = TotalPhases;
+    if (Streaming)
+    {
+        ClusterStream.WSegmentInfo = WSegmentInfo;
+        ClusterStream.WTrackInfo = WTrackInfo;
+        Result = StreamWriteClusters(&ClusterStream,Output,RCues,FirstCluster,Settled,&SegmentSize,&CuesChanged,TotalSize);
+        if (Result!=0)
+            goto exit;
+    }
     for (Cluster = ARRAYBEGIN(*Clusters,ebml_master*);Cluster != ARRAYEND(*Clusters,ebml_master*); ++Cluster)
     {
         ShowProgress((ebml_element*)*Cluster, TotalSize);
@@ -3000,7 +3471,8 @@ int main(int argc, const char *argv[])
         filepos_t PosBefore = Stream_Seek(Output,0,SEEK_CUR);
         Stream_Seek(Output,EBML_ElementPosition((ebml_element*)RCues),SEEK_SET);
 
-        UpdateCues(RCues, WSegment);
+        if (!Streaming) // the Cues are updated as the Clusters are written
+            UpdateCues(RCues, WSegment);
 
         if (EBML_ElementRender((ebml_element*)RCues,Output,0,0,1,DstProfile,&ClusterSize)!=ERR_NONE)
         {
@@ -3083,9 +3555,14 @@ exit:
     for (MaxTrackNum=0;MaxTrackNum<ARRAYCOUNT(TrackMaxHeader,array);++MaxTrackNum)
         ArrayClear(ARRAYBEGIN(TrackMaxHeader,array)+MaxTrackNum);
     ArrayClear(&Alternate3DTracks);
+    ArrayClear(&ClusterStream.Clusters);
+    ArrayClear(&ClusterStream.LacedTracks);
+    if (Streaming)
+        NodeDelete((node*)FirstCluster);
     ArrayClear(&TrackMaxHeader);
     ArrayClear(&WClusters);
     ArrayClear(&WTracks);
+    MATROSKA_TrackMapClear(&RTrackMap);
     NodeDelete((node*)RAttachments);
     NodeDelete((node*)RTags);
     NodeDelete((node*)RCues);
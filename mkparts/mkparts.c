@@ -32,7 +32,6 @@
 static textwriter *StdErr = NULL;
 static bool_t Split = 1;
 static bool_t Quiet = 0;
-static uint8_t Data[8*1024];
 
 // some macros for code readability
 #define EL_Pos(elt)         EBML_ElementPosition((const ebml_element*)elt)
@@ -40,6 +39,8 @@ static uint8_t Data[8*1024];
 #define EL_Type(elt, type)  EBML_ElementIsType((const ebml_element*)elt, type)
 #define EL_DataSize(elt)    EBML_ElementDataSize((const ebml_element*)elt, 1)
 
+#define COPY_SLICE          (16*1024*1024) // bytes copied per progress dot
+
 typedef struct track_info
 {
     int Num;
@@ -125,19 +126,18 @@ typedef struct {
 static void CopyTo(stream *Input, stream *Output, filepos_t StartPos, filepos_t Size)
 {
     filepos_t SizeToCopy = Size;
-    size_t readSize;
+    filepos_t Copied;
     err_t Err;
 
     Stream_Seek(Input, StartPos, SEEK_SET);
     while (SizeToCopy)
     {
-        Err = Stream_ReadOneOrMore(Input, Data, min(SizeToCopy, sizeof(Data)), &readSize);
-        if (Err==ERR_NONE || Err == ERR_NEED_MORE_DATA)
-        {
-            if (!Quiet) TextWrite(StdErr,T("."));
-            Stream_Write(Output, Data, readSize, NULL);
-            SizeToCopy -= readSize;
-        }
+        // the stream copies in the kernel when it can, slices only show the progress
+        Err = Stream_CopyTo(Input, Output, min(SizeToCopy, (filepos_t)COPY_SLICE), &Copied);
+        if (!Quiet) TextWrite(StdErr,T("."));
+        SizeToCopy -= Copied;
+        if (Err != ERR_NONE && Err != ERR_NEED_MORE_DATA)
+            break;
     }
     if (!Quiet) TextWrite(StdErr,T("\r\n"));
 }
@@ -157,7 +157,7 @@ int main(int argc, const char *argv[])
     array SegmentStarts;
 
     // Core-C init phase
-    ParserContext_Init(&p,NULL,NULL,NULL);
+    ParserContext_InitEx(&p,NULL,NULL,NULL,NODECONTEXT_SINGLE_THREAD);
     Node_SetData(&p.Base.Base.Base,NODECONTEXT_PROJECT_VENDOR,TYPE_STRING,"Matroska");
     Node_SetData(&p.Base.Base.Base,NODECONTEXT_PROJECT_VERSION,TYPE_STRING,PROJECT_VERSION);
     Node_SetData(&p.Base.Base.Base,NODECONTEXT_PROJECT_NAME,TYPE_STRING,PROJECT_NAME);
@@ -198,7 +198,7 @@ int main(int argc, const char *argv[])
     }
 
     Node_FromStr(&p,Path,TSIZEOF(Path),argv[argc-1]);
-    Input = StreamOpen(&p,Path,SFLAG_RDONLY/*|SFLAG_BUFFERED*/);
+    Input = StreamOpen(&p,Path,SFLAG_RDONLY|SFLAG_BUFFERED);
     if (!Input)
     {
         TextPrintf(StdErr,T("Could not open file \"%s\" for reading\r\n"),Path);
@@ -309,7 +309,7 @@ int main(int argc, const char *argv[])
             else
                 stcatprintf_s(OutPath,TSIZEOF(OutPath),T("%d.%s"),i,String);
 
-            Output = StreamOpen(&p,OutPath,SFLAG_WRONLY|SFLAG_CREATE);
+            Output = StreamOpen(&p,OutPath,SFLAG_WRONLY|SFLAG_CREATE|SFLAG_BUFFERED);
             if (!Output)
             {
                 Result = OutputError(5,T("Could not open file \"%s\" for writing\r\n"),OutPath);
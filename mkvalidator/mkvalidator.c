@@ -40,7 +40,8 @@
 
 static textwriter *StdErr = NULL;
 static ebml_master *RSegmentInfo = NULL, *RTrackInfo = NULL, *RChapters = NULL, *RTags = NULL, *RCues = NULL, *RAttachments = NULL, *RSeekHead = NULL, *RSeekHead2 = NULL;
-static array RClusters;
+static array RClusters; // only the ones not checked yet or still in the CRCPool with StreamClusters
+static array RClusterPos; // position of each Cluster, in file order
 static array Tracks;
 static size_t TrackMax=0;
 static bool_t Warnings = 1;
@@ -49,6 +50,17 @@ static bool_t Details = 0;
 static bool_t DivX = 0;
 static bool_t Quiet = 0;
 static bool_t QuickExit = 0;
+static bool_t LowMemory = 0;
+static bool_t StreamClusters = 0; // the Clusters are checked as they are read and not kept
+static bool_t BlocksIndexed = 0;
+static bool_t HasTrackMap = 0;
+static matroska_track_map TrackMap;
+static array StreamBlocks; // the Blocks of the streamed Clusters the Cues may point to
+static array CueTargets; // the entries of the Cues read before the streamed Clusters
+static bool_t CueTargetsRead = 0;
+static bool_t StreamBlocksComplete = 1;
+static ebml_crc_pool *CRCPool = NULL;
+static size_t CRCThreads = 0; // one per CPU
 static mkv_timestamp_t MinTime = INVALID_TIMESTAMP_T, MaxTime = INVALID_TIMESTAMP_T;
 static mkv_timestamp_t ClusterTime = INVALID_TIMESTAMP_T;
 
@@ -67,6 +79,14 @@ typedef struct track_info
 
 } track_info;
 
+typedef struct block_pos
+{
+    mkv_timestamp_t Timestamp;
+    filepos_t ClusterPos;
+    int16_t TrackNum;
+
+} block_pos;
+
 #ifdef TARGET_WIN
 #include <windows.h>
 void DebugMessage(const tchar_t* Msg,...)
@@ -446,6 +466,51 @@ static int CheckProfileViolation(ebml_element *Elt, int ProfileMask)
 	return Result;
 }
 
+// report the Clusters with a bad checksum in file order, once the pool checked them
+// Current is left to CheckProfileViolation() if it's already checked
+static int CheckClusterChecksums(const ebml_master *Current, bool_t Wait)
+{
+	int Result = 0;
+	tchar_t String[MAXPATH];
+    ebml_master *Cluster;
+
+    while (CRCPool && (Cluster = EBML_CRCPoolCollect(CRCPool, Wait)) != NULL)
+    {
+        if (Cluster != Current && !EBML_MasterIsChecksumValid(Cluster))
+        {
+            EBML_ElementGetName((ebml_element*)Cluster,String,TSIZEOF(String));
+            Result |= OutputError(0x203,T("Invalid checksum for element '%s' at %") TPRId64,String,EL_Pos(Cluster));
+        }
+    }
+	return Result;
+}
+
+static int FilePosCmp(const void* UNUSED_PARAM(Param), const filepos_t *a, const filepos_t *b)
+{
+	if (*a == *b)
+		return 0;
+	if (*a > *b)
+		return 1;
+	return -1;
+}
+
+// index of the Cluster starting at Pos, -1 if there's none
+static intptr_t FindClusterPos(filepos_t Pos)
+{
+    bool_t Found;
+    intptr_t Index = ArrayFind(&RClusterPos,filepos_t,&Pos,(arraycmp)FilePosCmp,NULL,&Found);
+    return Found ? Index : -1;
+}
+
+// the read Cluster starting at Pos, NULL if they are not kept
+static matroska_cluster *FindClusterAt(filepos_t Pos)
+{
+    intptr_t Index = FindClusterPos(Pos);
+    if (Index < 0 || StreamClusters)
+        return NULL;
+    return ARRAYBEGIN(RClusters,matroska_cluster*)[Index];
+}
+
 static int CheckSeekHead(ebml_master *SeekHead)
 {
 	int Result = 0;
@@ -525,13 +590,7 @@ static int CheckSeekHead(ebml_master *SeekHead)
 		}
 		else if (MATROSKA_MetaSeekIsClass(RLevel1, MATROSKA_getContextCluster()))
 		{
-			ebml_element **Cluster;
-			for (Cluster = ARRAYBEGIN(RClusters,ebml_element*);Cluster != ARRAYEND(RClusters,ebml_element*); ++Cluster)
-			{
-				if (EL_Pos(*Cluster) == Pos)
-					break;
-			}
-			if (Cluster == ARRAYEND(RClusters,ebml_element*) && Cluster != ARRAYBEGIN(RClusters,ebml_element*))
+			if (ARRAYCOUNT(RClusterPos,filepos_t) && FindClusterPos(Pos) < 0)
 				Result |= OutputError(0x71,T("The SeekPoint at %") TPRId64 T(" references a Cluster not found at %") TPRId64,EL_Pos(RLevel1),Pos);
 		}
 		else
@@ -558,273 +617,362 @@ static int CheckSeekHead(ebml_master *SeekHead)
 	return Result;
 }
 
-static void LinkClusterBlocks(int ProfileNum)
+static void BuildTrackMap(bool_t IndexBlocks)
 {
-	matroska_cluster **Cluster;
-	for (Cluster=ARRAYBEGIN(RClusters,matroska_cluster*);Cluster!=ARRAYEND(RClusters,matroska_cluster*);++Cluster)
-		MATROSKA_LinkClusterBlocks(*Cluster, RSegmentInfo, RTrackInfo, 1, ProfileNum);
+	HasTrackMap = RTrackInfo!=NULL && MATROSKA_TrackMapBuild(&TrackMap, RTrackInfo)==ERR_NONE;
+	BlocksIndexed = IndexBlocks && HasTrackMap;
 }
 
-static bool_t TrackIsLaced(int16_t TrackNum, int ProfileNum)
+static void LinkClusterBlocks(matroska_cluster *Cluster, int ProfileNum)
 {
-    ebml_element *TrackData;
-    ebml_master *Track = (ebml_master*)EBML_MasterFindChild(RTrackInfo, MATROSKA_getContextTrackEntry());
-    while (Track)
-    {
-        TrackData = EBML_MasterGetChild(Track, MATROSKA_getContextTrackNumber(), ProfileNum);
-        if (EL_Int(TrackData) == TrackNum)
-        {
-            TrackData = EBML_MasterGetChild(Track, MATROSKA_getContextFlagLacing(), ProfileNum);
-            return EL_Int(TrackData) != 0;
-        }
-        Track = (ebml_master*)EBML_MasterNextChild(RTrackInfo, Track);
-    }
-    return 1;
+    if (HasTrackMap)
+        MATROSKA_LinkClusterBlocksWithMap(Cluster, RSegmentInfo, &TrackMap, 1, ProfileNum);
+    else
+        MATROSKA_LinkClusterBlocks(Cluster, RSegmentInfo, RTrackInfo, 1, ProfileNum);
+    // index the Blocks for the Cues check
+    if (BlocksIndexed && MATROSKA_ClusterIndexBlocks(Cluster)!=ERR_NONE)
+        BlocksIndexed = 0;
 }
 
-static bool_t TrackIsVideo(int16_t TrackNum, int ProfileNum)
+static bool_t TrackIsLaced(int16_t TrackNum)
 {
-    ebml_element *TrackData;
-    ebml_master *Track = (ebml_master*)EBML_MasterFindChild(RTrackInfo, MATROSKA_getContextTrackEntry());
-    while (Track)
-    {
-        TrackData = EBML_MasterGetChild(Track, MATROSKA_getContextTrackNumber(), ProfileNum);
-        if (EL_Int(TrackData) == TrackNum)
-        {
-            TrackData = EBML_MasterGetChild(Track, MATROSKA_getContextTrackType(), ProfileNum);
-            return EL_Int(TrackData) == MATROSKA_TRACK_TYPE_VIDEO;
-        }
-        // look for TrackNum in the next Track
-        Track = (ebml_master*)EBML_MasterNextChild(RTrackInfo, Track);
-    }
-    return 0;
+    const matroska_track_info *Info = MATROSKA_TrackMapGet(&TrackMap, (uint16_t)TrackNum);
+    return Info ? Info->Lacing : 1;
 }
 
-static bool_t TrackNeedsKeyframe(int16_t TrackNum, int ProfileNum)
+static bool_t TrackIsVideo(int16_t TrackNum)
 {
-    ebml_element *TrackData;
-    ebml_master *Track = (ebml_master*)EBML_MasterFindChild(RTrackInfo, MATROSKA_getContextTrackEntry());
-    while (Track)
+    const matroska_track_info *Info = MATROSKA_TrackMapGet(&TrackMap, (uint16_t)TrackNum);
+    return Info && Info->TrackType == MATROSKA_TRACK_TYPE_VIDEO;
+}
+
+static bool_t TrackNeedsKeyframe(int16_t TrackNum)
+{
+    const matroska_track_info *Info = MATROSKA_TrackMapGet(&TrackMap, (uint16_t)TrackNum);
+    if (!Info)
+        return 0;
+    switch (Info->TrackType)
     {
-        TrackData = EBML_MasterGetChild(Track, MATROSKA_getContextTrackNumber(), ProfileNum);
-        if (EL_Int(TrackData) == TrackNum)
+    case MATROSKA_TRACK_TYPE_VIDEO:
+        return 0;
+    case MATROSKA_TRACK_TYPE_AUDIO:
         {
-            TrackData = EBML_MasterGetChild(Track, MATROSKA_getContextTrackType(), ProfileNum);
-            switch (EL_Int(TrackData))
-            {
-            case MATROSKA_TRACK_TYPE_VIDEO:
-                return 0;
-            case MATROSKA_TRACK_TYPE_AUDIO:
-                {
-                    tchar_t CodecName[MAXDATA];
-                    ebml_string *CodecID = (ebml_string*)EBML_MasterGetChild(Track, MATROSKA_getContextCodecID(), ProfileNum);
-                    EBML_StringGet(CodecID,CodecName,TSIZEOF(CodecName));
-                    return !tcsisame_ascii(CodecName,T("A_TRUEHD"));
-                }
-            default: return 1;
-            }
+            tchar_t CodecName[MAXDATA];
+            CodecName[0] = 0;
+            if (Info->CodecID)
+                EBML_StringGet(Info->CodecID,CodecName,TSIZEOF(CodecName));
+            return !tcsisame_ascii(CodecName,T("A_TRUEHD"));
         }
-        // look for TrackNum in the next Track
-        Track = (ebml_master*)EBML_MasterNextChild(RTrackInfo, Track);
+    default: return 1;
     }
-    return 0;
 }
 
-static int CheckVideoStart(int ProfileNum)
+static int CheckVideoStart(ebml_master *Cluster)
 {
 	int Result = 0;
-	ebml_master **Cluster;
     ebml_element *Block, *GBlock;
     int16_t BlockNum;
     mkv_timestamp_t ClusterTimestamp;
     array TrackKeyframe;
 	array TrackFirstKeyframePos;
 
-	for (Cluster=ARRAYBEGIN(RClusters,ebml_master*);Cluster!=ARRAYEND(RClusters,ebml_master*);++Cluster)
+    ArrayInit(&TrackKeyframe);
+    ArrayResize(&TrackKeyframe,sizeof(bool_t)*(TrackMax+1),256);
+    ArrayZero(&TrackKeyframe);
+    ArrayInit(&TrackFirstKeyframePos);
+    ArrayResize(&TrackFirstKeyframePos,sizeof(filepos_t)*(TrackMax+1),256);
+	ArrayZero(&TrackFirstKeyframePos);
+
+    ClusterTimestamp = MATROSKA_ClusterTimestamp((matroska_cluster*)Cluster);
+    if (ClusterTimestamp==INVALID_TIMESTAMP_T)
+        Result |= OutputError(0xC1,T("The Cluster at %") TPRId64 T(" has no timestamp"),EL_Pos(Cluster));
+    else if (ClusterTime!=INVALID_TIMESTAMP_T && ClusterTime >= ClusterTimestamp)
+		OutputWarning(0xC2,T("The timestamp of the Cluster at %") TPRId64 T(" is not incrementing (may be intentional)"),EL_Pos(Cluster));
+    ClusterTime = ClusterTimestamp;
+
+    for (Block = EBML_MasterChildren(Cluster);Block;Block=EBML_MasterNext(Block))
     {
-        ArrayInit(&TrackKeyframe);
-        ArrayResize(&TrackKeyframe,sizeof(bool_t)*(TrackMax+1),256);
-        ArrayZero(&TrackKeyframe);
-        ArrayInit(&TrackFirstKeyframePos);
-        ArrayResize(&TrackFirstKeyframePos,sizeof(filepos_t)*(TrackMax+1),256);
-		ArrayZero(&TrackFirstKeyframePos);
-
-        ClusterTimestamp = MATROSKA_ClusterTimestamp((matroska_cluster*)*Cluster);
-        if (ClusterTimestamp==INVALID_TIMESTAMP_T)
-            Result |= OutputError(0xC1,T("The Cluster at %") TPRId64 T(" has no timestamp"),EL_Pos(*Cluster));
-        else if (ClusterTime!=INVALID_TIMESTAMP_T && ClusterTime >= ClusterTimestamp)
-			OutputWarning(0xC2,T("The timestamp of the Cluster at %") TPRId64 T(" is not incrementing (may be intentional)"),EL_Pos(*Cluster));
-        ClusterTime = ClusterTimestamp;
-
-	    for (Block = EBML_MasterChildren(*Cluster);Block;Block=EBML_MasterNext(Block))
+	    if (EL_Type(Block, MATROSKA_getContextBlockGroup()))
 	    {
-		    if (EL_Type(Block, MATROSKA_getContextBlockGroup()))
+		    for (GBlock = EBML_MasterChildren(Block);GBlock;GBlock=EBML_MasterNext(GBlock))
 		    {
-			    for (GBlock = EBML_MasterChildren(Block);GBlock;GBlock=EBML_MasterNext(GBlock))
+			    if (EL_Type(GBlock, MATROSKA_getContextBlock()))
 			    {
-				    if (EL_Type(GBlock, MATROSKA_getContextBlock()))
-				    {
-                        BlockNum = MATROSKA_BlockTrackNum((matroska_block*)GBlock);
-						if (BlockNum > ARRAYCOUNT(TrackKeyframe,bool_t))
-							OutputError(0xC3,T("Unknown track #%d in Cluster at %") TPRId64 T(" in Block at %") TPRId64,(int)BlockNum,EL_Pos(*Cluster),EL_Pos(GBlock));
-                        else if (TrackIsVideo(BlockNum, ProfileNum))
-						{
-							if (!ARRAYBEGIN(TrackKeyframe,bool_t)[BlockNum] && MATROSKA_BlockKeyframe((matroska_block*)GBlock))
-								ARRAYBEGIN(TrackKeyframe,bool_t)[BlockNum] = 1;
-							if (!ARRAYBEGIN(TrackKeyframe,bool_t)[BlockNum] && ARRAYBEGIN(TrackFirstKeyframePos,filepos_t)[BlockNum]==0)
-								ARRAYBEGIN(TrackFirstKeyframePos,filepos_t)[BlockNum] = EL_Pos(*Cluster);
-                        }
-					    break;
-				    }
+                    BlockNum = MATROSKA_BlockTrackNum((matroska_block*)GBlock);
+					if (BlockNum > ARRAYCOUNT(TrackKeyframe,bool_t))
+						OutputError(0xC3,T("Unknown track #%d in Cluster at %") TPRId64 T(" in Block at %") TPRId64,(int)BlockNum,EL_Pos(Cluster),EL_Pos(GBlock));
+                    else if (TrackIsVideo(BlockNum))
+					{
+						if (!ARRAYBEGIN(TrackKeyframe,bool_t)[BlockNum] && MATROSKA_BlockKeyframe((matroska_block*)GBlock))
+							ARRAYBEGIN(TrackKeyframe,bool_t)[BlockNum] = 1;
+						if (!ARRAYBEGIN(TrackKeyframe,bool_t)[BlockNum] && ARRAYBEGIN(TrackFirstKeyframePos,filepos_t)[BlockNum]==0)
+							ARRAYBEGIN(TrackFirstKeyframePos,filepos_t)[BlockNum] = EL_Pos(Cluster);
+                    }
+				    break;
 			    }
 		    }
-		    else if (EL_Type(Block, MATROSKA_getContextSimpleBlock()))
-		    {
-                BlockNum = MATROSKA_BlockTrackNum((matroska_block*)Block);
-				if (BlockNum > ARRAYCOUNT(TrackKeyframe,bool_t))
-                    OutputError(0xC3,T("Unknown track #%d in Cluster at %") TPRId64 T(" in SimpleBlock at %") TPRId64,(int)BlockNum,EL_Pos(*Cluster),EL_Pos(Block));
-                else if (TrackIsVideo(BlockNum, ProfileNum))
-				{
-					if (!ARRAYBEGIN(TrackKeyframe,bool_t)[BlockNum] && MATROSKA_BlockKeyframe((matroska_block*)Block))
-						ARRAYBEGIN(TrackKeyframe,bool_t)[BlockNum] = 1;
-					if (!ARRAYBEGIN(TrackKeyframe,bool_t)[BlockNum] && ARRAYBEGIN(TrackFirstKeyframePos,filepos_t)[BlockNum]==0)
-						ARRAYBEGIN(TrackFirstKeyframePos,filepos_t)[BlockNum] = EL_Pos(*Cluster);
-                }
-		    }
 	    }
-		for (BlockNum=0;BlockNum<ARRAYCOUNT(TrackKeyframe,bool_t);++BlockNum)
-		{
-			if (ARRAYBEGIN(TrackKeyframe,bool_t)[BlockNum] && ARRAYBEGIN(TrackFirstKeyframePos,filepos_t)[BlockNum]!=0)
-				OutputWarning(0xC0,T("First Block for video track #%d in Cluster at %") TPRId64 T(" is not a keyframe"),(int)BlockNum,ARRAYBEGIN(TrackFirstKeyframePos,filepos_t)[BlockNum]);
-		}
-        ArrayClear(&TrackKeyframe);
-        ArrayClear(&TrackFirstKeyframePos);
+	    else if (EL_Type(Block, MATROSKA_getContextSimpleBlock()))
+	    {
+            BlockNum = MATROSKA_BlockTrackNum((matroska_block*)Block);
+			if (BlockNum > ARRAYCOUNT(TrackKeyframe,bool_t))
+                OutputError(0xC3,T("Unknown track #%d in Cluster at %") TPRId64 T(" in SimpleBlock at %") TPRId64,(int)BlockNum,EL_Pos(Cluster),EL_Pos(Block));
+            else if (TrackIsVideo(BlockNum))
+			{
+				if (!ARRAYBEGIN(TrackKeyframe,bool_t)[BlockNum] && MATROSKA_BlockKeyframe((matroska_block*)Block))
+					ARRAYBEGIN(TrackKeyframe,bool_t)[BlockNum] = 1;
+				if (!ARRAYBEGIN(TrackKeyframe,bool_t)[BlockNum] && ARRAYBEGIN(TrackFirstKeyframePos,filepos_t)[BlockNum]==0)
+					ARRAYBEGIN(TrackFirstKeyframePos,filepos_t)[BlockNum] = EL_Pos(Cluster);
+            }
+	    }
     }
+	for (BlockNum=0;BlockNum<ARRAYCOUNT(TrackKeyframe,bool_t);++BlockNum)
+	{
+		if (ARRAYBEGIN(TrackKeyframe,bool_t)[BlockNum] && ARRAYBEGIN(TrackFirstKeyframePos,filepos_t)[BlockNum]!=0)
+			OutputWarning(0xC0,T("First Block for video track #%d in Cluster at %") TPRId64 T(" is not a keyframe"),(int)BlockNum,ARRAYBEGIN(TrackFirstKeyframePos,filepos_t)[BlockNum]);
+	}
+    ArrayClear(&TrackKeyframe);
+    ArrayClear(&TrackFirstKeyframePos);
 	return Result;
 }
 
-static int CheckPosSize(const ebml_element *RSegment)
+static int CheckPosSize(const ebml_element *RSegment, ebml_element *Cluster, filepos_t PrevPos)
 {
 	int Result = 0;
-	ebml_element **Cluster,*PrevCluster=NULL;
     ebml_element *Elt;
 
-	for (Cluster=ARRAYBEGIN(RClusters,ebml_element*);Cluster!=ARRAYEND(RClusters,ebml_element*);++Cluster)
+    Elt = EBML_MasterFindChild((ebml_master*)Cluster,MATROSKA_getContextPrevSize());
+    if (Elt)
     {
-        Elt = EBML_MasterFindChild((ebml_master*)*Cluster,MATROSKA_getContextPrevSize());
-        if (Elt)
-        {
-            if (PrevCluster==NULL)
-                Result |= OutputError(0xA0,T("The PrevSize %") TPRId64 T(" was set on the first Cluster at %") TPRId64,EL_Int(Elt),EL_Pos(Elt));
-            else if (EL_Int(Elt) != EL_Pos(*Cluster) - EL_Pos(PrevCluster))
-                Result |= OutputError(0xA1,T("The Cluster PrevSize %") TPRId64 T(" at %") TPRId64 T(" should be %") TPRId64,EL_Int(Elt),EL_Pos(Elt),EL_Pos(*Cluster) - EL_Pos(PrevCluster));
-        }
-        Elt = EBML_MasterFindChild((ebml_master*)*Cluster,MATROSKA_getContextPosition());
-        if (Elt)
-        {
-            if (EL_Int(Elt) != EL_Pos(*Cluster) - EBML_ElementPositionData(RSegment))
-                Result |= OutputError(0xA2,T("The Cluster position %") TPRId64 T(" at %") TPRId64 T(" should be %") TPRId64,EL_Int(Elt),EL_Pos(Elt),EL_Pos(*Cluster) - EBML_ElementPositionData(RSegment));
-        }
-        PrevCluster = *Cluster;
+        if (PrevPos==INVALID_FILEPOS_T)
+            Result |= OutputError(0xA0,T("The PrevSize %") TPRId64 T(" was set on the first Cluster at %") TPRId64,EL_Int(Elt),EL_Pos(Elt));
+        else if (EL_Int(Elt) != EL_Pos(Cluster) - PrevPos)
+            Result |= OutputError(0xA1,T("The Cluster PrevSize %") TPRId64 T(" at %") TPRId64 T(" should be %") TPRId64,EL_Int(Elt),EL_Pos(Elt),EL_Pos(Cluster) - PrevPos);
+    }
+    Elt = EBML_MasterFindChild((ebml_master*)Cluster,MATROSKA_getContextPosition());
+    if (Elt)
+    {
+        if (EL_Int(Elt) != EL_Pos(Cluster) - EBML_ElementPositionData(RSegment))
+            Result |= OutputError(0xA2,T("The Cluster position %") TPRId64 T(" at %") TPRId64 T(" should be %") TPRId64,EL_Int(Elt),EL_Pos(Elt),EL_Pos(Cluster) - EBML_ElementPositionData(RSegment));
     }
 	return Result;
 }
 
-static int CheckLacingKeyframe(int ProfileNum)
+static int CheckLacingKeyframe(matroska_cluster *Cluster)
 {
 	int Result = 0;
-	matroska_cluster **Cluster;
     ebml_element *Block, *GBlock;
     int16_t BlockNum;
     mkv_timestamp_t BlockTime;
     size_t Frame,TrackIdx;
 
-	for (Cluster=ARRAYBEGIN(RClusters,matroska_cluster*);Cluster!=ARRAYEND(RClusters,matroska_cluster*);++Cluster)
+    for (Block = EBML_MasterChildren(Cluster);Block;Block=EBML_MasterNext(Block))
     {
-	    for (Block = EBML_MasterChildren(*Cluster);Block;Block=EBML_MasterNext(Block))
+	    if (EL_Type(Block, MATROSKA_getContextBlockGroup()))
 	    {
-		    if (EL_Type(Block, MATROSKA_getContextBlockGroup()))
+		    for (GBlock = EBML_MasterChildren(Block);GBlock;GBlock=EBML_MasterNext(GBlock))
 		    {
-			    for (GBlock = EBML_MasterChildren(Block);GBlock;GBlock=EBML_MasterNext(GBlock))
+			    if (EL_Type(GBlock, MATROSKA_getContextBlock()))
 			    {
-				    if (EL_Type(GBlock, MATROSKA_getContextBlock()))
-				    {
-                        //MATROSKA_ContextFlagLacing
-                        BlockNum = MATROSKA_BlockTrackNum((matroska_block*)GBlock);
-                        for (TrackIdx=0; TrackIdx<ARRAYCOUNT(Tracks,track_info); ++TrackIdx)
-                            if (ARRAYBEGIN(Tracks,track_info)[TrackIdx].Num == BlockNum)
-                                break;
-                        
-                        if (TrackIdx==ARRAYCOUNT(Tracks,track_info))
-                            Result |= OutputError(0xB2,T("Block at %") TPRId64 T(" is using an unknown track #%d"),EL_Pos(GBlock),(int)BlockNum);
-                        else
+                    //MATROSKA_ContextFlagLacing
+                    BlockNum = MATROSKA_BlockTrackNum((matroska_block*)GBlock);
+                    for (TrackIdx=0; TrackIdx<ARRAYCOUNT(Tracks,track_info); ++TrackIdx)
+                        if (ARRAYBEGIN(Tracks,track_info)[TrackIdx].Num == BlockNum)
+                            break;
+                    
+                    if (TrackIdx==ARRAYCOUNT(Tracks,track_info))
+                        Result |= OutputError(0xB2,T("Block at %") TPRId64 T(" is using an unknown track #%d"),EL_Pos(GBlock),(int)BlockNum);
+                    else
+                    {
+                        if (MATROSKA_BlockLaced((matroska_block*)GBlock) && !TrackIsLaced(BlockNum))
+                            Result |= OutputError(0xB0,T("Block at %") TPRId64 T(" track #%d is laced but the track is not"),EL_Pos(GBlock),(int)BlockNum);
+                        if (!MATROSKA_BlockKeyframe((matroska_block*)GBlock) && TrackNeedsKeyframe(BlockNum))
+                            Result |= OutputError(0xB1,T("Block at %") TPRId64 T(" track #%d is not a keyframe"),EL_Pos(GBlock),(int)BlockNum);
+
+                        for (Frame=0; Frame<MATROSKA_BlockGetFrameCount((matroska_block*)GBlock); ++Frame)
+                            ARRAYBEGIN(Tracks,track_info)[TrackIdx].DataLength += MATROSKA_BlockGetLength((matroska_block*)GBlock,Frame);
+                        if (Details)
                         {
-                            if (MATROSKA_BlockLaced((matroska_block*)GBlock) && !TrackIsLaced(BlockNum, ProfileNum))
-                                Result |= OutputError(0xB0,T("Block at %") TPRId64 T(" track #%d is laced but the track is not"),EL_Pos(GBlock),(int)BlockNum);
-                            if (!MATROSKA_BlockKeyframe((matroska_block*)GBlock) && TrackNeedsKeyframe(BlockNum, ProfileNum))
-                                Result |= OutputError(0xB1,T("Block at %") TPRId64 T(" track #%d is not a keyframe"),EL_Pos(GBlock),(int)BlockNum);
-
-                            for (Frame=0; Frame<MATROSKA_BlockGetFrameCount((matroska_block*)GBlock); ++Frame)
-                                ARRAYBEGIN(Tracks,track_info)[TrackIdx].DataLength += MATROSKA_BlockGetLength((matroska_block*)GBlock,Frame);
-                            if (Details)
-                            {
-                                BlockTime = MATROSKA_BlockTimestamp((matroska_block*)GBlock);
-                                if (MinTime==INVALID_TIMESTAMP_T || MinTime>BlockTime)
-                                    MinTime = BlockTime;
-                                if (MaxTime==INVALID_TIMESTAMP_T || MaxTime<BlockTime)
-                                    MaxTime = BlockTime;
-                            }
+                            BlockTime = MATROSKA_BlockTimestamp((matroska_block*)GBlock);
+                            if (MinTime==INVALID_TIMESTAMP_T || MinTime>BlockTime)
+                                MinTime = BlockTime;
+                            if (MaxTime==INVALID_TIMESTAMP_T || MaxTime<BlockTime)
+                                MaxTime = BlockTime;
                         }
-					    break;
-				    }
+                    }
+				    break;
 			    }
 		    }
-		    else if (EL_Type(Block, MATROSKA_getContextSimpleBlock()))
-		    {
-                BlockNum = MATROSKA_BlockTrackNum((matroska_block*)Block);
-                for (TrackIdx=0; TrackIdx<ARRAYCOUNT(Tracks,track_info); ++TrackIdx)
-                    if (ARRAYBEGIN(Tracks,track_info)[TrackIdx].Num == BlockNum)
-                        break;
-                
-                if (TrackIdx==ARRAYCOUNT(Tracks,track_info))
-                    Result |= OutputError(0xB2,T("Block at %") TPRId64 T(" is using an unknown track #%d"),EL_Pos(Block),(int)BlockNum);
-                else
+	    }
+	    else if (EL_Type(Block, MATROSKA_getContextSimpleBlock()))
+	    {
+            BlockNum = MATROSKA_BlockTrackNum((matroska_block*)Block);
+            for (TrackIdx=0; TrackIdx<ARRAYCOUNT(Tracks,track_info); ++TrackIdx)
+                if (ARRAYBEGIN(Tracks,track_info)[TrackIdx].Num == BlockNum)
+                    break;
+            
+            if (TrackIdx==ARRAYCOUNT(Tracks,track_info))
+                Result |= OutputError(0xB2,T("Block at %") TPRId64 T(" is using an unknown track #%d"),EL_Pos(Block),(int)BlockNum);
+            else
+            {
+                if (MATROSKA_BlockLaced((matroska_block*)Block) && !TrackIsLaced(BlockNum))
+                    Result |= OutputError(0xB0,T("SimpleBlock at %") TPRId64 T(" track #%d is laced but the track is not"),EL_Pos(Block),(int)BlockNum);
+                if (!MATROSKA_BlockKeyframe((matroska_block*)Block) && TrackNeedsKeyframe(BlockNum))
+                    Result |= OutputError(0xB1,T("SimpleBlock at %") TPRId64 T(" track #%d is not a keyframe"),EL_Pos(Block),(int)BlockNum);
+                for (Frame=0; Frame<MATROSKA_BlockGetFrameCount((matroska_block*)Block); ++Frame)
+                    ARRAYBEGIN(Tracks,track_info)[TrackIdx].DataLength += MATROSKA_BlockGetLength((matroska_block*)Block,Frame);
+                if (Details)
                 {
-                    if (MATROSKA_BlockLaced((matroska_block*)Block) && !TrackIsLaced(BlockNum, ProfileNum))
-                        Result |= OutputError(0xB0,T("SimpleBlock at %") TPRId64 T(" track #%d is laced but the track is not"),EL_Pos(Block),(int)BlockNum);
-                    if (!MATROSKA_BlockKeyframe((matroska_block*)Block) && TrackNeedsKeyframe(BlockNum, ProfileNum))
-                        Result |= OutputError(0xB1,T("SimpleBlock at %") TPRId64 T(" track #%d is not a keyframe"),EL_Pos(Block),(int)BlockNum);
-                    for (Frame=0; Frame<MATROSKA_BlockGetFrameCount((matroska_block*)Block); ++Frame)
-                        ARRAYBEGIN(Tracks,track_info)[TrackIdx].DataLength += MATROSKA_BlockGetLength((matroska_block*)Block,Frame);
-                    if (Details)
-                    {
-                        BlockTime = MATROSKA_BlockTimestamp((matroska_block*)Block);
-                        if (MinTime==INVALID_TIMESTAMP_T || MinTime>BlockTime)
-                            MinTime = BlockTime;
-                        if (MaxTime==INVALID_TIMESTAMP_T || MaxTime<BlockTime)
-                            MaxTime = BlockTime;
-                    }
+                    BlockTime = MATROSKA_BlockTimestamp((matroska_block*)Block);
+                    if (MinTime==INVALID_TIMESTAMP_T || MinTime>BlockTime)
+                        MinTime = BlockTime;
+                    if (MaxTime==INVALID_TIMESTAMP_T || MaxTime<BlockTime)
+                        MaxTime = BlockTime;
                 }
-		    }
+            }
+	    }
+    }
+	return Result;
+}
+
+// delete the checked Clusters before Current once the CRCPool doesn't use them anymore
+static void ReleaseStreamedClusters(const ebml_master *Current)
+{
+    ebml_master **Cluster, **Kept = ARRAYBEGIN(RClusters,ebml_master*);
+
+    for (Cluster = ARRAYBEGIN(RClusters,ebml_master*);Cluster != ARRAYEND(RClusters,ebml_master*); ++Cluster)
+    {
+        if (*Cluster != Current && !EBML_MasterIsChecksumPending(*Cluster))
+            NodeDelete((node*)*Cluster);
+        else
+            *Kept++ = *Cluster;
+    }
+    ArrayShrink(&RClusters,(ARRAYEND(RClusters,ebml_master*) - Kept)*sizeof(ebml_master*));
+}
+
+static int CueTargetCmp(const void* UNUSED_PARAM(Param), const block_pos *a, const block_pos *b)
+{
+    if (a->TrackNum != b->TrackNum)
+        return a->TrackNum < b->TrackNum ? -1 : 1;
+    if (a->Timestamp != b->Timestamp)
+        return a->Timestamp < b->Timestamp ? -1 : 1;
+    return 0;
+}
+
+static int BlockPosCmp(const void* Param, const block_pos *a, const block_pos *b)
+{
+    int Result = CueTargetCmp(Param, a, b);
+    if (Result == 0 && a->ClusterPos != b->ClusterPos)
+        return a->ClusterPos < b->ClusterPos ? -1 : 1;
+    return Result;
+}
+
+// ArraySort() falls back to an insertion sort for structures, too slow for all the Blocks of a file
+static int SortCueTarget(const void *a, const void *b)
+{
+    return CueTargetCmp(NULL, (const block_pos*)a, (const block_pos*)b);
+}
+
+static int SortBlockPos(const void *a, const void *b)
+{
+    return BlockPosCmp(NULL, (const block_pos*)a, (const block_pos*)b);
+}
+
+// only the Blocks matching these Cues entries need to be kept
+static void ReadCueTargets(void)
+{
+    matroska_cuepoint *CuePoint;
+    block_pos Target;
+
+    Target.ClusterPos = INVALID_FILEPOS_T;
+    for (CuePoint = (matroska_cuepoint*)EBML_MasterFindChild(RCues, MATROSKA_getContextCuePoint()); CuePoint; CuePoint = (matroska_cuepoint*)EBML_MasterNextChild(RCues, CuePoint))
+    {
+        MATROSKA_LinkCueSegmentInfo(CuePoint,RSegmentInfo);
+        Target.Timestamp = MATROSKA_CueTimestamp(CuePoint);
+        Target.TrackNum = MATROSKA_CueTrackNum(CuePoint);
+        if (!ArrayAppend(&CueTargets,&Target,sizeof(Target),256))
+            return; // keep all the Blocks
+    }
+    qsort(ARRAYBEGIN(CueTargets,block_pos),ARRAYCOUNT(CueTargets,block_pos),sizeof(block_pos),SortCueTarget);
+    CueTargetsRead = 1;
+}
+
+static void RecordStreamedBlock(matroska_block *Block, filepos_t ClusterPos)
+{
+    block_pos BlockPos;
+    bool_t Found;
+
+    BlockPos.Timestamp = MATROSKA_BlockTimestamp(Block);
+    BlockPos.ClusterPos = ClusterPos;
+    BlockPos.TrackNum = MATROSKA_BlockTrackNum(Block);
+    if (CueTargetsRead)
+    {
+        ArrayFind(&CueTargets,block_pos,&BlockPos,(arraycmp)CueTargetCmp,NULL,&Found);
+        if (!Found)
+            return;
+    }
+    if (!ArrayAppend(&StreamBlocks,&BlockPos,sizeof(BlockPos),4096))
+        StreamBlocksComplete = 0;
+}
+
+// keep the track and timestamp of the Blocks for the Cues check
+static void RecordStreamedBlocks(matroska_cluster *Cluster)
+{
+    ebml_element *Block, *GBlock;
+
+    for (Block = EBML_MasterChildren(Cluster);Block;Block=EBML_MasterNext(Block))
+    {
+	    if (EL_Type(Block, MATROSKA_getContextBlockGroup()))
+	    {
+		    for (GBlock = EBML_MasterChildren(Block);GBlock;GBlock=EBML_MasterNext(GBlock))
+			    if (EL_Type(GBlock, MATROSKA_getContextBlock()))
+                    RecordStreamedBlock((matroska_block*)GBlock, EL_Pos(Cluster));
 	    }
+	    else if (EL_Type(Block, MATROSKA_getContextSimpleBlock()))
+            RecordStreamedBlock((matroska_block*)Block, EL_Pos(Cluster));
     }
+}
+
+// check a Cluster as soon as it's read, only its position is kept
+static int CheckStreamedCluster(matroska_cluster *Cluster, const ebml_element *RSegment, int ProfileNum, bool_t HasVideo)
+{
+	int Result = 0;
+    filepos_t PrevPos = INVALID_FILEPOS_T;
+
+    ReleaseStreamedClusters((ebml_master*)Cluster);
+    if (ARRAYCOUNT(RClusterPos,filepos_t) > 1)
+        PrevPos = ARRAYEND(RClusterPos,filepos_t)[-2];
+    LinkClusterBlocks(Cluster, ProfileNum);
+    if (HasVideo)
+        Result |= CheckVideoStart((ebml_master*)Cluster);
+    Result |= CheckLacingKeyframe(Cluster);
+    Result |= CheckPosSize(RSegment, (ebml_element*)Cluster, PrevPos);
+    RecordStreamedBlocks(Cluster);
+    EBML_MasterErase((ebml_master*)Cluster);
 	return Result;
 }
 
-static int CheckCueEntries(ebml_master *Cues)
+static int CheckCueEntries(ebml_master *Cues, const ebml_element *RSegment)
 {
 	int Result = 0;
 	mkv_timestamp_t TimestampEntry, PrevTimestamp = INVALID_TIMESTAMP_T;
 	int16_t TrackNumEntry;
-	matroska_cluster **Cluster;
+	matroska_cluster **Cluster, *CueCluster;
+	filepos_t ClusterPos;
+	bool_t Found, InOtherCluster;
 	matroska_block *Block;
+	const matroska_track_info *Track;
+	block_pos CueBlock;
     int ClustNum = 0;
+    int Unchecked = 0;
 
 	if (!RSegmentInfo)
 		Result |= OutputError(0x310,T("A Cues (index) is defined but no SegmentInfo was found"));
-	else if (ARRAYCOUNT(RClusters,matroska_cluster*))
+	else if (ARRAYCOUNT(RClusterPos,filepos_t))
 	{
 		matroska_cuepoint *CuePoint = (matroska_cuepoint*)EBML_MasterFindChild(Cues, MATROSKA_getContextCuePoint());
+		if (StreamClusters)
+			qsort(ARRAYBEGIN(StreamBlocks,block_pos),ARRAYCOUNT(StreamBlocks,block_pos),sizeof(block_pos),SortBlockPos);
 		while (CuePoint)
 		{
             if (!Quiet && ClustNum++ % 24 == 0)
@@ -836,18 +984,61 @@ static int CheckCueEntries(ebml_master *Cues)
 			if (TimestampEntry < PrevTimestamp && PrevTimestamp != INVALID_TIMESTAMP_T)
 				OutputWarning(0x311,T("The Cues entry for timestamp %") TPRId64 T(" ms is listed after entry %") TPRId64 T(" ms"),Scale64(TimestampEntry,1,1000000),Scale64(PrevTimestamp,1,1000000));
 
-			// find a matching Block
-			for (Cluster = ARRAYBEGIN(RClusters,matroska_cluster*);Cluster != ARRAYEND(RClusters,matroska_cluster*); ++Cluster)
+			// look for the Block in the Cluster the entry points to, then anywhere else
+			ClusterPos = MATROSKA_CuePosInSegment(CuePoint);
+			if (ClusterPos != INVALID_FILEPOS_T)
+				ClusterPos += EBML_ElementPositionData(RSegment);
+			if (StreamClusters)
 			{
-				Block = MATROSKA_GetBlockForTimestamp(*Cluster, TimestampEntry, TrackNumEntry);
-				if (Block)
-					break;
+				CueBlock.Timestamp = TimestampEntry;
+				CueBlock.ClusterPos = ClusterPos;
+				CueBlock.TrackNum = TrackNumEntry;
+				ArrayFind(&StreamBlocks,block_pos,&CueBlock,(arraycmp)BlockPosCmp,NULL,&Found);
+				InOtherCluster = 0;
+				if (!Found)
+				{
+					ArrayFind(&StreamBlocks,block_pos,&CueBlock,(arraycmp)CueTargetCmp,NULL,&InOtherCluster);
+					if (ClusterPos == INVALID_FILEPOS_T)
+					{
+						Found = InOtherCluster; // no position to check against
+						InOtherCluster = 0;
+					}
+				}
+			}
+			else
+			{
+				// only the keyframes are indexed, the other Blocks are found in the Clusters
+				Track = BlocksIndexed && TrackNumEntry>0 && TimestampEntry!=INVALID_TIMESTAMP_T ? MATROSKA_TrackMapGet(&TrackMap, (uint16_t)TrackNumEntry) : NULL;
+				Found = Track && MATROSKA_TrackFindBlock((matroska_trackentry*)Track->TrackEntry, TimestampEntry, ClusterPos);
+				if (!Found)
+				{
+					CueCluster = ClusterPos != INVALID_FILEPOS_T ? FindClusterAt(ClusterPos) : NULL;
+					Found = CueCluster && MATROSKA_GetBlockForTimestamp(CueCluster, TimestampEntry, TrackNumEntry);
+				}
+				InOtherCluster = Track && !Found && MATROSKA_TrackFindBlock((matroska_trackentry*)Track->TrackEntry, TimestampEntry, INVALID_FILEPOS_T);
+				for (Cluster = ARRAYBEGIN(RClusters,matroska_cluster*);!Found && !InOtherCluster && Cluster != ARRAYEND(RClusters,matroska_cluster*); ++Cluster)
+				{
+					Block = MATROSKA_GetBlockForTimestamp(*Cluster, TimestampEntry, TrackNumEntry);
+					if (Block)
+					{
+						if (ClusterPos == INVALID_FILEPOS_T)
+							Found = 1; // no position to check against
+						else
+							InOtherCluster = 1;
+					}
+				}
 			}
-			if (Cluster == ARRAYEND(RClusters,matroska_cluster*))
+			if (!Found && !InOtherCluster && !StreamBlocksComplete)
+				++Unchecked; // the Block may be one that could not be kept
+			else if (InOtherCluster)
+				Result |= OutputError(0x313,T("CueEntry Track #%d and timestamp %") TPRId64 T(" ms is not in the Cluster at %") TPRId64,(int)TrackNumEntry,Scale64(TimestampEntry,1,1000000),ClusterPos);
+			else if (!Found)
 				Result |= OutputError(0x312,T("CueEntry Track #%d and timestamp %") TPRId64 T(" ms not found"),(int)TrackNumEntry,Scale64(TimestampEntry,1,1000000));
 			PrevTimestamp = TimestampEntry;
 			CuePoint = (matroska_cuepoint*)EBML_MasterNextChild(Cues, CuePoint);
 		}
+		if (Unchecked)
+			OutputWarning(0x314,T("%d Cues entries could not be checked, not all the Blocks could be kept (--low-memory)"),Unchecked);
 	}
 	return Result;
 }
@@ -876,10 +1067,10 @@ int main(int argc, const char *argv[])
     bool_t HasVideo = 0;
 	int DotCount;
     track_info *TI;
-	filepos_t VoidAmount = 0;
+	filepos_t VoidAmount = 0, Pos;
 
     // Core-C init phase
-    ParserContext_Init(&p,NULL,NULL,NULL);
+    ParserContext_InitEx(&p,NULL,NULL,NULL,NODECONTEXT_SINGLE_THREAD);
 	Node_SetData(&p.Base.Base.Base,NODECONTEXT_PROJECT_VENDOR,TYPE_STRING,"Matroska");
 	Node_SetData(&p.Base.Base.Base,NODECONTEXT_PROJECT_VERSION,TYPE_STRING,PROJECT_VERSION);
 	Node_SetData(&p.Base.Base.Base,NODECONTEXT_PROJECT_NAME,TYPE_STRING,PROJECT_NAME);
@@ -888,6 +1079,9 @@ int main(int argc, const char *argv[])
     MATROSKA_Init(&p);
 
     ArrayInit(&RClusters);
+    ArrayInit(&RClusterPos);
+    ArrayInit(&StreamBlocks);
+    ArrayInit(&CueTargets);
     ArrayInit(&Tracks);
 
     StdErr = &_StdErr;
@@ -909,6 +1103,16 @@ int main(int argc, const char *argv[])
 		else if (tcsisame_ascii(Path,T("--version"))) ShowVersion = 1;
 		else if (tcsisame_ascii(Path,T("--quiet"))) Quiet = 1;
         else if (tcsisame_ascii(Path,T("--quick"))) QuickExit = 1;
+        else if (tcsisame_ascii(Path,T("--low-memory"))) LowMemory = 1;
+		else if (tcsisame_ascii(Path,T("--threads")) && i+1<argc-1)
+		{
+#if defined(TARGET_WIN) && defined(UNICODE)
+		    Node_FromWcs(&p,Path,TSIZEOF(Path),argv[++i]);
+#else
+		    Node_FromStr(&p,Path,TSIZEOF(Path),argv[++i]);
+#endif
+			CRCThreads = StringToInt(Path,0);
+		}
         else if (tcsisame_ascii(Path,T("--help"))) {ShowVersion = 1; ShowUsage = 1;}
 		else if (i<argc-1) TextPrintf(StdErr,T("Unknown parameter '%s'\r\n"),Path);
 	}
@@ -926,6 +1130,10 @@ int main(int argc, const char *argv[])
             TextWrite(StdErr,T("  --divx      assume the file is using DivX specific extensions\r\n"));
             TextWrite(StdErr,T("  --quick     exit after the first error or warning\r\n"));
             TextWrite(StdErr,T("  --quiet     don't ouput progress and file info\r\n"));
+            TextWrite(StdErr,T("  --low-memory check the Clusters as they are read and don't keep them\r\n"));
+#if defined(CONFIG_MULTITHREAD)
+            TextWrite(StdErr,T("  --threads <n> number of threads checking the Cluster CRCs (default: one per CPU)\r\n"));
+#endif
             TextWrite(StdErr,T("  --version   show the version of ") PROJECT_NAME T("\r\n"));
             TextWrite(StdErr,T("  --help      show this screen\r\n"));
         }
@@ -937,13 +1145,15 @@ int main(int argc, const char *argv[])
 #else
 	Node_FromStr(&p,Path,TSIZEOF(Path),argv[argc-1]);
 #endif
-    Input = StreamOpen(&p,Path,SFLAG_RDONLY/*|SFLAG_BUFFERED*/);
+    // the mapped pages of the whole file would count as used memory
+    Input = StreamOpen(&p,Path,SFLAG_RDONLY|SFLAG_BUFFERED|(LowMemory ? 0 : SFLAG_MEMORY_MAP));
     if (!Input)
     {
         TextPrintf(StdErr,T("Could not open file \"%s\" for reading\r\n"),Path);
         Result = -2;
         goto exit;
     }
+    CRCPool = EBML_CRCPoolCreate(CRCThreads);
 
     // parse the source file to determine if it's a Matroska file and determine the location of the key parts
     RContext.Context = MATROSKA_getContextStream();
@@ -1043,12 +1253,30 @@ int main(int argc, const char *argv[])
         RLevelX = NULL;
         if (EL_Type(RLevel1, MATROSKA_getContextCluster()))
         {
+            if (CRCPool)
+                EBML_MasterDeferChecksum(RLevel1, CRCPool);
             if (EBML_ElementReadData(RLevel1,Input,&RSegmentContext,0,SCOPE_PARTIAL_DATA,4)==ERR_NONE)
 			{
+                // the Clusters can only be checked as they come once the tracks are known
+                if (!ARRAYCOUNT(RClusterPos,filepos_t))
+                    StreamClusters = LowMemory && RSegmentInfo && RTrackInfo;
                 ArrayAppend(&RClusters,&RLevel1,sizeof(RLevel1),256);
+                Pos = EL_Pos(RLevel1);
+                ArrayAppend(&RClusterPos,&Pos,sizeof(Pos),1024);
 				NodeTree_SetParent(RLevel1, RSegment, NULL);
 				VoidAmount += CheckUnknownElements((ebml_element*)RLevel1);
+				Result |= CheckClusterChecksums(RLevel1,0);
 				Result |= CheckProfileViolation((ebml_element*)RLevel1, MatroskaProfile);
+                if (StreamClusters)
+                {
+                    if (ARRAYCOUNT(RClusterPos,filepos_t)==1)
+                    {
+                        BuildTrackMap(0);
+                        if (RCues)
+                            ReadCueTargets();
+                    }
+                    Result |= CheckStreamedCluster((matroska_cluster*)RLevel1, (ebml_element*)RSegment, MatroskaProfile, HasVideo);
+                }
                 RLevelX = (ebml_master*)EBML_ElementSkipData((ebml_element*)RLevel1, Input, &RSegmentContext, NULL, 1);
 			}
 			else
@@ -1306,6 +1534,7 @@ int main(int argc, const char *argv[])
         else
 		    RLevel1 = (ebml_master*)EBML_FindNextElement(Input, &RSegmentContext, &UpperElement, 1);
 	}
+	Result |= CheckClusterChecksums(NULL,1);
 
 	if (!RSegmentInfo)
 	{
@@ -1329,22 +1558,30 @@ int main(int argc, const char *argv[])
 	if (RSeekHead2)
 		Result |= CheckSeekHead(RSeekHead2);
 
-	if (ARRAYCOUNT(RClusters,ebml_element*))
+	if (ARRAYCOUNT(RClusterPos,filepos_t))
 	{
         if (!Quiet) TextWrite(StdErr,T("."));
-		LinkClusterBlocks(MatroskaProfile);
-
-        if (HasVideo)
-            Result |= CheckVideoStart(MatroskaProfile);
-        Result |= CheckLacingKeyframe(MatroskaProfile);
-        Result |= CheckPosSize((ebml_element*)RSegment);
+        if (!StreamClusters)
+        {
+            BuildTrackMap(RCues!=NULL);
+            for (Cluster = ARRAYBEGIN(RClusters,ebml_master*);Cluster != ARRAYEND(RClusters,ebml_master*); ++Cluster)
+                LinkClusterBlocks((matroska_cluster*)*Cluster, MatroskaProfile);
+
+            if (HasVideo)
+                for (Cluster = ARRAYBEGIN(RClusters,ebml_master*);Cluster != ARRAYEND(RClusters,ebml_master*); ++Cluster)
+                    Result |= CheckVideoStart(*Cluster);
+            for (Cluster = ARRAYBEGIN(RClusters,ebml_master*);Cluster != ARRAYEND(RClusters,ebml_master*); ++Cluster)
+                Result |= CheckLacingKeyframe((matroska_cluster*)*Cluster);
+            for (Cluster = ARRAYBEGIN(RClusters,ebml_master*);Cluster != ARRAYEND(RClusters,ebml_master*); ++Cluster)
+                Result |= CheckPosSize((ebml_element*)RSegment, (ebml_element*)*Cluster, Cluster==ARRAYBEGIN(RClusters,ebml_master*) ? INVALID_FILEPOS_T : EL_Pos(Cluster[-1]));
+        }
 		if (!RCues)
         {
-            if (!Live && ARRAYCOUNT(RClusters,ebml_element*)>1)
+            if (!Live && ARRAYCOUNT(RClusterPos,filepos_t)>1)
 			    OutputWarning(0x800,T("The segment has Clusters but no Cues section (bad for seeking)"));
         }
 		else
-			Result |= CheckCueEntries(RCues);
+			Result |= CheckCueEntries(RCues,(ebml_element*)RSegment);
 		if (!RTrackInfo)
 		{
 			Result = OutputError(0x41,T("The segment has Clusters but no TrackInfo section"));
@@ -1406,9 +1643,14 @@ exit:
         }
 	}
 
+    if (CRCPool)
+        EBML_CRCPoolDelete(CRCPool);
     for (Cluster = ARRAYBEGIN(RClusters,ebml_master*);Cluster != ARRAYEND(RClusters,ebml_master*); ++Cluster)
         NodeDelete((node*)*Cluster);
     ArrayClear(&RClusters);
+    ArrayClear(&RClusterPos);
+    ArrayClear(&StreamBlocks);
+    ArrayClear(&CueTargets);
     if (RAttachments)
         NodeDelete((node*)RAttachments);
     if (RTags)
@@ -1417,6 +1659,7 @@ exit:
         NodeDelete((node*)RCues);
     if (RChapters)
         NodeDelete((node*)RChapters);
+    MATROSKA_TrackMapClear(&TrackMap);
     if (RTrackInfo)
         NodeDelete((node*)RTrackInfo);
     if (RSegmentInfo)
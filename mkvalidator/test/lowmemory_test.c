@@ -0,0 +1,327 @@
+/*
+ * $Id$
+ * Copyright (c) 2008-2010, Matroska Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Matroska assocation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY the Matroska association ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL The Matroska Foundation BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#ifdef _WIN32
+#define popen  _popen
+#define pclose _pclose
+#endif
+
+// run mkvalidator with and without --low-memory on files with Cues entries on
+// non-keyframes, in the wrong Cluster, on an unknown track and on no Block
+
+#define TEST_FILE   "lowmemory_test.mkv"
+#define MAX_LINES   64
+#define MAX_LINE    256
+
+typedef struct builder
+{
+    uint8_t Data[4096];
+    size_t Size;
+    size_t Masters[8];
+    size_t Depth;
+
+} builder;
+
+typedef struct cue_entry
+{
+    int Timestamp;
+    int TrackNum;
+    int Cluster;
+
+} cue_entry;
+
+typedef struct messages
+{
+    char Lines[MAX_LINES][MAX_LINE];
+    size_t Count;
+    int Status;
+
+} messages;
+
+// each Cluster has a keyframe at 0 and non-keyframes after it, the last one in a BlockGroup
+static const int ClusterTimestamps[] = { 0, 100, 200 };
+static const int BlockTimestamps[] = { 0, 20, 40, 60 };
+
+static const cue_entry CueEntries[] = {
+    {   0, 2, 0 }, // keyframe
+    {  20, 2, 0 }, // SimpleBlock non-keyframe
+    {  80, 2, 0 }, // Block non-keyframe
+    { 120, 2, 0 }, // in the next Cluster: ERR313
+    { 140, 1, 1 }, // no TrackEntry for track 1: ERR312
+    { 150, 2, 1 }, // no Block: ERR312
+    { 260, 2, 2 }, // Block non-keyframe
+};
+
+static void PutBytes(builder *b, uint64_t Value, size_t Size)
+{
+    while (Size--)
+        b->Data[b->Size++] = (uint8_t)(Value >> (Size*8));
+}
+
+static void PutId(builder *b, uint32_t Id)
+{
+    PutBytes(b, Id, Id > 0xFFFFFF ? 4 : Id > 0xFFFF ? 3 : Id > 0xFF ? 2 : 1);
+}
+
+// all the sizes are coded on 8 octets so the positions don't change the element sizes
+static void PutSize(builder *b, uint64_t Size)
+{
+    PutBytes(b, 0x0100000000000000 | Size, 8);
+}
+
+static void StartMaster(builder *b, uint32_t Id)
+{
+    PutId(b, Id);
+    b->Masters[b->Depth++] = b->Size;
+    PutSize(b, 0);
+}
+
+static void EndMaster(builder *b)
+{
+    size_t Pos = b->Masters[--b->Depth];
+    size_t End = b->Size;
+    b->Size = Pos;
+    PutSize(b, End - Pos - 8);
+    b->Size = End;
+}
+
+static void PutUInt(builder *b, uint32_t Id, uint64_t Value)
+{
+    PutId(b, Id);
+    PutSize(b, 8);
+    PutBytes(b, Value, 8);
+}
+
+static void PutString(builder *b, uint32_t Id, const char *Value)
+{
+    PutId(b, Id);
+    PutSize(b, strlen(Value));
+    memcpy(b->Data + b->Size, Value, strlen(Value));
+    b->Size += strlen(Value);
+}
+
+static void PutBlock(builder *b, uint32_t Id, int TrackNum, int Timestamp, uint8_t Flags)
+{
+    PutId(b, Id);
+    PutSize(b, 5);
+    PutBytes(b, 0x80 | TrackNum, 1);
+    PutBytes(b, (uint16_t)Timestamp, 2);
+    PutBytes(b, Flags, 1);
+    PutBytes(b, 'x', 1);
+}
+
+static void PutCues(builder *b, const size_t *ClusterPos)
+{
+    size_t i;
+
+    StartMaster(b, 0x1C53BB6B); // Cues
+    for (i=0;i<sizeof(CueEntries)/sizeof(CueEntries[0]);++i)
+    {
+        StartMaster(b, 0xBB); // CuePoint
+        PutUInt(b, 0xB3, CueEntries[i].Timestamp);
+        StartMaster(b, 0xB7); // CueTrackPositions
+        PutUInt(b, 0xF7, CueEntries[i].TrackNum);
+        PutUInt(b, 0xF1, ClusterPos[CueEntries[i].Cluster]);
+        EndMaster(b);
+        EndMaster(b);
+    }
+    EndMaster(b);
+}
+
+static void BuildFile(builder *b, int CuesFirst)
+{
+    size_t ClusterPos[sizeof(ClusterTimestamps)/sizeof(ClusterTimestamps[0])];
+    size_t SegmentData, i, j;
+    int Pass;
+
+    memset(ClusterPos, 0, sizeof(ClusterPos));
+    // the first pass finds the Cluster positions for the Cues
+    for (Pass=0;Pass<2;++Pass)
+    {
+        b->Size = 0;
+        b->Depth = 0;
+
+        StartMaster(b, 0x1A45DFA3); // EBML
+        PutUInt(b, 0x4286, 1);
+        PutUInt(b, 0x42F7, 1);
+        PutUInt(b, 0x42F2, 4);
+        PutUInt(b, 0x42F3, 8);
+        PutString(b, 0x4282, "matroska");
+        PutUInt(b, 0x4287, 4);
+        PutUInt(b, 0x4285, 2);
+        EndMaster(b);
+
+        StartMaster(b, 0x18538067); // Segment
+        SegmentData = b->Size;
+
+        StartMaster(b, 0x1549A966); // Info
+        PutUInt(b, 0x2AD7B1, 1000000);
+        PutString(b, 0x4D80, "lowmemory_test");
+        PutString(b, 0x5741, "lowmemory_test");
+        EndMaster(b);
+
+        StartMaster(b, 0x1654AE6B); // Tracks
+        StartMaster(b, 0xAE); // TrackEntry
+        PutUInt(b, 0xD7, 2);
+        PutUInt(b, 0x73C5, 2);
+        PutUInt(b, 0x83, 1);
+        PutString(b, 0x86, "V_UNCOMPRESSED");
+        StartMaster(b, 0xE0); // Video
+        PutUInt(b, 0xB0, 16);
+        PutUInt(b, 0xBA, 16);
+        EndMaster(b);
+        EndMaster(b);
+        EndMaster(b);
+
+        if (CuesFirst)
+            PutCues(b, ClusterPos);
+
+        for (i=0;i<sizeof(ClusterTimestamps)/sizeof(ClusterTimestamps[0]);++i)
+        {
+            ClusterPos[i] = b->Size - SegmentData;
+            StartMaster(b, 0x1F43B675); // Cluster
+            PutUInt(b, 0xE7, ClusterTimestamps[i]);
+            for (j=0;j<sizeof(BlockTimestamps)/sizeof(BlockTimestamps[0]);++j)
+                PutBlock(b, 0xA3, 2, BlockTimestamps[j], j==0 ? 0x80 : 0x00);
+            StartMaster(b, 0xA0); // BlockGroup
+            PutBlock(b, 0xA1, 2, 80, 0x00);
+            PutUInt(b, 0xFB, (uint64_t)-20);
+            EndMaster(b);
+            EndMaster(b);
+        }
+
+        if (!CuesFirst)
+            PutCues(b, ClusterPos);
+
+        EndMaster(b);
+    }
+}
+
+static int CmpLines(const void *a, const void *b)
+{
+    return strcmp((const char*)a, (const char*)b);
+}
+
+// keep the sorted errors and warnings
+static int RunValidator(const char *Options, messages *Out)
+{
+    char Command[MAX_LINE*2], Line[MAX_LINE], *s;
+    FILE *Pipe;
+
+    Out->Count = 0;
+    snprintf(Command, sizeof(Command), "\"%s\" --quiet %s %s 2>&1", MKVALIDATOR, Options, TEST_FILE);
+    Pipe = popen(Command, "r");
+    if (!Pipe)
+    {
+        fprintf(stderr,"failed to run %s\r\n",Command);
+        return 0;
+    }
+    while (fgets(Line, sizeof(Line), Pipe))
+    {
+        for (s=Line;*s=='\r';++s) {}
+        s[strcspn(s, "\r\n")] = 0;
+        if ((strncmp(s, "ERR", 3)==0 || strncmp(s, "WRN", 3)==0) && Out->Count < MAX_LINES)
+            strcpy(Out->Lines[Out->Count++], s);
+    }
+    Out->Status = pclose(Pipe);
+    qsort(Out->Lines, Out->Count, MAX_LINE, CmpLines);
+    return 1;
+}
+
+static size_t CountLines(const messages *Messages, const char *Prefix)
+{
+    size_t i, Count = 0;
+    for (i=0;i<Messages->Count;++i)
+        if (strncmp(Messages->Lines[i], Prefix, strlen(Prefix))==0)
+            ++Count;
+    return Count;
+}
+
+static int CheckBothModes(int CuesFirst)
+{
+    static builder File;
+    static messages Default, LowMemory;
+    FILE *Output;
+    size_t i;
+    int Result = 0;
+
+    BuildFile(&File, CuesFirst);
+    Output = fopen(TEST_FILE, "wb");
+    if (!Output || fwrite(File.Data, 1, File.Size, Output) != File.Size)
+    {
+        fprintf(stderr,"failed to write %s\r\n",TEST_FILE);
+        if (Output)
+            fclose(Output);
+        return 1;
+    }
+    fclose(Output);
+
+    if (!RunValidator("", &Default) || !RunValidator("--low-memory", &LowMemory))
+        Result = 1;
+    else
+    {
+        if (CountLines(&Default, "ERR312") != 2 || CountLines(&Default, "ERR313") != 1)
+        {
+            fprintf(stderr,"Cues %s the Clusters: %d ERR312 and %d ERR313 instead of 2 and 1\r\n",CuesFirst?"before":"after",
+                (int)CountLines(&Default, "ERR312"),(int)CountLines(&Default, "ERR313"));
+            Result = 1;
+        }
+        if (Default.Count != LowMemory.Count || Default.Status != LowMemory.Status)
+        {
+            fprintf(stderr,"Cues %s the Clusters: %d messages and status %d, %d messages and status %d with --low-memory\r\n",CuesFirst?"before":"after",
+                (int)Default.Count,Default.Status,(int)LowMemory.Count,LowMemory.Status);
+            Result = 1;
+        }
+        for (i=0;i<Default.Count && i<LowMemory.Count;++i)
+        {
+            if (strcmp(Default.Lines[i], LowMemory.Lines[i])!=0)
+            {
+                fprintf(stderr,"Cues %s the Clusters: \"%s\" but \"%s\" with --low-memory\r\n",CuesFirst?"before":"after",Default.Lines[i],LowMemory.Lines[i]);
+                Result = 1;
+            }
+        }
+    }
+    remove(TEST_FILE);
+    return Result;
+}
+
+int main(void)
+{
+    int Result = 0;
+
+    Result |= CheckBothModes(1);
+    Result |= CheckBothModes(0);
+    if (!Result)
+        fprintf(stdout,"--low-memory Cues check OK\r\n");
+    return Result;
+}